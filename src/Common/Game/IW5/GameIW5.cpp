@@ -20,11 +20,13 @@ std::string GameIW5::GetShortName()
 
 void GameIW5::AddZone(Zone* zone)
 {
+    std::lock_guard lock(m_zones_mutex);
     m_zones.push_back(zone);
 }
 
 void GameIW5::RemoveZone(Zone* zone)
 {
+    std::lock_guard lock(m_zones_mutex);
     const auto foundEntry = std::ranges::find(m_zones, zone);
 
     if (foundEntry != m_zones.end())
@@ -33,6 +35,7 @@ void GameIW5::RemoveZone(Zone* zone)
 
 std::vector<Zone*> GameIW5::GetZones()
 {
+    std::lock_guard lock(m_zones_mutex);
     return m_zones;
 }
 
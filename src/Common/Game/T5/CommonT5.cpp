@@ -87,3 +87,18 @@ void Common::Vec4UnpackGfxColor(const GfxColor& in, vec4_t* out)
 {
     Pack32::Vec4UnpackGfxColor(in.packed, reinterpret_cast<float*>(out));
 }
+
+void Common::Vec2UnpackTexCoords(const uint32_t* in, float* outU, float* outV, const size_t count)
+{
+    Pack32::Vec2UnpackTexCoordsVU(in, outU, outV, count);
+}
+
+void Common::Vec3UnpackUnitVec(const uint32_t* in, float* outX, float* outY, float* outZ, const size_t count)
+{
+    Pack32::Vec3UnpackUnitVecScaleBased(in, outX, outY, outZ, count);
+}
+
+void Common::Vec4UnpackGfxColor(const uint32_t* in, float* outR, float* outG, float* outB, float* outA, const size_t count)
+{
+    Pack32::Vec4UnpackGfxColor(in, outR, outG, outB, outA, count);
+}
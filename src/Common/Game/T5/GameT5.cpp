@@ -20,11 +20,13 @@ std::string GameT5::GetShortName()
 
 void GameT5::AddZone(Zone* zone)
 {
+    std::lock_guard lock(m_zones_mutex);
     m_zones.push_back(zone);
 }
 
 void GameT5::RemoveZone(Zone* zone)
 {
+    std::lock_guard lock(m_zones_mutex);
     const auto foundEntry = std::ranges::find(m_zones, zone);
 
     if (foundEntry != m_zones.end())
@@ -33,6 +35,7 @@ void GameT5::RemoveZone(Zone* zone)
 
 std::vector<Zone*> GameT5::GetZones()
 {
+    std::lock_guard lock(m_zones_mutex);
     return m_zones;
 }
 
@@ -47,5 +47,8 @@ namespace T6
         static void Vec2UnpackTexCoords(const PackedTexCoords& in, vec2_t* out);
         static void Vec3UnpackUnitVec(const PackedUnitVec& in, vec3_t* out);
         static void Vec4UnpackGfxColor(const GfxColor& in, vec4_t* out);
+        static void Vec2UnpackTexCoords(const uint32_t* in, float* outU, float* outV, size_t count);
+        static void Vec3UnpackUnitVec(const uint32_t* in, float* outX, float* outY, float* outZ, size_t count);
+        static void Vec4UnpackGfxColor(const uint32_t* in, float* outR, float* outG, float* outB, float* outA, size_t count);
     };
 } // namespace T6
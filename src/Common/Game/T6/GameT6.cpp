@@ -20,11 +20,13 @@ std::string GameT6::GetShortName()
 
 void GameT6::AddZone(Zone* zone)
 {
+    std::lock_guard lock(m_zones_mutex);
     m_zones.push_back(zone);
 }
 
 void GameT6::RemoveZone(Zone* zone)
 {
+    std::lock_guard lock(m_zones_mutex);
     const auto foundEntry = std::ranges::find(m_zones, zone);
 
     if (foundEntry != m_zones.end())
@@ -33,6 +35,7 @@ void GameT6::RemoveZone(Zone* zone)
 
 std::vector<Zone*> GameT6::GetZones()
 {
+    std::lock_guard lock(m_zones_mutex);
     return m_zones;
 }
 
@@ -1,8 +1,11 @@
 #pragma once
 #include "Game/IGame.h"
 
+#include <mutex>
+
 class GameT6 : public IGame
 {
+    std::mutex m_zones_mutex;
     std::vector<Zone*> m_zones;
 
 public:
@@ -1,114 +1,535 @@
 #include "TextureConverter.h"
 
+#include "Utils/TaskGroup.h"
+
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <vector>
 
-constexpr uint64_t TextureConverter::Mask1(const unsigned length)
-{
-    if (length >= sizeof(uint64_t) * 8)
-        return UINT64_MAX;
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TEXTURE_CONVERTER_SSE2
+#include <emmintrin.h>
+#endif
 
-    return UINT64_MAX >> (sizeof(uint64_t) * 8 - length);
-}
+#if defined(__AVX2__)
+#define TEXTURE_CONVERTER_AVX2
+#include <immintrin.h>
+#endif
 
-void TextureConverter::SetPixelFunctions(const unsigned inBitCount, const unsigned outBitCount)
+namespace
 {
-    switch (inBitCount)
+    constexpr size_t PIXELS_PER_TASK = 64 * 1024;
+    constexpr unsigned CHANNEL_COUNT = 4;
+    constexpr unsigned DECODED_BYTES_PER_PIXEL = 4;
+
+    class ChannelConversion
     {
-    case 16:
-        m_read_pixel_func = [](const void* offset, unsigned bitCount)
-        {
-            return static_cast<uint64_t>(*static_cast<const uint16_t*>(offset));
-        };
-        break;
+    public:
+        unsigned m_input_offset;
+        unsigned m_input_size;
+        unsigned m_output_offset;
+        unsigned m_output_size;
+    };
+
+    class UnsignedConversion
+    {
+    public:
+        unsigned m_input_bytes_per_pixel;
+        unsigned m_output_bytes_per_pixel;
+        ChannelConversion m_channels[CHANNEL_COUNT];
+        unsigned m_channel_count;
+
+        /**
+         * \brief The bits that are set in every output pixel. Used for alpha channels that the input format does not have.
+         */
+        uint64_t m_output_fill;
+    };
+
+    typedef void (*unsigned_conversion_kernel_t)(const uint8_t* input, uint8_t* output, size_t pixelCount, const UnsignedConversion& conversion);
+    typedef void (*block_decoder_t)(const uint8_t* block, uint8_t* texels);
+
+    constexpr uint64_t Mask1(const unsigned length)
+    {
+        if (length >= sizeof(uint64_t) * 8)
+            return UINT64_MAX;
+
+        return UINT64_MAX >> (sizeof(uint64_t) * 8 - length);
+    }
+
+    /**
+     * \brief Scales a channel value to a different bit count.
+     * Truncates when the output is smaller and replicates the input bits when it is larger, so that the maximum value stays the maximum value.
+     */
+    uint64_t ScaleChannel(const uint64_t value, const unsigned inputSize, const unsigned outputSize)
+    {
+        if (inputSize == outputSize)
+            return value;
+
+        if (outputSize < inputSize)
+            return value >> (inputSize - outputSize);
 
-    case 32:
-        m_read_pixel_func = [](const void* offset, unsigned bitCount)
+        uint64_t result = 0;
+        auto shift = static_cast<int>(outputSize) - static_cast<int>(inputSize);
+        while (shift > 0)
         {
-            return static_cast<uint64_t>(*static_cast<const uint32_t*>(offset));
-        };
-        break;
+            result |= value << shift;
+            shift -= static_cast<int>(inputSize);
+        }
+
+        return result | value >> -shift;
+    }
+
+    template<unsigned BytesPerPixel> uint64_t ReadPixel(const uint8_t* input)
+    {
+        uint64_t pixel = 0;
+        for (auto i = 0u; i < BytesPerPixel; i++)
+            pixel |= static_cast<uint64_t>(input[i]) << (i * 8);
+
+        return pixel;
+    }
+
+    template<unsigned BytesPerPixel> void WritePixel(uint8_t* output, const uint64_t pixel)
+    {
+        for (auto i = 0u; i < BytesPerPixel; i++)
+            output[i] = static_cast<uint8_t>(pixel >> (i * 8));
+    }
+
+    void CopyPixels(const uint8_t* input, uint8_t* output, const size_t pixelCount, const UnsignedConversion& conversion)
+    {
+        std::memcpy(output, input, pixelCount * conversion.m_input_bytes_per_pixel);
+    }
 
-    case 64:
-        m_read_pixel_func = [](const void* offset, unsigned bitCount)
+    template<unsigned InputBytesPerPixel, unsigned OutputBytesPerPixel>
+    void ConvertPixelsGeneric(const uint8_t* input, uint8_t* output, const size_t pixelCount, const UnsignedConversion& conversion)
+    {
+        for (size_t i = 0; i < pixelCount; i++)
         {
-            return *static_cast<const uint64_t*>(offset);
-        };
-        break;
+            const auto inPixel = ReadPixel<InputBytesPerPixel>(&input[i * InputBytesPerPixel]);
+            auto outPixel = conversion.m_output_fill;
 
-    default:
-        if (inBitCount <= 64)
+            for (auto channelIndex = 0u; channelIndex < conversion.m_channel_count; channelIndex++)
+            {
+                const auto& channel = conversion.m_channels[channelIndex];
+                const auto value = (inPixel >> channel.m_input_offset) & Mask1(channel.m_input_size);
+                outPixel |= ScaleChannel(value, channel.m_input_size, channel.m_output_size) << channel.m_output_offset;
+            }
+
+            WritePixel<OutputBytesPerPixel>(&output[i * OutputBytesPerPixel], outPixel);
+        }
+    }
+
+    uint32_t SwapRedBlue(const uint32_t pixel)
+    {
+        return (pixel & 0xFF00FF00u) | (pixel & 0x000000FFu) << 16 | (pixel >> 16 & 0x000000FFu);
+    }
+
+    /**
+     * \brief Converts between formats with four 8 bit channels in 32 bit pixels.
+     * \tparam Swap Whether the first and third channel swap places.
+     * \tparam KeepMask The bits of the input pixel that are kept.
+     * \tparam FillMask The bits that are set in each output pixel.
+     */
+    template<bool Swap, uint32_t KeepMask, uint32_t FillMask>
+    void ConvertPixels32(const uint8_t* input, uint8_t* output, const size_t pixelCount, const UnsignedConversion& conversion)
+    {
+        size_t i = 0;
+
+#ifdef TEXTURE_CONVERTER_AVX2
         {
-            m_read_pixel_func = [](const void* offset, const unsigned bitCount)
+            const auto redBlueMask = _mm256_set1_epi32(0x00FF00FF);
+            const auto keepMask = _mm256_set1_epi32(static_cast<int>(KeepMask));
+            const auto fillMask = _mm256_set1_epi32(static_cast<int>(FillMask));
+
+            for (; i + 8 <= pixelCount; i += 8)
             {
-                uint64_t result = 0;
+                auto pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&input[i * 4]));
+                if constexpr (Swap)
+                {
+                    const auto redBlue = _mm256_and_si256(pixels, redBlueMask);
+                    pixels = _mm256_or_si256(_mm256_andnot_si256(redBlueMask, pixels), _mm256_or_si256(_mm256_slli_epi32(redBlue, 16), _mm256_srli_epi32(redBlue, 16)));
+                }
+                pixels = _mm256_or_si256(_mm256_and_si256(pixels, keepMask), fillMask);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&output[i * 4]), pixels);
+            }
+        }
+#endif
 
-                for (auto pixelOffset = 0u; pixelOffset < bitCount; pixelOffset += 8)
+#ifdef TEXTURE_CONVERTER_SSE2
+        {
+            const auto redBlueMask = _mm_set1_epi32(0x00FF00FF);
+            const auto keepMask = _mm_set1_epi32(static_cast<int>(KeepMask));
+            const auto fillMask = _mm_set1_epi32(static_cast<int>(FillMask));
+
+            for (; i + 4 <= pixelCount; i += 4)
+            {
+                auto pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&input[i * 4]));
+                if constexpr (Swap)
                 {
-                    result |= (static_cast<uint64_t>(*(static_cast<const uint8_t*>(offset) + (pixelOffset / 8))) << pixelOffset);
+                    const auto redBlue = _mm_and_si128(pixels, redBlueMask);
+                    pixels = _mm_or_si128(_mm_andnot_si128(redBlueMask, pixels), _mm_or_si128(_mm_slli_epi32(redBlue, 16), _mm_srli_epi32(redBlue, 16)));
                 }
+                pixels = _mm_or_si128(_mm_and_si128(pixels, keepMask), fillMask);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(&output[i * 4]), pixels);
+            }
+        }
+#endif
 
-                return result;
-            };
+        for (; i < pixelCount; i++)
+        {
+            uint32_t pixel;
+            std::memcpy(&pixel, &input[i * 4], sizeof(pixel));
+            if constexpr (Swap)
+                pixel = SwapRedBlue(pixel);
+            pixel = (pixel & KeepMask) | FillMask;
+            std::memcpy(&output[i * 4], &pixel, sizeof(pixel));
         }
-        else
+    }
+
+    template<bool Swap, uint32_t FillMask>
+    void ConvertPixels24To32(const uint8_t* input, uint8_t* output, const size_t pixelCount, const UnsignedConversion& conversion)
+    {
+        for (size_t i = 0; i < pixelCount; i++)
         {
-            assert(false);
-            m_read_pixel_func = [](const void* offset, unsigned bitCount)
-            {
-                return 0ull;
-            };
+            const auto* inPixel = &input[i * 3];
+            auto pixel = static_cast<uint32_t>(inPixel[0]) | static_cast<uint32_t>(inPixel[1]) << 8 | static_cast<uint32_t>(inPixel[2]) << 16;
+            if constexpr (Swap)
+                pixel = SwapRedBlue(pixel);
+            pixel |= FillMask;
+            std::memcpy(&output[i * 4], &pixel, sizeof(pixel));
         }
-        break;
     }
 
-    switch (outBitCount)
+    template<bool Swap> void ConvertPixels32To24(const uint8_t* input, uint8_t* output, const size_t pixelCount, const UnsignedConversion& conversion)
     {
-    case 16:
-        m_write_pixel_func = [](void* offset, const uint64_t pixel, unsigned bitCount)
+        for (size_t i = 0; i < pixelCount; i++)
         {
-            *static_cast<uint16_t*>(offset) = static_cast<uint16_t>(pixel);
-        };
-        break;
+            const auto* inPixel = &input[i * 4];
+            auto* outPixel = &output[i * 3];
+            outPixel[0] = inPixel[Swap ? 2 : 0];
+            outPixel[1] = inPixel[1];
+            outPixel[2] = inPixel[Swap ? 0 : 2];
+        }
+    }
 
-    case 32:
-        m_write_pixel_func = [](void* offset, const uint64_t pixel, unsigned bitCount)
+    class SpecializedKernel
+    {
+    public:
+        ImageFormatId m_input_format;
+        ImageFormatId m_output_format;
+        unsigned_conversion_kernel_t m_kernel;
+    };
+
+    // Conversions between the formats that are actually written by dumpers. Everything else falls back to the generic kernels.
+    const SpecializedKernel SPECIALIZED_KERNELS[]{
+        {ImageFormatId::R8_G8_B8_A8, ImageFormatId::B8_G8_R8_A8, ConvertPixels32<true, 0xFFFFFFFFu, 0u>          },
+        {ImageFormatId::B8_G8_R8_A8, ImageFormatId::R8_G8_B8_A8, ConvertPixels32<true, 0xFFFFFFFFu, 0u>          },
+        {ImageFormatId::R8_G8_B8_A8, ImageFormatId::B8_G8_R8_X8, ConvertPixels32<true, 0x00FFFFFFu, 0u>          },
+        {ImageFormatId::B8_G8_R8_A8, ImageFormatId::B8_G8_R8_X8, ConvertPixels32<false, 0x00FFFFFFu, 0u>         },
+        {ImageFormatId::B8_G8_R8_X8, ImageFormatId::R8_G8_B8_A8, ConvertPixels32<true, 0x00FFFFFFu, 0xFF000000u> },
+        {ImageFormatId::B8_G8_R8_X8, ImageFormatId::B8_G8_R8_A8, ConvertPixels32<false, 0x00FFFFFFu, 0xFF000000u>},
+        {ImageFormatId::R8_G8_B8,    ImageFormatId::B8_G8_R8_X8, ConvertPixels24To32<true, 0u>                   },
+        {ImageFormatId::R8_G8_B8,    ImageFormatId::R8_G8_B8_A8, ConvertPixels24To32<false, 0xFF000000u>         },
+        {ImageFormatId::R8_G8_B8,    ImageFormatId::B8_G8_R8_A8, ConvertPixels24To32<true, 0xFF000000u>          },
+        {ImageFormatId::R8_G8_B8_A8, ImageFormatId::R8_G8_B8,    ConvertPixels32To24<false>                      },
+        {ImageFormatId::B8_G8_R8_A8, ImageFormatId::R8_G8_B8,    ConvertPixels32To24<true>                       },
+        {ImageFormatId::B8_G8_R8_X8, ImageFormatId::R8_G8_B8,    ConvertPixels32To24<true>                       },
+    };
+
+    template<unsigned InputBytesPerPixel> unsigned_conversion_kernel_t GetGenericKernel(const unsigned outputBytesPerPixel)
+    {
+        switch (outputBytesPerPixel)
         {
-            *static_cast<uint32_t*>(offset) = static_cast<uint32_t>(pixel);
-        };
-        break;
+        case 1:
+            return ConvertPixelsGeneric<InputBytesPerPixel, 1>;
+        case 2:
+            return ConvertPixelsGeneric<InputBytesPerPixel, 2>;
+        case 3:
+            return ConvertPixelsGeneric<InputBytesPerPixel, 3>;
+        case 4:
+            return ConvertPixelsGeneric<InputBytesPerPixel, 4>;
+        case 5:
+            return ConvertPixelsGeneric<InputBytesPerPixel, 5>;
+        case 6:
+            return ConvertPixelsGeneric<InputBytesPerPixel, 6>;
+        case 7:
+            return ConvertPixelsGeneric<InputBytesPerPixel, 7>;
+        case 8:
+            return ConvertPixelsGeneric<InputBytesPerPixel, 8>;
+        default:
+            return nullptr;
+        }
+    }
 
-    case 64:
-        m_write_pixel_func = [](void* offset, const uint64_t pixel, unsigned bitCount)
+    unsigned_conversion_kernel_t GetGenericKernel(const unsigned inputBytesPerPixel, const unsigned outputBytesPerPixel)
+    {
+        switch (inputBytesPerPixel)
         {
-            *static_cast<uint64_t*>(offset) = pixel;
+        case 1:
+            return GetGenericKernel<1>(outputBytesPerPixel);
+        case 2:
+            return GetGenericKernel<2>(outputBytesPerPixel);
+        case 3:
+            return GetGenericKernel<3>(outputBytesPerPixel);
+        case 4:
+            return GetGenericKernel<4>(outputBytesPerPixel);
+        case 5:
+            return GetGenericKernel<5>(outputBytesPerPixel);
+        case 6:
+            return GetGenericKernel<6>(outputBytesPerPixel);
+        case 7:
+            return GetGenericKernel<7>(outputBytesPerPixel);
+        case 8:
+            return GetGenericKernel<8>(outputBytesPerPixel);
+        default:
+            return nullptr;
+        }
+    }
+
+    UnsignedConversion CreateUnsignedConversion(const ImageFormatUnsigned* inputFormat, const ImageFormatUnsigned* outputFormat)
+    {
+        UnsignedConversion conversion{};
+        conversion.m_input_bytes_per_pixel = inputFormat->m_bits_per_pixel / 8;
+        conversion.m_output_bytes_per_pixel = outputFormat->m_bits_per_pixel / 8;
+
+        const auto addChannel = [&conversion](const unsigned inputOffset, const unsigned inputSize, const unsigned outputOffset, const unsigned outputSize)
+        {
+            if (inputSize > 0 && outputSize > 0)
+                conversion.m_channels[conversion.m_channel_count++] = {inputOffset, inputSize, outputOffset, outputSize};
         };
-        break;
 
-    default:
-        if (inBitCount <= 64)
+        addChannel(inputFormat->m_r_offset, inputFormat->m_r_size, outputFormat->m_r_offset, outputFormat->m_r_size);
+        addChannel(inputFormat->m_g_offset, inputFormat->m_g_size, outputFormat->m_g_offset, outputFormat->m_g_size);
+        addChannel(inputFormat->m_b_offset, inputFormat->m_b_size, outputFormat->m_b_offset, outputFormat->m_b_size);
+        addChannel(inputFormat->m_a_offset, inputFormat->m_a_size, outputFormat->m_a_offset, outputFormat->m_a_size);
+
+        // Formats without alpha are opaque
+        if (!inputFormat->HasA() && outputFormat->HasA())
+            conversion.m_output_fill = Mask1(outputFormat->m_a_size) << outputFormat->m_a_offset;
+
+        return conversion;
+    }
+
+    unsigned_conversion_kernel_t GetUnsignedConversionKernel(const ImageFormatUnsigned* inputFormat, const ImageFormatUnsigned* outputFormat)
+    {
+        if (inputFormat->m_bits_per_pixel % 8 != 0 || outputFormat->m_bits_per_pixel % 8 != 0)
+            return nullptr;
+
+        if (inputFormat->GetId() == outputFormat->GetId())
+            return CopyPixels;
+
+        for (const auto& specializedKernel : SPECIALIZED_KERNELS)
+        {
+            if (specializedKernel.m_input_format == inputFormat->GetId() && specializedKernel.m_output_format == outputFormat->GetId())
+                return specializedKernel.m_kernel;
+        }
+
+        return GetGenericKernel(inputFormat->m_bits_per_pixel / 8, outputFormat->m_bits_per_pixel / 8);
+    }
+
+    void Rgb565ToRgba8(const unsigned color, uint8_t* rgba)
+    {
+        const auto r = color >> 11 & 0x1F;
+        const auto g = color >> 5 & 0x3F;
+        const auto b = color & 0x1F;
+
+        rgba[0] = static_cast<uint8_t>(r << 3 | r >> 2);
+        rgba[1] = static_cast<uint8_t>(g << 2 | g >> 4);
+        rgba[2] = static_cast<uint8_t>(b << 3 | b >> 2);
+        rgba[3] = UINT8_MAX;
+    }
+
+    void DecodeColorBlock(const uint8_t* block, uint8_t* texels, const bool allowTransparency)
+    {
+        const auto color0 = static_cast<unsigned>(block[0] | block[1] << 8);
+        const auto color1 = static_cast<unsigned>(block[2] | block[3] << 8);
+
+        uint8_t palette[4][4];
+        Rgb565ToRgba8(color0, palette[0]);
+        Rgb565ToRgba8(color1, palette[1]);
+
+        if (color0 > color1 || !allowTransparency)
         {
-            m_write_pixel_func = [](void* offset, const uint64_t pixel, const unsigned bitCount)
+            for (auto channel = 0u; channel < 3; channel++)
             {
-                for (auto pixelOffset = 0u; pixelOffset < bitCount; pixelOffset += 8)
-                {
-                    *(static_cast<uint8_t*>(offset) + (pixelOffset / 8)) = static_cast<uint8_t>(pixel >> pixelOffset);
-                }
-            };
+                palette[2][channel] = static_cast<uint8_t>((2 * palette[0][channel] + palette[1][channel]) / 3);
+                palette[3][channel] = static_cast<uint8_t>((palette[0][channel] + 2 * palette[1][channel]) / 3);
+            }
+            palette[2][3] = UINT8_MAX;
+            palette[3][3] = UINT8_MAX;
         }
         else
         {
-            assert(false);
-            m_write_pixel_func = [](void* offset, uint64_t pixel, unsigned bitCount) {};
+            for (auto channel = 0u; channel < 3; channel++)
+                palette[2][channel] = static_cast<uint8_t>((palette[0][channel] + palette[1][channel]) / 2);
+            palette[2][3] = UINT8_MAX;
+            std::memset(palette[3], 0, sizeof(palette[3]));
         }
-        break;
+
+        const auto indices = static_cast<uint32_t>(block[4]) | static_cast<uint32_t>(block[5]) << 8 | static_cast<uint32_t>(block[6]) << 16
+                             | static_cast<uint32_t>(block[7]) << 24;
+        for (auto texel = 0u; texel < 16; texel++)
+            std::memcpy(&texels[texel * 4], palette[indices >> (texel * 2) & 3], sizeof(palette[0]));
     }
-}
+
+    void DecodeExplicitAlpha(const uint8_t* block, uint8_t* texels)
+    {
+        for (auto texel = 0u; texel < 16; texel++)
+        {
+            const auto alpha = block[texel / 2] >> (texel % 2 * 4) & 0xF;
+            texels[texel * 4 + 3] = static_cast<uint8_t>(alpha * 0x11);
+        }
+    }
+
+    void DecodeInterpolatedChannel(const uint8_t* block, uint8_t* texels, const unsigned channel)
+    {
+        uint8_t palette[8];
+        palette[0] = block[0];
+        palette[1] = block[1];
+
+        if (palette[0] > palette[1])
+        {
+            for (auto i = 1u; i < 7; i++)
+                palette[i + 1] = static_cast<uint8_t>(((7 - i) * palette[0] + i * palette[1]) / 7);
+        }
+        else
+        {
+            for (auto i = 1u; i < 5; i++)
+                palette[i + 1] = static_cast<uint8_t>(((5 - i) * palette[0] + i * palette[1]) / 5);
+            palette[6] = 0;
+            palette[7] = UINT8_MAX;
+        }
+
+        uint64_t indices = 0;
+        for (auto i = 0u; i < 6; i++)
+            indices |= static_cast<uint64_t>(block[2 + i]) << (i * 8);
+
+        for (auto texel = 0u; texel < 16; texel++)
+            texels[texel * 4 + channel] = palette[indices >> (texel * 3) & 7];
+    }
+
+    void FillOpaqueBlack(uint8_t* texels)
+    {
+        for (auto texel = 0u; texel < 16; texel++)
+        {
+            texels[texel * 4 + 0] = 0;
+            texels[texel * 4 + 1] = 0;
+            texels[texel * 4 + 2] = 0;
+            texels[texel * 4 + 3] = UINT8_MAX;
+        }
+    }
+
+    void DecodeBc1Block(const uint8_t* block, uint8_t* texels)
+    {
+        DecodeColorBlock(block, texels, true);
+    }
+
+    void DecodeBc2Block(const uint8_t* block, uint8_t* texels)
+    {
+        DecodeColorBlock(&block[8], texels, false);
+        DecodeExplicitAlpha(block, texels);
+    }
+
+    void DecodeBc3Block(const uint8_t* block, uint8_t* texels)
+    {
+        DecodeColorBlock(&block[8], texels, false);
+        DecodeInterpolatedChannel(block, texels, 3);
+    }
+
+    void DecodeBc4Block(const uint8_t* block, uint8_t* texels)
+    {
+        FillOpaqueBlack(texels);
+        DecodeInterpolatedChannel(block, texels, 0);
+    }
+
+    void DecodeBc5Block(const uint8_t* block, uint8_t* texels)
+    {
+        FillOpaqueBlack(texels);
+        DecodeInterpolatedChannel(block, texels, 0);
+        DecodeInterpolatedChannel(&block[8], texels, 1);
+    }
+
+    block_decoder_t GetBlockDecoder(const ImageFormatId formatId)
+    {
+        switch (formatId)
+        {
+        case ImageFormatId::BC1:
+            return DecodeBc1Block;
+        case ImageFormatId::BC2:
+            return DecodeBc2Block;
+        case ImageFormatId::BC3:
+            return DecodeBc3Block;
+        case ImageFormatId::BC4:
+            return DecodeBc4Block;
+        case ImageFormatId::BC5:
+            return DecodeBc5Block;
+        default:
+            return nullptr;
+        }
+    }
+
+    class BlockSurface
+    {
+    public:
+        const uint8_t* m_input;
+        uint8_t* m_output;
+        unsigned m_width;
+        unsigned m_height;
+        unsigned m_block_count_x;
+        unsigned m_block_size;
+    };
+
+    void DecodeBlockRows(const BlockSurface& surface,
+                         const unsigned firstBlockRow,
+                         const unsigned blockRowCount,
+                         const block_decoder_t decoder,
+                         const unsigned_conversion_kernel_t kernel,
+                         const UnsignedConversion& conversion)
+    {
+        const auto decodedRowSize = static_cast<size_t>(surface.m_block_count_x) * 4 * DECODED_BYTES_PER_PIXEL;
+        const auto outputPitch = static_cast<size_t>(surface.m_width) * conversion.m_output_bytes_per_pixel;
+        std::vector<uint8_t> decodedRows(decodedRowSize * 4);
+        uint8_t texels[16 * DECODED_BYTES_PER_PIXEL];
+
+        for (auto blockRow = firstBlockRow; blockRow < firstBlockRow + blockRowCount; blockRow++)
+        {
+            const auto* blockRowInput = &surface.m_input[static_cast<size_t>(blockRow) * surface.m_block_count_x * surface.m_block_size];
+            for (auto blockX = 0u; blockX < surface.m_block_count_x; blockX++)
+            {
+                decoder(&blockRowInput[static_cast<size_t>(blockX) * surface.m_block_size], texels);
+
+                for (auto texelRow = 0u; texelRow < 4; texelRow++)
+                {
+                    std::memcpy(&decodedRows[texelRow * decodedRowSize + blockX * 4 * DECODED_BYTES_PER_PIXEL],
+                                &texels[texelRow * 4 * DECODED_BYTES_PER_PIXEL],
+                                4 * DECODED_BYTES_PER_PIXEL);
+                }
+            }
+
+            const auto firstPixelRow = blockRow * 4;
+            const auto pixelRowCount = std::min(4u, surface.m_height - firstPixelRow);
+            for (auto texelRow = 0u; texelRow < pixelRowCount; texelRow++)
+                kernel(&decodedRows[texelRow * decodedRowSize], &surface.m_output[(firstPixelRow + texelRow) * outputPitch], surface.m_width, conversion);
+        }
+    }
+
+    unsigned MipDimension(const unsigned dimension, const int mipLevel)
+    {
+        return std::max(dimension >> mipLevel, 1u);
+    }
+} // namespace
 
 TextureConverter::TextureConverter(Texture* inputTexture, const ImageFormat* targetFormat)
+    : TextureConverter(inputTexture, targetFormat, nullptr)
+{
+}
+
+TextureConverter::TextureConverter(Texture* inputTexture, const ImageFormat* targetFormat, ThreadPool* threadPool)
     : m_input_texture(inputTexture),
       m_output_texture(nullptr),
       m_input_format(inputTexture->GetFormat()),
-      m_output_format(targetFormat)
+      m_output_format(targetFormat),
+      m_thread_pool(threadPool)
 {
 }
 
@@ -136,70 +557,99 @@ void TextureConverter::CreateOutputTexture()
     m_output_texture->Allocate();
 }
 
-void TextureConverter::ReorderUnsignedToUnsigned() const
+void TextureConverter::ConvertUnsignedToUnsigned() const
 {
     const auto* inputFormat = dynamic_cast<const ImageFormatUnsigned*>(m_input_format);
     const auto* outputFormat = dynamic_cast<const ImageFormatUnsigned*>(m_output_format);
-    const auto mipCount = m_input_texture->HasMipMaps() ? m_input_texture->GetMipMapCount() : 1;
 
-    const auto rInputMask = inputFormat->HasR() ? Mask1(inputFormat->m_r_size) << inputFormat->m_r_offset : 0;
-    const auto gInputMask = inputFormat->HasG() ? Mask1(inputFormat->m_g_size) << inputFormat->m_g_offset : 0;
-    const auto bInputMask = inputFormat->HasB() ? Mask1(inputFormat->m_b_size) << inputFormat->m_b_offset : 0;
-    const auto aInputMask = inputFormat->HasA() ? Mask1(inputFormat->m_a_size) << inputFormat->m_a_offset : 0;
-    const bool rConvert = rInputMask != 0 && outputFormat->m_r_size > 0;
-    const bool gConvert = gInputMask != 0 && outputFormat->m_g_size > 0;
-    const bool bConvert = bInputMask != 0 && outputFormat->m_b_size > 0;
-    const bool aConvert = aInputMask != 0 && outputFormat->m_a_size > 0;
+    const auto kernel = GetUnsignedConversionKernel(inputFormat, outputFormat);
+    if (!kernel)
+    {
+        // Pixels wider than 64 bit are unsupported as of now
+        assert(false);
+        return;
+    }
 
+    const auto conversion = CreateUnsignedConversion(inputFormat, outputFormat);
+    const auto mipCount = m_input_texture->HasMipMaps() ? m_input_texture->GetMipMapCount() : 1;
+
+    TaskGroup tasks(m_thread_pool);
     for (auto mipLevel = 0; mipLevel < mipCount; mipLevel++)
     {
-        const auto mipLevelSize = m_input_texture->GetSizeOfMipLevel(mipLevel) * m_input_texture->GetFaceCount();
+        // The faces of a mip level are stored right after each other
+        const auto pixelCount = m_input_texture->GetSizeOfMipLevel(mipLevel) * m_input_texture->GetFaceCount() / conversion.m_input_bytes_per_pixel;
         const auto* inputBuffer = m_input_texture->GetBufferForMipLevel(mipLevel);
         auto* outputBuffer = m_output_texture->GetBufferForMipLevel(mipLevel);
 
-        const auto inputBytePerPixel = inputFormat->m_bits_per_pixel / 8;
-        const auto outputBytePerPixel = outputFormat->m_bits_per_pixel / 8;
-
-        auto outputOffset = 0u;
-        for (auto inputOffset = 0u; inputOffset < mipLevelSize; inputOffset += inputBytePerPixel, outputOffset += outputBytePerPixel)
+        for (size_t firstPixel = 0; firstPixel < pixelCount; firstPixel += PIXELS_PER_TASK)
         {
-            uint64_t outPixel = 0;
-            const auto inPixel = m_read_pixel_func(&inputBuffer[inputOffset], inputFormat->m_bits_per_pixel);
+            const auto* input = &inputBuffer[firstPixel * conversion.m_input_bytes_per_pixel];
+            auto* output = &outputBuffer[firstPixel * conversion.m_output_bytes_per_pixel];
+            const auto taskPixelCount = std::min(PIXELS_PER_TASK, pixelCount - firstPixel);
 
-            if (rConvert)
-                outPixel |= (inPixel & rInputMask) >> inputFormat->m_r_offset << outputFormat->m_r_offset;
-            if (gConvert)
-                outPixel |= (inPixel & gInputMask) >> inputFormat->m_g_offset << outputFormat->m_g_offset;
-            if (bConvert)
-                outPixel |= (inPixel & bInputMask) >> inputFormat->m_b_offset << outputFormat->m_b_offset;
-            if (aConvert)
-                outPixel |= (inPixel & aInputMask) >> inputFormat->m_a_offset << outputFormat->m_a_offset;
-
-            m_write_pixel_func(&outputBuffer[outputOffset], outPixel, outputFormat->m_bits_per_pixel);
+            tasks.Run(
+                [kernel, input, output, taskPixelCount, &conversion]
+                {
+                    kernel(input, output, taskPixelCount, conversion);
+                });
         }
     }
+    tasks.Wait();
 }
 
-void TextureConverter::ConvertUnsignedToUnsigned()
+void TextureConverter::ConvertBlockCompressedToUnsigned() const
 {
-    const auto* inputFormat = dynamic_cast<const ImageFormatUnsigned*>(m_input_format);
+    const auto* inputFormat = dynamic_cast<const ImageFormatBlockCompressed*>(m_input_format);
     const auto* outputFormat = dynamic_cast<const ImageFormatUnsigned*>(m_output_format);
 
-    assert(inputFormat->m_bits_per_pixel <= 64);
-    assert(outputFormat->m_bits_per_pixel <= 64);
-
-    SetPixelFunctions(inputFormat->m_bits_per_pixel, outputFormat->m_bits_per_pixel);
-
-    if (inputFormat->m_r_size == outputFormat->m_r_size && inputFormat->m_g_size == outputFormat->m_g_size && inputFormat->m_b_size == outputFormat->m_b_size
-        && inputFormat->m_a_size == outputFormat->m_a_size)
+    const auto decoder = GetBlockDecoder(inputFormat->GetId());
+    const auto kernel = GetUnsignedConversionKernel(&ImageFormat::FORMAT_R8_G8_B8_A8, outputFormat);
+    if (!decoder || !kernel)
     {
-        ReorderUnsignedToUnsigned();
+        assert(false);
+        return;
     }
-    else
+
+    const auto conversion = CreateUnsignedConversion(&ImageFormat::FORMAT_R8_G8_B8_A8, outputFormat);
+    const auto mipCount = m_input_texture->HasMipMaps() ? m_input_texture->GetMipMapCount() : 1;
+    const auto faceCount = m_input_texture->GetFaceCount();
+    const auto blockSize = inputFormat->m_bits_per_block / 8;
+
+    TaskGroup tasks(m_thread_pool);
+    for (auto mipLevel = 0; mipLevel < mipCount; mipLevel++)
     {
-        // Unsupported as of now
-        assert(false);
+        const auto width = MipDimension(m_input_texture->GetWidth(), mipLevel);
+        const auto height = MipDimension(m_input_texture->GetHeight(), mipLevel);
+        const auto depth = MipDimension(m_input_texture->GetDepth(), mipLevel);
+        const auto blockCountX = (width + inputFormat->m_block_size - 1) / inputFormat->m_block_size;
+        const auto blockCountY = (height + inputFormat->m_block_size - 1) / inputFormat->m_block_size;
+        const auto inputSliceSize = static_cast<size_t>(blockCountX) * blockCountY * blockSize;
+        const auto outputSliceSize = static_cast<size_t>(width) * height * conversion.m_output_bytes_per_pixel;
+        const auto blockRowsPerTask = std::max(static_cast<unsigned>(PIXELS_PER_TASK / (static_cast<size_t>(blockCountX) * 16)), 1u);
+
+        for (auto face = 0; face < faceCount; face++)
+        {
+            const auto* inputBuffer = m_input_texture->GetBufferForMipLevel(mipLevel, face);
+            auto* outputBuffer = m_output_texture->GetBufferForMipLevel(mipLevel, face);
+
+            for (auto slice = 0u; slice < depth; slice++)
+            {
+                const BlockSurface surface{&inputBuffer[slice * inputSliceSize], &outputBuffer[slice * outputSliceSize], width, height, blockCountX, blockSize};
+
+                for (auto firstBlockRow = 0u; firstBlockRow < blockCountY; firstBlockRow += blockRowsPerTask)
+                {
+                    const auto blockRowCount = std::min(blockRowsPerTask, blockCountY - firstBlockRow);
+
+                    tasks.Run(
+                        [surface, firstBlockRow, blockRowCount, decoder, kernel, &conversion]
+                        {
+                            DecodeBlockRows(surface, firstBlockRow, blockRowCount, decoder, kernel, conversion);
+                        });
+                }
+            }
+        }
     }
+    tasks.Wait();
 }
 
 Texture* TextureConverter::Convert()
@@ -210,6 +660,10 @@ Texture* TextureConverter::Convert()
     {
         ConvertUnsignedToUnsigned();
     }
+    else if (m_input_format->GetType() == ImageFormatType::BLOCK_COMPRESSED && m_output_format->GetType() == ImageFormatType::UNSIGNED)
+    {
+        ConvertBlockCompressedToUnsigned();
+    }
     else
     {
         // Unsupported as of now
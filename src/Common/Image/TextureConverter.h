@@ -1,8 +1,7 @@
 #pragma once
 
 #include "Texture.h"
-
-#include <functional>
+#include "Utils/ThreadPool.h"
 
 class TextureConverter
 {
@@ -10,20 +9,23 @@ class TextureConverter
     Texture* m_output_texture;
     const ImageFormat* m_input_format;
     const ImageFormat* m_output_format;
-
-    std::function<uint64_t(const void* offset, unsigned bitCount)> m_read_pixel_func;
-    std::function<void(void* offset, uint64_t pixel, unsigned bitCount)> m_write_pixel_func;
-
-    static constexpr uint64_t Mask1(unsigned length);
-    void SetPixelFunctions(unsigned inBitCount, unsigned outBitCount);
+    ThreadPool* m_thread_pool;
 
     void CreateOutputTexture();
 
-    void ReorderUnsignedToUnsigned() const;
-    void ConvertUnsignedToUnsigned();
+    void ConvertUnsignedToUnsigned() const;
+    void ConvertBlockCompressedToUnsigned() const;
 
 public:
     TextureConverter(Texture* inputTexture, const ImageFormat* targetFormat);
 
+    /**
+     * \brief Creates a converter that splits the conversion into tasks across mip levels, faces and rows.
+     * \param inputTexture The texture to convert.
+     * \param targetFormat The format to convert the texture to. Must be an unsigned format.
+     * \param threadPool The thread pool to run the tasks on or \c nullptr to convert on the calling thread.
+     */
+    TextureConverter(Texture* inputTexture, const ImageFormat* targetFormat, ThreadPool* threadPool);
+
     Texture* Convert();
 };
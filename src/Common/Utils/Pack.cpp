@@ -5,6 +5,11 @@
 #include <algorithm>
 #include <cassert>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PACK_SSE2
+#include <emmintrin.h>
+#endif
+
 union PackUtil32
 {
     uint32_t u;
@@ -14,6 +19,60 @@ union PackUtil32
     uint8_t uc[4];
 };
 
+namespace
+{
+#ifdef PACK_SSE2
+    /**
+     * \brief Converts four half floats in the low 16 bits of each lane the same way HalfFloat::ToFloat does.
+     */
+    __m128 HalfToFloat4(const __m128i half)
+    {
+        const auto shiftedHalf = _mm_slli_epi32(half, 14);
+        const auto sign = _mm_and_si128(_mm_slli_epi32(half, 16), _mm_set1_epi32(static_cast<int>(0x80000000)));
+        const auto exponentAndMantissa =
+            _mm_sub_epi32(_mm_and_si128(shiftedHalf, _mm_set1_epi32(0xFFFC000)), _mm_andnot_si128(shiftedHalf, _mm_set1_epi32(0x10000000)));
+        const auto result = _mm_or_si128(sign, _mm_srli_epi32(_mm_xor_si128(exponentAndMantissa, _mm_set1_epi32(static_cast<int>(0x80000000))), 1));
+
+        return _mm_castsi128_ps(_mm_andnot_si128(_mm_cmpeq_epi32(half, _mm_setzero_si128()), result));
+    }
+
+    template<int Shift>
+    __m128 ByteToFloat4(const __m128i packed)
+    {
+        return _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(packed, Shift), _mm_set1_epi32(UINT8_MAX)));
+    }
+
+    template<int Shift>
+    __m128 UnitVecThirdToFloat4(const __m128i packed)
+    {
+        const auto value = _mm_and_si128(_mm_srli_epi32(packed, Shift), _mm_set1_epi32(0x3FF));
+        const auto bits = _mm_add_epi32(_mm_sub_epi32(value, _mm_slli_epi32(_mm_and_si128(value, _mm_set1_epi32(0x200)), 1)), _mm_set1_epi32(0x40400000));
+
+        return _mm_mul_ps(_mm_sub_ps(_mm_castsi128_ps(bits), _mm_set1_ps(3.0f)), _mm_set1_ps(8208.0312f));
+    }
+#endif
+
+    void UnpackHalfFloatPairs(const uint32_t* in, float* outLow, float* outHigh, const size_t count)
+    {
+        size_t i = 0;
+
+#ifdef PACK_SSE2
+        for (; i + 4 <= count; i += 4)
+        {
+            const auto packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&in[i]));
+            _mm_storeu_ps(&outLow[i], HalfToFloat4(_mm_and_si128(packed, _mm_set1_epi32(UINT16_MAX))));
+            _mm_storeu_ps(&outHigh[i], HalfToFloat4(_mm_srli_epi32(packed, 16)));
+        }
+#endif
+
+        for (; i < count; i++)
+        {
+            outLow[i] = HalfFloat::ToFloat(static_cast<half_float_t>(in[i] & UINT16_MAX));
+            outHigh[i] = HalfFloat::ToFloat(static_cast<half_float_t>((in[i] >> 16) & UINT16_MAX));
+        }
+    }
+} // namespace
+
 uint32_t Pack32::Vec2PackTexCoords(const float* in)
 {
     return static_cast<uint32_t>(HalfFloat::ToHalf(in[0])) << 16 | HalfFloat::ToHalf(in[1]);
@@ -81,3 +140,89 @@ void Pack32::Vec4UnpackGfxColor(uint32_t in, float* out)
     out[2] = static_cast<float>((in >> 16) & UINT8_MAX) / 255.0f;
     out[3] = static_cast<float>((in >> 24) & UINT8_MAX) / 255.0f;
 }
+
+void Pack32::Vec2UnpackTexCoordsUV(const uint32_t* in, float* outU, float* outV, const size_t count)
+{
+    UnpackHalfFloatPairs(in, outU, outV, count);
+}
+
+void Pack32::Vec2UnpackTexCoordsVU(const uint32_t* in, float* outU, float* outV, const size_t count)
+{
+    UnpackHalfFloatPairs(in, outV, outU, count);
+}
+
+void Pack32::Vec3UnpackUnitVecScaleBased(const uint32_t* in, float* outX, float* outY, float* outZ, const size_t count)
+{
+    size_t i = 0;
+
+#ifdef PACK_SSE2
+    for (; i + 4 <= count; i += 4)
+    {
+        const auto packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&in[i]));
+        const auto decodeScale = _mm_div_ps(_mm_sub_ps(ByteToFloat4<24>(packed), _mm_set1_ps(-192.0f)), _mm_set1_ps(32385.0f));
+        _mm_storeu_ps(&outX[i], _mm_mul_ps(_mm_add_ps(ByteToFloat4<0>(packed), _mm_set1_ps(-127.0f)), decodeScale));
+        _mm_storeu_ps(&outY[i], _mm_mul_ps(_mm_add_ps(ByteToFloat4<8>(packed), _mm_set1_ps(-127.0f)), decodeScale));
+        _mm_storeu_ps(&outZ[i], _mm_mul_ps(_mm_add_ps(ByteToFloat4<16>(packed), _mm_set1_ps(-127.0f)), decodeScale));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float out[3];
+        Vec3UnpackUnitVecScaleBased(in[i], out);
+        outX[i] = out[0];
+        outY[i] = out[1];
+        outZ[i] = out[2];
+    }
+}
+
+void Pack32::Vec3UnpackUnitVecThirdBased(const uint32_t* in, float* outX, float* outY, float* outZ, const size_t count)
+{
+    size_t i = 0;
+
+#ifdef PACK_SSE2
+    for (; i + 4 <= count; i += 4)
+    {
+        const auto packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&in[i]));
+        _mm_storeu_ps(&outX[i], UnitVecThirdToFloat4<0>(packed));
+        _mm_storeu_ps(&outY[i], UnitVecThirdToFloat4<10>(packed));
+        _mm_storeu_ps(&outZ[i], UnitVecThirdToFloat4<20>(packed));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float out[3];
+        Vec3UnpackUnitVecThirdBased(in[i], out);
+        outX[i] = out[0];
+        outY[i] = out[1];
+        outZ[i] = out[2];
+    }
+}
+
+void Pack32::Vec4UnpackGfxColor(const uint32_t* in, float* outR, float* outG, float* outB, float* outA, const size_t count)
+{
+    size_t i = 0;
+
+#ifdef PACK_SSE2
+    for (; i + 4 <= count; i += 4)
+    {
+        const auto packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&in[i]));
+        const auto maxValue = _mm_set1_ps(255.0f);
+        _mm_storeu_ps(&outR[i], _mm_div_ps(ByteToFloat4<0>(packed), maxValue));
+        _mm_storeu_ps(&outG[i], _mm_div_ps(ByteToFloat4<8>(packed), maxValue));
+        _mm_storeu_ps(&outB[i], _mm_div_ps(ByteToFloat4<16>(packed), maxValue));
+        _mm_storeu_ps(&outA[i], _mm_div_ps(ByteToFloat4<24>(packed), maxValue));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float out[4];
+        Vec4UnpackGfxColor(in[i], out);
+        outR[i] = out[0];
+        outG[i] = out[1];
+        outB[i] = out[2];
+        outA[i] = out[3];
+    }
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 class Pack32
@@ -15,4 +16,11 @@ public:
     static void Vec3UnpackUnitVecScaleBased(uint32_t in, float* out);
     static void Vec3UnpackUnitVecThirdBased(uint32_t in, float* out);
     static void Vec4UnpackGfxColor(uint32_t in, float* out);
+
+    // Unpack count values at once into one array per component. The results are exactly the same as the ones of unpacking each value on its own.
+    static void Vec2UnpackTexCoordsUV(const uint32_t* in, float* outU, float* outV, size_t count);
+    static void Vec2UnpackTexCoordsVU(const uint32_t* in, float* outU, float* outV, size_t count);
+    static void Vec3UnpackUnitVecScaleBased(const uint32_t* in, float* outX, float* outY, float* outZ, size_t count);
+    static void Vec3UnpackUnitVecThirdBased(const uint32_t* in, float* outX, float* outY, float* outZ, size_t count);
+    static void Vec4UnpackGfxColor(const uint32_t* in, float* outR, float* outG, float* outB, float* outA, size_t count);
 };
@@ -0,0 +1,283 @@
+#include "BuildManifest.h"
+
+#include "Crypto.h"
+
+#include <chrono>
+#include <filesystem>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    constexpr const char* MANIFEST_HEADER = "OpenAssetTools build manifest 1";
+    constexpr const char* KEY_OPTIONS = "options";
+    constexpr const char* KEY_OUTPUT = "output";
+    constexpr const char* KEY_DEPENDENCY = "dependency";
+    constexpr char SEPARATOR = '\t';
+    constexpr size_t HASH_BUFFER_SIZE = 0x10000;
+
+    std::string HexString(const uint8_t* data, const size_t size)
+    {
+        static constexpr const char* HEX_DIGITS = "0123456789abcdef";
+
+        std::string result(size * 2, '0');
+        for (auto i = 0u; i < size; i++)
+        {
+            result[i * 2] = HEX_DIGITS[data[i] >> 4];
+            result[i * 2 + 1] = HEX_DIGITS[data[i] & 0xF];
+        }
+
+        return result;
+    }
+
+    std::string HashStream(std::istream& stream)
+    {
+        const auto md5 = Crypto::CreateMD5();
+        md5->Init();
+
+        std::vector<char> buffer(HASH_BUFFER_SIZE);
+        while (stream.good())
+        {
+            stream.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            const auto readSize = stream.gcount();
+            if (readSize > 0)
+                md5->Process(buffer.data(), static_cast<size_t>(readSize));
+        }
+
+        std::vector<uint8_t> hash(md5->GetHashSize());
+        md5->Finish(hash.data());
+
+        return HexString(hash.data(), hash.size());
+    }
+
+    bool GetFileStatus(const std::string& path, int64_t& size, int64_t& lastWriteTime)
+    {
+        std::error_code ec;
+        const auto fileSize = fs::file_size(path, ec);
+        if (ec)
+            return false;
+
+        const auto fileTime = fs::last_write_time(path, ec);
+        if (ec)
+            return false;
+
+        size = static_cast<int64_t>(fileSize);
+        lastWriteTime = static_cast<int64_t>(fileTime.time_since_epoch().count());
+        return true;
+    }
+
+    std::vector<std::string> SplitLine(const std::string& line, const size_t maxFieldCount)
+    {
+        std::vector<std::string> fields;
+        size_t fieldStart = 0;
+
+        while (fields.size() + 1 < maxFieldCount)
+        {
+            const auto separatorPos = line.find(SEPARATOR, fieldStart);
+            if (separatorPos == std::string::npos)
+                break;
+
+            fields.emplace_back(line.substr(fieldStart, separatorPos - fieldStart));
+            fieldStart = separatorPos + 1;
+        }
+        fields.emplace_back(line.substr(fieldStart));
+
+        return fields;
+    }
+
+    bool IsDependencyUpToDate(const BuildDependency& dependency, ISearchPath* searchPath)
+    {
+        const auto file = searchPath->Open(dependency.m_file_name);
+        if (!dependency.m_found)
+            return !file.IsOpen();
+
+        if (!file.IsOpen())
+            return false;
+
+        if (!dependency.m_disk_path.empty() && file.m_disk_path == dependency.m_disk_path)
+        {
+            int64_t size, lastWriteTime;
+            if (GetFileStatus(file.m_disk_path, size, lastWriteTime) && size == dependency.m_size && lastWriteTime == dependency.m_last_write_time)
+                return true;
+        }
+
+        return HashStream(*file.m_stream) == dependency.m_hash;
+    }
+} // namespace
+
+BuildDependency::BuildDependency()
+    : m_type(BuildDependencyType::SOURCE),
+      m_found(false),
+      m_size(0),
+      m_last_write_time(0)
+{
+}
+
+BuildDependency::BuildDependency(const BuildDependencyType type, std::string fileName)
+    : m_type(type),
+      m_file_name(std::move(fileName)),
+      m_found(false),
+      m_size(0),
+      m_last_write_time(0)
+{
+}
+
+bool BuildManifest::Read(std::istream& stream)
+{
+    std::string line;
+    if (!std::getline(stream, line) || line != MANIFEST_HEADER)
+        return false;
+
+    while (std::getline(stream, line))
+    {
+        if (line.empty())
+            continue;
+
+        const auto fields = SplitLine(line, 8);
+        if (fields[0] == KEY_OPTIONS && fields.size() == 2)
+        {
+            m_options_hash = fields[1];
+        }
+        else if (fields[0] == KEY_OUTPUT && fields.size() == 2)
+        {
+            m_outputs.emplace_back(fields[1]);
+        }
+        else if (fields[0] == KEY_DEPENDENCY && fields.size() == 8)
+        {
+            BuildDependency dependency;
+            try
+            {
+                const auto type = std::stoi(fields[1]);
+                if (type < 0 || type >= static_cast<int>(BuildDependencyType::COUNT))
+                    return false;
+
+                dependency.m_type = static_cast<BuildDependencyType>(type);
+                dependency.m_found = fields[2] == "1";
+                dependency.m_size = std::stoll(fields[3]);
+                dependency.m_last_write_time = std::stoll(fields[4]);
+            }
+            catch (const std::exception&)
+            {
+                return false;
+            }
+
+            dependency.m_hash = fields[5];
+            dependency.m_disk_path = fields[6];
+            dependency.m_file_name = fields[7];
+            m_dependencies.emplace_back(std::move(dependency));
+        }
+        else
+            return false;
+    }
+
+    return !m_options_hash.empty();
+}
+
+void BuildManifest::Write(std::ostream& stream) const
+{
+    stream << MANIFEST_HEADER << "\n";
+    stream << KEY_OPTIONS << SEPARATOR << m_options_hash << "\n";
+
+    for (const auto& output : m_outputs)
+        stream << KEY_OUTPUT << SEPARATOR << output << "\n";
+
+    for (const auto& dependency : m_dependencies)
+    {
+        stream << KEY_DEPENDENCY << SEPARATOR << static_cast<int>(dependency.m_type) << SEPARATOR << (dependency.m_found ? 1 : 0) << SEPARATOR
+               << dependency.m_size << SEPARATOR << dependency.m_last_write_time << SEPARATOR << dependency.m_hash << SEPARATOR << dependency.m_disk_path
+               << SEPARATOR << dependency.m_file_name << "\n";
+    }
+}
+
+bool BuildManifest::IsUpToDate(const std::string& options, const build_search_paths_t& searchPaths) const
+{
+    if (m_options_hash != HashOptions(options))
+        return false;
+
+    for (const auto& output : m_outputs)
+    {
+        std::error_code ec;
+        if (!fs::is_regular_file(output, ec))
+            return false;
+    }
+
+    for (const auto& dependency : m_dependencies)
+    {
+        if (!IsDependencyUpToDate(dependency, searchPaths[static_cast<size_t>(dependency.m_type)]))
+            return false;
+    }
+
+    return true;
+}
+
+std::string BuildManifest::HashOptions(const std::string& options)
+{
+    std::istringstream stream(options);
+    return HashStream(stream);
+}
+
+BuildDependencyRecorder::BuildDependencyRecorder()
+    : m_complete(true)
+{
+}
+
+void BuildDependencyRecorder::RecordOpen(const BuildDependencyType type, const std::string& fileName, const SearchPathOpenFile& file)
+{
+    std::lock_guard lock(m_mutex);
+
+    const auto [existingDependency, isNew] = m_dependencies.try_emplace(std::make_pair(type, fileName), type, fileName);
+    if (!isNew)
+        return;
+
+    auto& dependency = existingDependency->second;
+    dependency.m_found = file.IsOpen();
+    if (!dependency.m_found)
+        return;
+
+    dependency.m_disk_path = file.m_disk_path;
+    dependency.m_size = file.m_length;
+    // When the status cannot be read the manifest cannot be created because the file looks changed
+    if (!dependency.m_disk_path.empty())
+        GetFileStatus(dependency.m_disk_path, dependency.m_size, dependency.m_last_write_time);
+}
+
+void BuildDependencyRecorder::RecordUntrackedLookup()
+{
+    std::lock_guard lock(m_mutex);
+    m_complete = false;
+}
+
+bool BuildDependencyRecorder::CreateManifest(BuildManifest& manifest, const build_search_paths_t& searchPaths)
+{
+    std::lock_guard lock(m_mutex);
+
+    if (!m_complete)
+        return false;
+
+    manifest.m_dependencies.reserve(m_dependencies.size());
+    for (const auto& [key, recordedDependency] : m_dependencies)
+    {
+        auto dependency = recordedDependency;
+
+        if (dependency.m_found)
+        {
+            const auto file = searchPaths[static_cast<size_t>(dependency.m_type)]->Open(dependency.m_file_name);
+            if (!file.IsOpen() || file.m_disk_path != dependency.m_disk_path)
+                return false;
+
+            if (!dependency.m_disk_path.empty())
+            {
+                int64_t size, lastWriteTime;
+                if (!GetFileStatus(dependency.m_disk_path, size, lastWriteTime) || size != dependency.m_size || lastWriteTime != dependency.m_last_write_time)
+                    return false;
+            }
+
+            dependency.m_hash = HashStream(*file.m_stream);
+        }
+
+        manifest.m_dependencies.emplace_back(std::move(dependency));
+    }
+
+    return true;
+}
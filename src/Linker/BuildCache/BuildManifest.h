@@ -0,0 +1,97 @@
+#pragma once
+
+#include "SearchPath/ISearchPath.h"
+#include "Utils/ClassUtils.h"
+
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+enum class BuildDependencyType
+{
+    SOURCE,
+    ASSET,
+    GDT,
+
+    COUNT
+};
+
+typedef std::array<ISearchPath*, static_cast<size_t>(BuildDependencyType::COUNT)> build_search_paths_t;
+
+class BuildDependency
+{
+public:
+    BuildDependencyType m_type;
+    std::string m_file_name;
+    bool m_found;
+
+    /**
+     * \brief The path of the file on disk or empty if it was found inside of a container.
+     */
+    std::string m_disk_path;
+    int64_t m_size;
+    int64_t m_last_write_time;
+    std::string m_hash;
+
+    BuildDependency();
+    BuildDependency(BuildDependencyType type, std::string fileName);
+};
+
+/**
+ * \brief Lists everything that a target was built from to be able to tell whether building it again would produce the same result.
+ */
+class BuildManifest
+{
+public:
+    std::string m_options_hash;
+    std::vector<std::string> m_outputs;
+    std::vector<BuildDependency> m_dependencies;
+
+    bool Read(std::istream& stream);
+    void Write(std::ostream& stream) const;
+
+    /**
+     * \brief Checks whether the options and all dependencies are the same as when the manifest was created and all outputs still exist.
+     * Dependencies that resolve to the same file on disk with the same size and modification time are not hashed again.
+     * \param options The options that the target would be built with now.
+     * \param searchPaths The search paths to look up the dependencies with.
+     * \return \c true if building the target again would produce the same result.
+     */
+    _NODISCARD bool IsUpToDate(const std::string& options, const build_search_paths_t& searchPaths) const;
+
+    _NODISCARD static std::string HashOptions(const std::string& options);
+};
+
+/**
+ * \brief Collects all files that were looked up while building a target. Can be used from multiple threads.
+ */
+class BuildDependencyRecorder
+{
+    std::mutex m_mutex;
+    std::map<std::pair<BuildDependencyType, std::string>, BuildDependency> m_dependencies;
+    bool m_complete;
+
+public:
+    BuildDependencyRecorder();
+
+    void RecordOpen(BuildDependencyType type, const std::string& fileName, const SearchPathOpenFile& file);
+
+    /**
+     * \brief Marks the recorded dependencies as incomplete because files were looked up in a way that cannot be recorded, like listing directories.
+     */
+    void RecordUntrackedLookup();
+
+    /**
+     * \brief Creates a manifest from all recorded dependencies and hashes their current contents.
+     * \param manifest The manifest to fill.
+     * \param searchPaths The search paths that the dependencies were looked up with.
+     * \return \c false if the dependencies are incomplete or a file changed since it was opened during the build.
+     */
+    bool CreateManifest(BuildManifest& manifest, const build_search_paths_t& searchPaths);
+};
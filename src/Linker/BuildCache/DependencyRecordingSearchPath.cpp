@@ -0,0 +1,38 @@
+#include "DependencyRecordingSearchPath.h"
+
+DependencyRecordingSearchPath::DependencyRecordingSearchPath(ISearchPath* searchPath, const BuildDependencyType type, BuildDependencyRecorder* recorder)
+    : m_search_path(searchPath),
+      m_type(type),
+      m_recorder(recorder)
+{
+}
+
+SearchPathOpenFile DependencyRecordingSearchPath::Open(const std::string& fileName)
+{
+    auto file = m_search_path->Open(fileName);
+    m_recorder->RecordOpen(m_type, fileName, file);
+
+    return file;
+}
+
+std::string DependencyRecordingSearchPath::GetPath()
+{
+    return m_search_path->GetPath();
+}
+
+void DependencyRecordingSearchPath::Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback)
+{
+    m_recorder->RecordUntrackedLookup();
+    m_search_path->Find(options, callback);
+}
+
+bool DependencyRecordingSearchPath::ListIndexedFiles(const std::function<void(const std::string&)>& callback)
+{
+    m_recorder->RecordUntrackedLookup();
+    return m_search_path->ListIndexedFiles(callback);
+}
+
+void DependencyRecordingSearchPath::InvalidateIndex()
+{
+    m_search_path->InvalidateIndex();
+}
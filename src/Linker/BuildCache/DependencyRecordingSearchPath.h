@@ -0,0 +1,23 @@
+#pragma once
+
+#include "BuildManifest.h"
+#include "SearchPath/ISearchPath.h"
+
+/**
+ * \brief Forwards all lookups to another search path and records every file that is opened as a dependency of the target that is being built.
+ */
+class DependencyRecordingSearchPath final : public ISearchPath
+{
+    ISearchPath* m_search_path;
+    BuildDependencyType m_type;
+    BuildDependencyRecorder* m_recorder;
+
+public:
+    DependencyRecordingSearchPath(ISearchPath* searchPath, BuildDependencyType type, BuildDependencyRecorder* recorder);
+
+    SearchPathOpenFile Open(const std::string& fileName) override;
+    std::string GetPath() override;
+    void Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback) override;
+    bool ListIndexedFiles(const std::function<void(const std::string&)>& callback) override;
+    void InvalidateIndex() override;
+};
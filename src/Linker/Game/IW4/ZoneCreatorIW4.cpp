@@ -50,7 +50,8 @@ bool ZoneCreator::CreateIgnoredAssetMap(const ZoneCreationContext& context, std:
 
 void ZoneCreator::CreateZoneAssetPools(Zone* zone) const
 {
-    zone->m_pools = std::make_unique<GameAssetPoolIW4>(zone, zone->m_priority);
+    // Other zones must not be able to use assets of a zone that is still being built, since targets can be built concurrently
+    zone->m_pools = std::make_unique<GameAssetPoolIW4>(zone, zone->m_priority, false);
 
     for (auto assetType = 0; assetType < ASSET_TYPE_COUNT; assetType++)
         zone->m_pools->InitPoolDynamic(assetType);
@@ -74,10 +75,21 @@ std::unique_ptr<Zone> ZoneCreator::CreateZoneForDefinition(ZoneCreationContext&
         context.m_ignored_assets.m_entries.emplace_back(assetEntry.m_asset_type, assetEntry.m_asset_name, assetEntry.m_is_reference);
     }
 
-    const auto assetLoadingContext = std::make_unique<AssetLoadingContext>(zone.get(), context.m_asset_search_path, CreateGdtList(context));
+    const auto assetLoadingContext =
+        std::make_unique<AssetLoadingContext>(zone.get(), context.m_asset_search_path, CreateGdtList(context), context.m_loading_thread_pool);
+    assetLoadingContext->m_output_folder = context.m_output_folder;
+    assetLoadingContext->m_output_files = &context.m_output_files;
     if (!CreateIgnoredAssetMap(context, assetLoadingContext->m_ignored_asset_map))
         return nullptr;
 
+    // Files of assets are read and parsed ahead on the thread pool while assets are added to the zone in order
+    for (const auto& assetEntry : context.m_definition->m_assets)
+    {
+        const auto foundAssetTypeEntry = m_asset_types_by_name.find(assetEntry.m_asset_type);
+        if (foundAssetTypeEntry != m_asset_types_by_name.end())
+            ObjLoading::PrepareAssetForZone(assetLoadingContext.get(), foundAssetTypeEntry->second, assetEntry.m_asset_name);
+    }
+
     for (const auto& assetEntry : context.m_definition->m_assets)
     {
         const auto foundAssetTypeEntry = m_asset_types_by_name.find(assetEntry.m_asset_type);
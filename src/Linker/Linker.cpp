@@ -1,15 +1,18 @@
 #include "Linker.h"
 
+#include "BuildCache/BuildManifest.h"
+#include "BuildCache/DependencyRecordingSearchPath.h"
 #include "Game/IW3/ZoneCreatorIW3.h"
 #include "Game/IW4/ZoneCreatorIW4.h"
 #include "Game/IW5/ZoneCreatorIW5.h"
 #include "Game/T5/ZoneCreatorT5.h"
 #include "Game/T6/ZoneCreatorT6.h"
+#include "GitVersion.h"
+#include "Image/IwiFileCache.h"
 #include "LinkerArgs.h"
 #include "LinkerSearchPaths.h"
 #include "ObjContainer/IPak/IPakWriter.h"
 #include "ObjContainer/IWD/IWD.h"
-#include "ObjContainer/SoundBank/SoundBankWriter.h"
 #include "ObjLoading.h"
 #include "ObjWriting.h"
 #include "SearchPath/SearchPaths.h"
@@ -17,6 +20,8 @@
 #include "Utils/ClassUtils.h"
 #include "Utils/ObjFileStream.h"
 #include "Utils/StringUtils.h"
+#include "Utils/TaskGroup.h"
+#include "Utils/ThreadPool.h"
 #include "Zone/AssetList/AssetList.h"
 #include "Zone/AssetList/AssetListStream.h"
 #include "Zone/Definition/ZoneDefinitionStream.h"
@@ -25,11 +30,16 @@
 #include "ZoneLoading.h"
 #include "ZoneWriting.h"
 
+#include <atomic>
 #include <deque>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <map>
+#include <mutex>
 #include <regex>
 #include <set>
+#include <sstream>
 
 namespace fs = std::filesystem;
 
@@ -58,6 +68,9 @@ constexpr const char* PROJECT_TYPE_NAMES[static_cast<unsigned>(ProjectType::MAX)
 
 class LinkerImpl final : public Linker
 {
+    static constexpr const char* BUILD_CACHE_FOLDER = "build_cache";
+    static constexpr const char* BUILD_MANIFEST_EXTENSION = ".deps";
+
     static constexpr const char* METADATA_GAME = "game";
     static constexpr const char* METADATA_GDT = "gdt";
     static constexpr const char* METADATA_NAME = "name";
@@ -67,6 +80,22 @@ class LinkerImpl final : public Linker
     LinkerSearchPaths m_search_paths;
     std::vector<std::unique_ptr<Zone>> m_loaded_zones;
 
+    // Only set when building multiple targets concurrently
+    std::unique_ptr<ThreadPool> m_thread_pool;
+
+    // Only set when asset files are read ahead of loading them, shared by all targets
+    std::unique_ptr<ThreadPool> m_loading_thread_pool;
+
+    // Shared by all fastfiles that are deflated in parallel and all ipaks and sound banks that are written
+    std::unique_ptr<ThreadPool> m_compression_thread_pool;
+
+    // Shares probed and hashed images between the targets of this run
+    IwiFileCache m_iwi_file_cache;
+
+    // Targets can be requested more than once at the same time, but must not be built concurrently since they write to the same files
+    std::mutex m_target_mutexes_lock;
+    std::map<std::string, std::unique_ptr<std::mutex>> m_target_mutexes;
+
     bool IncludeAdditionalZoneDefinitions(const std::string& initialFileName, ZoneDefinition& zoneDefinition, ISearchPath* sourceSearchPath) const
     {
         std::set<std::string> sourceNames;
@@ -124,7 +153,7 @@ class LinkerImpl final : public Linker
 
             if (assetListStream.IsOpen())
             {
-                const AssetListInputStream stream(*assetListStream.m_stream);
+                AssetListInputStream stream(*assetListStream.m_stream);
                 AssetListEntry entry;
 
                 while (stream.NextEntry(entry))
@@ -365,13 +394,17 @@ class LinkerImpl final : public Linker
         return true;
     }
 
-    std::unique_ptr<Zone> CreateZoneForDefinition(const std::string& targetName,
+    std::unique_ptr<Zone> CreateZoneForDefinition(const std::string& projectName,
+                                                  const std::string& targetName,
                                                   ZoneDefinition& zoneDefinition,
                                                   ISearchPath* assetSearchPath,
                                                   ISearchPath* gdtSearchPath,
-                                                  ISearchPath* sourceSearchPath) const
+                                                  ISearchPath* sourceSearchPath,
+                                                  std::vector<std::string>& outputFiles) const
     {
         const auto context = std::make_unique<ZoneCreationContext>(assetSearchPath, &zoneDefinition);
+        context->m_output_folder = fs::path(m_args.GetOutputFolderPathForProject(projectName));
+        context->m_loading_thread_pool = m_loading_thread_pool.get();
         if (!ProcessZoneDefinitionIgnores(targetName, *context, sourceSearchPath))
             return nullptr;
         if (!GetGameNameFromZoneDefinition(context->m_game_name, targetName, zoneDefinition))
@@ -382,13 +415,19 @@ class LinkerImpl final : public Linker
         for (const auto* assetLoader : ZONE_CREATORS)
         {
             if (assetLoader->SupportsGame(context->m_game_name))
-                return assetLoader->CreateZoneForDefinition(*context);
+            {
+                auto zone = assetLoader->CreateZoneForDefinition(*context);
+                for (const auto& outputFile : context->m_output_files)
+                    outputFiles.emplace_back(outputFile.string());
+
+                return zone;
+            }
         }
 
         return nullptr;
     }
 
-    bool WriteZoneToFile(const std::string& projectName, Zone* zone) const
+    bool WriteZoneToFile(const std::string& projectName, Zone* zone, std::vector<std::string>& outputFiles) const
     {
         const fs::path zoneFolderPath(m_args.GetOutputFolderPathForProject(projectName));
         auto zoneFilePath(zoneFolderPath);
@@ -399,6 +438,7 @@ class LinkerImpl final : public Linker
         std::ofstream stream(zoneFilePath, std::fstream::out | std::fstream::binary);
         if (!stream.is_open())
             return false;
+        outputFiles.emplace_back(zoneFilePath.string());
 
         if (!ZoneWriting::WriteZone(stream, zone))
         {
@@ -416,21 +456,24 @@ class LinkerImpl final : public Linker
     bool BuildFastFile(const std::string& projectName,
                        const std::string& targetName,
                        ZoneDefinition& zoneDefinition,
-                       SearchPaths& assetSearchPaths,
-                       SearchPaths& gdtSearchPaths,
-                       SearchPaths& sourceSearchPaths) const
+                       ISearchPath& assetSearchPaths,
+                       ISearchPath& gdtSearchPaths,
+                       ISearchPath& sourceSearchPaths,
+                       std::vector<std::string>& outputFiles) const
     {
-        SoundBankWriter::OutputPath = fs::path(m_args.GetOutputFolderPathForProject(projectName));
-
-        const auto zone = CreateZoneForDefinition(targetName, zoneDefinition, &assetSearchPaths, &gdtSearchPaths, &sourceSearchPaths);
+        const auto zone =
+            CreateZoneForDefinition(projectName, targetName, zoneDefinition, &assetSearchPaths, &gdtSearchPaths, &sourceSearchPaths, outputFiles);
         auto result = zone != nullptr;
         if (zone)
-            result = WriteZoneToFile(projectName, zone.get());
+            result = WriteZoneToFile(projectName, zone.get(), outputFiles);
 
         return result;
     }
 
-    bool BuildIPak(const std::string& projectName, const ZoneDefinition& zoneDefinition, SearchPaths& assetSearchPaths) const
+    bool BuildIPak(const std::string& projectName,
+                   const ZoneDefinition& zoneDefinition,
+                   ISearchPath& assetSearchPaths,
+                   std::vector<std::string>& outputFiles) const
     {
         const fs::path ipakFolderPath(m_args.GetOutputFolderPathForProject(projectName));
         auto ipakFilePath(ipakFolderPath);
@@ -441,6 +484,7 @@ class LinkerImpl final : public Linker
         std::ofstream stream(ipakFilePath, std::fstream::out | std::fstream::binary);
         if (!stream.is_open())
             return false;
+        outputFiles.emplace_back(ipakFilePath.string());
 
         const auto ipakWriter = IPakWriter::Create(stream, &assetSearchPaths);
         for (const auto& assetEntry : zoneDefinition.m_assets)
@@ -465,27 +509,286 @@ class LinkerImpl final : public Linker
         return true;
     }
 
-    bool BuildReferencedTargets(const std::string& projectName, const std::string& targetName, const ZoneDefinition& zoneDefinition)
+    std::string GetBuildOptions(const ProjectType projectType) const
+    {
+        std::ostringstream options;
+        options << GIT_VERSION << "\n";
+        options << PROJECT_TYPE_NAMES[static_cast<unsigned>(projectType)] << "\n";
+        options << ObjLoading::Configuration.MenuPermissiveParsing << ObjLoading::Configuration.MenuNoOptimization << "\n";
+        if (ZoneWriting::Configuration.CompressionLevel)
+            options << *ZoneWriting::Configuration.CompressionLevel;
+        options << "\n";
+
+        for (const auto& zonePath : m_args.m_zones_to_load)
+        {
+            std::error_code ec;
+            const auto zoneSize = fs::file_size(zonePath, ec);
+            const auto zoneWriteTime = fs::last_write_time(zonePath, ec);
+            options << zonePath << " " << zoneSize << " " << zoneWriteTime.time_since_epoch().count() << "\n";
+        }
+
+        return options.str();
+    }
+
+    fs::path GetBuildManifestPath(const std::string& projectName, const std::string& targetName) const
+    {
+        auto manifestPath = fs::path(m_args.GetOutputFolderPathForProject(projectName));
+        manifestPath.append(BUILD_CACHE_FOLDER);
+        manifestPath.append(targetName + BUILD_MANIFEST_EXTENSION);
+
+        return manifestPath;
+    }
+
+    bool IsTargetUpToDate(const fs::path& manifestPath, const std::string& buildOptions, const build_search_paths_t& searchPaths) const
+    {
+        if (m_args.m_rebuild)
+            return false;
+
+        std::ifstream stream(manifestPath, std::fstream::in | std::fstream::binary);
+        if (!stream.is_open())
+            return false;
+
+        BuildManifest manifest;
+        if (!manifest.Read(stream))
+            return false;
+
+        return manifest.IsUpToDate(buildOptions, searchPaths);
+    }
+
+    void WriteBuildManifest(const fs::path& manifestPath,
+                            const std::string& buildOptions,
+                            const std::vector<std::string>& outputFiles,
+                            BuildDependencyRecorder& dependencies,
+                            const build_search_paths_t& searchPaths) const
+    {
+        BuildManifest manifest;
+        manifest.m_options_hash = BuildManifest::HashOptions(buildOptions);
+        manifest.m_outputs = outputFiles;
+
+        if (!dependencies.CreateManifest(manifest, searchPaths))
+        {
+            if (m_args.m_verbose)
+                std::cout << "Inputs changed while building, not caching build result\n";
+            return;
+        }
+
+        fs::create_directories(manifestPath.parent_path());
+
+        std::ofstream stream(manifestPath, std::fstream::out | std::fstream::binary);
+        if (!stream.is_open())
+        {
+            std::cerr << "Failed to write build manifest \"" << manifestPath.string() << "\"\n";
+            return;
+        }
+
+        manifest.Write(stream);
+    }
+
+    static fs::path NormalizeFolderPath(const std::string& folderPath)
     {
-        return std::ranges::all_of(zoneDefinition.m_targets_to_build,
-                                   [this, &projectName, &targetName](const std::string& buildTargetName)
+        auto normalizedPath = fs::absolute(folderPath).lexically_normal();
+        if (!normalizedPath.has_filename())
+            normalizedPath = normalizedPath.parent_path();
+
+        return normalizedPath;
+    }
+
+    /**
+     * \brief Checks whether files inside of a folder can be found through a search path, which is the case when either one contains the other.
+     * Parts of the search path that depend on the game match any folder since the games of referenced targets are only known when building them.
+     */
+    static bool IsFolderInSearchPath(const fs::path& folderPath, const fs::path& searchPath)
+    {
+        auto folderPathPart = folderPath.begin();
+        auto searchPathPart = searchPath.begin();
+        for (; folderPathPart != folderPath.end() && searchPathPart != searchPath.end(); ++folderPathPart, ++searchPathPart)
+        {
+            if (*folderPathPart != *searchPathPart && searchPathPart->string().find(LinkerArgs::PATTERN_GAME) == std::string::npos)
+                return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * \brief Referenced targets are all built into the output folder of their project.
+     * If that folder is in the search paths of the project, targets can find the output of the targets that are built before them.
+     */
+    bool IsOutputFolderInSearchPaths(const std::string& projectName) const
+    {
+        std::set<std::string> searchPaths;
+        searchPaths.merge(m_args.GetProjectIndependentAssetSearchPaths());
+        searchPaths.merge(m_args.GetProjectIndependentGdtSearchPaths());
+        searchPaths.merge(m_args.GetProjectIndependentSourceSearchPaths());
+        searchPaths.merge(m_args.GetAssetSearchPathsForProject(LinkerArgs::PATTERN_GAME, projectName));
+        searchPaths.merge(m_args.GetGdtSearchPathsForProject(LinkerArgs::PATTERN_GAME, projectName));
+        searchPaths.merge(m_args.GetSourceSearchPathsForProject(projectName));
+
+        const auto outputFolderPath = NormalizeFolderPath(m_args.GetOutputFolderPathForProject(projectName));
+        return std::ranges::any_of(searchPaths,
+                                   [&outputFolderPath](const std::string& searchPath)
                                    {
-                                       if (buildTargetName == targetName)
-                                       {
-                                           std::cerr << "Cannot build target with same name: \"" << targetName << "\"\n";
-                                           return false;
-                                       }
-
-                                       std::cout << "Building referenced target \"" << buildTargetName << "\"\n";
-                                       return BuildProject(projectName, buildTargetName);
+                                       return IsFolderInSearchPath(outputFolderPath, NormalizeFolderPath(searchPath));
                                    });
     }
 
+    static bool HasCyclicBuildOrder(const std::vector<std::vector<size_t>>& dependentTargets, std::vector<size_t> remainingDependencyCounts)
+    {
+        std::vector<size_t> readyTargets;
+        for (auto targetIndex = 0u; targetIndex < remainingDependencyCounts.size(); targetIndex++)
+        {
+            if (remainingDependencyCounts[targetIndex] == 0u)
+                readyTargets.emplace_back(targetIndex);
+        }
+
+        auto orderedTargetCount = 0u;
+        while (!readyTargets.empty())
+        {
+            const auto targetIndex = readyTargets.back();
+            readyTargets.pop_back();
+            orderedTargetCount++;
+
+            for (const auto dependentIndex : dependentTargets[targetIndex])
+            {
+                if (--remainingDependencyCounts[dependentIndex] == 0u)
+                    readyTargets.emplace_back(dependentIndex);
+            }
+        }
+
+        return orderedTargetCount < remainingDependencyCounts.size();
+    }
+
+    bool BuildReferencedTargets(const std::string& projectName, const std::string& targetName, const ZoneDefinition& zoneDefinition)
+    {
+        const auto& targetsToBuild = zoneDefinition.m_targets_to_build;
+        const auto targetCount = targetsToBuild.size();
+        if (targetCount == 0u)
+            return true;
+
+        // For each target the indices of the targets that can only be built after it and the amount of targets it still needs to wait for
+        std::vector<std::vector<size_t>> dependentTargets(targetCount);
+        std::vector<size_t> remainingDependencyCounts(targetCount, 0u);
+
+        // Targets that can find the output of other targets are built in the order they are listed in since later ones may rely on the output of earlier ones
+        const auto buildInListedOrder = targetCount > 1u && IsOutputFolderInSearchPaths(projectName);
+
+        for (auto targetIndex = 0u; targetIndex < targetCount; targetIndex++)
+        {
+            const auto& buildTarget = targetsToBuild[targetIndex];
+            if (buildTarget.m_name == targetName)
+            {
+                std::cerr << "Cannot build target with same name: \"" << targetName << "\"\n";
+                return false;
+            }
+
+            if (buildInListedOrder && targetIndex > 0u)
+            {
+                dependentTargets[targetIndex - 1u].emplace_back(targetIndex);
+                remainingDependencyCounts[targetIndex]++;
+            }
+
+            for (const auto& buildAfterName : buildTarget.m_build_after)
+            {
+                auto foundBuildAfterTarget = false;
+                for (auto otherIndex = 0u; otherIndex < targetCount; otherIndex++)
+                {
+                    if (otherIndex == targetIndex || targetsToBuild[otherIndex].m_name != buildAfterName)
+                        continue;
+
+                    dependentTargets[otherIndex].emplace_back(targetIndex);
+                    remainingDependencyCounts[targetIndex]++;
+                    foundBuildAfterTarget = true;
+                }
+
+                if (!foundBuildAfterTarget)
+                {
+                    std::cerr << "Target \"" << buildTarget.m_name << "\" is built after \"" << buildAfterName
+                              << "\" which is not built by target \"" << targetName << "\"\n";
+                    return false;
+                }
+            }
+        }
+
+        if (HasCyclicBuildOrder(dependentTargets, remainingDependencyCounts))
+        {
+            std::cerr << "Targets referenced by target \"" << targetName << "\" are built after each other in a cycle\n";
+            return false;
+        }
+
+        // Targets that do not depend on each other are built concurrently, each target starts the ones that only waited for it when it is done
+        std::mutex dependencyLock;
+        std::atomic_bool failed = false;
+        TaskGroup referencedTargets(m_thread_pool.get());
+
+        std::function<void(size_t)> startTarget;
+        startTarget = [&](const size_t targetIndex)
+        {
+            referencedTargets.Run(
+                [&, targetIndex]
+                {
+                    // Once a target failed, no more targets are started
+                    if (failed)
+                        return;
+
+                    const auto& buildTargetName = targetsToBuild[targetIndex].m_name;
+                    std::cout << "Building referenced target \"" << buildTargetName << "\"\n";
+                    if (!BuildProject(projectName, buildTargetName))
+                    {
+                        failed = true;
+                        return;
+                    }
+
+                    std::vector<size_t> readyTargets;
+                    {
+                        std::lock_guard lock(dependencyLock);
+                        for (const auto dependentIndex : dependentTargets[targetIndex])
+                        {
+                            if (--remainingDependencyCounts[dependentIndex] == 0u)
+                                readyTargets.emplace_back(dependentIndex);
+                        }
+                    }
+
+                    for (const auto readyIndex : readyTargets)
+                        startTarget(readyIndex);
+                });
+        };
+
+        // Dependency counts change as soon as the first target is started, so the targets to start with are collected beforehand
+        std::vector<size_t> initialTargets;
+        for (auto targetIndex = 0u; targetIndex < targetCount; targetIndex++)
+        {
+            if (remainingDependencyCounts[targetIndex] == 0u)
+                initialTargets.emplace_back(targetIndex);
+        }
+
+        for (const auto targetIndex : initialTargets)
+            startTarget(targetIndex);
+
+        referencedTargets.Wait();
+
+        return !failed;
+    }
+
+    std::mutex& GetTargetMutex(const std::string& projectName, const std::string& targetName)
+    {
+        std::lock_guard lock(m_target_mutexes_lock);
+
+        auto& targetMutex = m_target_mutexes[projectName + '/' + targetName];
+        if (!targetMutex)
+            targetMutex = std::make_unique<std::mutex>();
+
+        return *targetMutex;
+    }
+
     bool BuildProject(const std::string& projectName, const std::string& targetName)
     {
+        std::unique_lock targetLock(GetTargetMutex(projectName, targetName));
+
         auto sourceSearchPaths = m_search_paths.GetSourceSearchPathsForProject(projectName);
+        BuildDependencyRecorder dependencies;
+        DependencyRecordingSearchPath recordingSourceSearchPaths(&sourceSearchPaths, BuildDependencyType::SOURCE, &dependencies);
 
-        const auto zoneDefinition = ReadZoneDefinition(targetName, &sourceSearchPaths);
+        const auto zoneDefinition = ReadZoneDefinition(targetName, &recordingSourceSearchPaths);
         if (!zoneDefinition)
             return false;
 
@@ -494,6 +797,7 @@ class LinkerImpl final : public Linker
             return false;
 
         auto result = true;
+        std::vector<std::unique_ptr<ISearchPath>> loadedSearchPaths;
         if (projectType != ProjectType::NONE)
         {
             std::string gameName;
@@ -501,27 +805,55 @@ class LinkerImpl final : public Linker
                 return false;
             utils::MakeStringLowerCase(gameName);
 
-            auto assetSearchPaths = m_search_paths.GetAssetSearchPathsForProject(gameName, projectName);
+            auto assetSearchPaths = m_search_paths.GetAssetSearchPathsForProject(gameName, projectName, loadedSearchPaths);
             auto gdtSearchPaths = m_search_paths.GetGdtSearchPathsForProject(gameName, projectName);
+            DependencyRecordingSearchPath recordingAssetSearchPaths(&assetSearchPaths, BuildDependencyType::ASSET, &dependencies);
+            DependencyRecordingSearchPath recordingGdtSearchPaths(&gdtSearchPaths, BuildDependencyType::GDT, &dependencies);
+
+            const build_search_paths_t buildSearchPaths{&sourceSearchPaths, &assetSearchPaths, &gdtSearchPaths};
+            const auto buildOptions = GetBuildOptions(projectType);
+            const auto manifestPath = GetBuildManifestPath(projectName, targetName);
 
-            switch (projectType)
+            if (IsTargetUpToDate(manifestPath, buildOptions, buildSearchPaths))
+            {
+                std::cout << "Target \"" << targetName << "\" is up to date\n";
+            }
+            else
             {
-            case ProjectType::FASTFILE:
-                result = BuildFastFile(projectName, targetName, *zoneDefinition, assetSearchPaths, gdtSearchPaths, sourceSearchPaths);
-                break;
-
-            case ProjectType::IPAK:
-                result = BuildIPak(projectName, *zoneDefinition, assetSearchPaths);
-                break;
-
-            default:
-                assert(false);
-                result = false;
-                break;
+                // A failed build must not leave a manifest that matches its inputs behind
+                std::error_code ec;
+                fs::remove(manifestPath, ec);
+
+                std::vector<std::string> outputFiles;
+                switch (projectType)
+                {
+                case ProjectType::FASTFILE:
+                    result = BuildFastFile(projectName,
+                                           targetName,
+                                           *zoneDefinition,
+                                           recordingAssetSearchPaths,
+                                           recordingGdtSearchPaths,
+                                           recordingSourceSearchPaths,
+                                           outputFiles);
+                    break;
+
+                case ProjectType::IPAK:
+                    result = BuildIPak(projectName, *zoneDefinition, recordingAssetSearchPaths, outputFiles);
+                    break;
+
+                default:
+                    assert(false);
+                    result = false;
+                    break;
+                }
+
+                if (result)
+                    WriteBuildManifest(manifestPath, buildOptions, outputFiles, dependencies, buildSearchPaths);
             }
         }
 
-        m_search_paths.UnloadProjectSpecificSearchPaths();
+        m_search_paths.UnloadProjectSpecificSearchPaths(loadedSearchPaths);
+        targetLock.unlock();
 
         result = result && BuildReferencedTargets(projectName, targetName, *zoneDefinition);
 
@@ -628,27 +960,50 @@ public:
         if (!LoadZones())
             return false;
 
-        auto result = true;
-        for (const auto& projectSpecifier : m_args.m_project_specifiers_to_build)
-        {
-            std::string projectName;
-            std::string targetName;
-            if (!GetProjectAndTargetFromProjectSpecifier(projectSpecifier, projectName, targetName))
-            {
-                result = false;
-                break;
-            }
+        // The calling thread helps building while waiting, so it counts as one of the jobs
+        if (m_args.m_job_count > 1)
+            m_thread_pool = std::make_unique<ThreadPool>(m_args.m_job_count - 1);
+        if (m_args.m_loading_thread_count > 1)
+            m_loading_thread_pool = std::make_unique<ThreadPool>(m_args.m_loading_thread_count);
 
-            if (!BuildProject(projectName, targetName))
+        m_compression_thread_pool = std::make_unique<ThreadPool>(ThreadPool::DefaultThreadCount());
+        ZoneWriting::Configuration.CompressionThreadPool = m_compression_thread_pool.get();
+        ObjWriting::Configuration.IPakThreadPool = m_compression_thread_pool.get();
+        ObjLoading::Configuration.SoundBankThreadPool = m_compression_thread_pool.get();
+        ObjLoading::Configuration.ImageFileCache = &m_iwi_file_cache;
+
+        std::atomic_bool failed = false;
+        {
+            TaskGroup projects(m_thread_pool.get());
+            for (const auto& projectSpecifier : m_args.m_project_specifiers_to_build)
             {
-                result = false;
-                break;
+                projects.Run(
+                    [this, &projectSpecifier, &failed]
+                    {
+                        if (failed)
+                            return;
+
+                        std::string projectName;
+                        std::string targetName;
+                        if (!GetProjectAndTargetFromProjectSpecifier(projectSpecifier, projectName, targetName))
+                            failed = true;
+                        else if (!BuildProject(projectName, targetName))
+                            failed = true;
+                    });
             }
+            projects.Wait();
         }
 
+        m_thread_pool.reset();
+        m_loading_thread_pool.reset();
+        ZoneWriting::Configuration.CompressionThreadPool = nullptr;
+        ObjWriting::Configuration.IPakThreadPool = nullptr;
+        ObjLoading::Configuration.SoundBankThreadPool = nullptr;
+        ObjLoading::Configuration.ImageFileCache = nullptr;
+        m_compression_thread_pool.reset();
         UnloadZones();
 
-        return result;
+        return !failed;
     }
 };
 
@@ -5,7 +5,9 @@
 #include "ObjWriting.h"
 #include "Utils/Arguments/UsageInformation.h"
 #include "Utils/FileUtils.h"
+#include "ZoneWriting.h"
 
+#include <cstdlib>
 #include <filesystem>
 #include <iostream>
 #include <regex>
@@ -79,6 +81,44 @@ const CommandLineOption* const OPTION_LOAD =
     .Reusable()
     .Build();
 
+const CommandLineOption* const OPTION_INDEX_SEARCH_PATHS =
+    CommandLineOption::Builder::Create()
+    .WithLongName("index-search-paths")
+    .WithDescription("Indexes the files of all search path folders once instead of probing the disk for every file that is looked up. "
+                        "Files that are added to search path folders while building a project are not found.")
+    .Build();
+
+const CommandLineOption* const OPTION_REBUILD =
+    CommandLineOption::Builder::Create()
+    .WithLongName("rebuild")
+    .WithDescription("Builds all targets even if nothing that they are built from changed since they were last built.")
+    .Build();
+
+const CommandLineOption* const OPTION_JOBS =
+    CommandLineOption::Builder::Create()
+    .WithShortName("j")
+    .WithLongName("jobs")
+    .WithDescription("Specifies the amount of project specifiers and referenced targets that are built concurrently. Referenced targets are built in "
+                        "order when the output folder is in the search paths or when they are declared with \"build,<target>,after,<otherTarget>\". "
+                        "Defaults to 1.")
+    .WithParameter("jobCount")
+    .Build();
+
+const CommandLineOption* const OPTION_LOADING_THREADS =
+    CommandLineOption::Builder::Create()
+    .WithLongName("loading-threads")
+    .WithDescription("Specifies the amount of threads that read and parse asset files ahead of adding the assets to a zone. Defaults to 1.")
+    .WithParameter("threadCount")
+    .Build();
+
+const CommandLineOption* const OPTION_COMPRESSION_LEVEL =
+    CommandLineOption::Builder::Create()
+    .WithLongName("compression-level")
+    .WithDescription("Specifies the compression level from 0 to 9 that fastfiles are compressed with. Lower levels build faster but result in larger "
+                        "fastfiles. Defaults to the level the game uses, which is 6 for IW3, IW4, IW5 and T5 and 9 for T6.")
+    .WithParameter("level")
+    .Build();
+
 const CommandLineOption* const OPTION_MENU_PERMISSIVE =
     CommandLineOption::Builder::Create()
     .WithLongName("menu-permissive")
@@ -104,6 +144,11 @@ const CommandLineOption* const COMMAND_LINE_OPTIONS[]{
     OPTION_GDT_SEARCH_PATH,
     OPTION_SOURCE_SEARCH_PATH,
     OPTION_LOAD,
+    OPTION_INDEX_SEARCH_PATHS,
+    OPTION_REBUILD,
+    OPTION_JOBS,
+    OPTION_LOADING_THREADS,
+    OPTION_COMPRESSION_LEVEL,
     OPTION_MENU_PERMISSIVE,
     OPTION_MENU_NO_OPTIMIZATION,
 };
@@ -115,6 +160,10 @@ LinkerArgs::LinkerArgs()
       m_project_pattern(R"(\?project\?)"),
       m_base_folder_depends_on_project(false),
       m_out_folder_depends_on_project(false),
+      m_index_search_paths(false),
+      m_rebuild(false),
+      m_job_count(1u),
+      m_loading_thread_count(1u),
       m_verbose(false)
 {
 }
@@ -212,6 +261,39 @@ std::set<std::string> LinkerArgs::GetSearchPathsForProject(const std::set<std::s
     return out;
 }
 
+bool LinkerArgs::SetCount(const CommandLineOption* option, unsigned& count)
+{
+    const auto specifiedValue = m_argument_parser.GetValueForOption(option);
+
+    char* endPtr;
+    const auto parsedCount = std::strtoul(specifiedValue.c_str(), &endPtr, 10);
+    if (specifiedValue.empty() || *endPtr != '\0' || parsedCount < 1)
+    {
+        std::cout << "Illegal value: \"" << specifiedValue << "\" is not a valid count for option \"" << option->m_long_name
+                  << "\". Use -? to see usage information.\n";
+        return false;
+    }
+
+    count = static_cast<unsigned>(parsedCount);
+    return true;
+}
+
+bool LinkerArgs::SetCompressionLevel()
+{
+    const auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_COMPRESSION_LEVEL);
+
+    char* endPtr;
+    const auto parsedLevel = std::strtol(specifiedValue.c_str(), &endPtr, 10);
+    if (specifiedValue.empty() || *endPtr != '\0' || parsedLevel < 0 || parsedLevel > 9)
+    {
+        std::cout << "Illegal value: \"" << specifiedValue << "\" is not a valid compression level. Use -? to see usage information.\n";
+        return false;
+    }
+
+    ZoneWriting::Configuration.CompressionLevel = static_cast<int>(parsedLevel);
+    return true;
+}
+
 bool LinkerArgs::ParseArgs(const int argc, const char** argv, bool& shouldContinue)
 {
     shouldContinue = true;
@@ -302,6 +384,33 @@ bool LinkerArgs::ParseArgs(const int argc, const char** argv, bool& shouldContin
     if (m_argument_parser.IsOptionSpecified(OPTION_LOAD))
         m_zones_to_load = m_argument_parser.GetParametersForOption(OPTION_LOAD);
 
+    // --index-search-paths
+    m_index_search_paths = m_argument_parser.IsOptionSpecified(OPTION_INDEX_SEARCH_PATHS);
+
+    // --rebuild
+    m_rebuild = m_argument_parser.IsOptionSpecified(OPTION_REBUILD);
+
+    // -j; --jobs
+    if (m_argument_parser.IsOptionSpecified(OPTION_JOBS))
+    {
+        if (!SetCount(OPTION_JOBS, m_job_count))
+            return false;
+    }
+
+    // --loading-threads
+    if (m_argument_parser.IsOptionSpecified(OPTION_LOADING_THREADS))
+    {
+        if (!SetCount(OPTION_LOADING_THREADS, m_loading_thread_count))
+            return false;
+    }
+
+    // --compression-level
+    if (m_argument_parser.IsOptionSpecified(OPTION_COMPRESSION_LEVEL))
+    {
+        if (!SetCompressionLevel())
+            return false;
+    }
+
     // --menu-permissive
     if (m_argument_parser.IsOptionSpecified(OPTION_MENU_PERMISSIVE))
         ObjLoading::Configuration.MenuPermissiveParsing = true;
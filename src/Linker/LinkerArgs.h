@@ -34,6 +34,8 @@ private:
     static void PrintVersion();
 
     void SetVerbose(bool isVerbose);
+    bool SetCount(const CommandLineOption* option, unsigned& count);
+    bool SetCompressionLevel();
 
     _NODISCARD std::string GetBasePathForProject(const std::string& projectName) const;
     void SetDefaultBasePath();
@@ -54,6 +56,10 @@ public:
     std::set<std::string> m_gdt_search_paths;
     std::set<std::string> m_source_search_paths;
 
+    bool m_index_search_paths;
+    bool m_rebuild;
+    unsigned m_job_count;
+    unsigned m_loading_thread_count;
     bool m_verbose;
 
     LinkerArgs();
@@ -34,9 +34,12 @@ void LinkerSearchPaths::UnloadSearchPath(ISearchPath* searchPath) const
     ObjLoading::UnloadIWDsInSearchPath(searchPath);
 }
 
-SearchPaths LinkerSearchPaths::GetAssetSearchPathsForProject(const std::string& gameName, const std::string& projectName)
+SearchPaths LinkerSearchPaths::GetAssetSearchPathsForProject(const std::string& gameName,
+                                                             const std::string& projectName,
+                                                             std::vector<std::unique_ptr<ISearchPath>>& loadedSearchPaths)
 {
     SearchPaths searchPathsForProject;
+    searchPathsForProject.SetUseIndex(m_args.m_index_search_paths);
 
     for (const auto& searchPathStr : m_args.GetAssetSearchPathsForProject(gameName, projectName))
     {
@@ -52,15 +55,20 @@ SearchPaths LinkerSearchPaths::GetAssetSearchPathsForProject(const std::string&
         if (m_args.m_verbose)
             std::cout << "Adding asset search path: " << absolutePath.string() << "\n";
 
-        auto searchPath = std::make_unique<SearchPathFilesystem>(searchPathStr);
+        auto searchPath = std::make_unique<SearchPathFilesystem>(searchPathStr, m_args.m_index_search_paths);
         LoadSearchPath(searchPath.get());
         searchPathsForProject.IncludeSearchPath(searchPath.get());
-        m_loaded_project_search_paths.emplace_back(std::move(searchPath));
+        loadedSearchPaths.emplace_back(std::move(searchPath));
     }
 
     searchPathsForProject.IncludeSearchPath(&m_asset_search_paths);
 
-    for (auto* iwd : IWD::Repository)
+    // Only use the IWDs of this build since other builds may load and unload theirs at the same time
+    std::vector<ISearchPath*> iwdReferencers(m_asset_search_paths.begin(), m_asset_search_paths.end());
+    for (const auto& loadedSearchPath : loadedSearchPaths)
+        iwdReferencers.emplace_back(loadedSearchPath.get());
+
+    for (auto* iwd : IWD::Repository.GetContainersReferencedBy(iwdReferencers))
     {
         searchPathsForProject.IncludeSearchPath(iwd);
     }
@@ -71,6 +79,7 @@ SearchPaths LinkerSearchPaths::GetAssetSearchPathsForProject(const std::string&
 SearchPaths LinkerSearchPaths::GetGdtSearchPathsForProject(const std::string& gameName, const std::string& projectName)
 {
     SearchPaths searchPathsForProject;
+    searchPathsForProject.SetUseIndex(m_args.m_index_search_paths);
 
     for (const auto& searchPathStr : m_args.GetGdtSearchPathsForProject(gameName, projectName))
     {
@@ -86,7 +95,7 @@ SearchPaths LinkerSearchPaths::GetGdtSearchPathsForProject(const std::string& ga
         if (m_args.m_verbose)
             std::cout << "Adding gdt search path: " << absolutePath.string() << "\n";
 
-        searchPathsForProject.CommitSearchPath(std::make_unique<SearchPathFilesystem>(searchPathStr));
+        searchPathsForProject.CommitSearchPath(std::make_unique<SearchPathFilesystem>(searchPathStr, m_args.m_index_search_paths));
     }
 
     searchPathsForProject.IncludeSearchPath(&m_gdt_search_paths);
@@ -97,6 +106,7 @@ SearchPaths LinkerSearchPaths::GetGdtSearchPathsForProject(const std::string& ga
 SearchPaths LinkerSearchPaths::GetSourceSearchPathsForProject(const std::string& projectName)
 {
     SearchPaths searchPathsForProject;
+    searchPathsForProject.SetUseIndex(m_args.m_index_search_paths);
 
     for (const auto& searchPathStr : m_args.GetSourceSearchPathsForProject(projectName))
     {
@@ -112,7 +122,7 @@ SearchPaths LinkerSearchPaths::GetSourceSearchPathsForProject(const std::string&
         if (m_args.m_verbose)
             std::cout << "Adding source search path: " << absolutePath.string() << "\n";
 
-        searchPathsForProject.CommitSearchPath(std::make_unique<SearchPathFilesystem>(searchPathStr));
+        searchPathsForProject.CommitSearchPath(std::make_unique<SearchPathFilesystem>(searchPathStr, m_args.m_index_search_paths));
     }
 
     searchPathsForProject.IncludeSearchPath(&m_source_search_paths);
@@ -136,7 +146,7 @@ bool LinkerSearchPaths::BuildProjectIndependentSearchPaths()
         if (m_args.m_verbose)
             std::cout << "Adding asset search path: " << absolutePath.string() << "\n";
 
-        auto searchPath = std::make_unique<SearchPathFilesystem>(absolutePath.string());
+        auto searchPath = std::make_unique<SearchPathFilesystem>(absolutePath.string(), m_args.m_index_search_paths);
         LoadSearchPath(searchPath.get());
         m_asset_search_paths.CommitSearchPath(std::move(searchPath));
     }
@@ -155,7 +165,7 @@ bool LinkerSearchPaths::BuildProjectIndependentSearchPaths()
         if (m_args.m_verbose)
             std::cout << "Adding gdt search path: " << absolutePath.string() << "\n";
 
-        m_gdt_search_paths.CommitSearchPath(std::make_unique<SearchPathFilesystem>(absolutePath.string()));
+        m_gdt_search_paths.CommitSearchPath(std::make_unique<SearchPathFilesystem>(absolutePath.string(), m_args.m_index_search_paths));
     }
 
     for (const auto& path : m_args.GetProjectIndependentSourceSearchPaths())
@@ -172,18 +182,23 @@ bool LinkerSearchPaths::BuildProjectIndependentSearchPaths()
         if (m_args.m_verbose)
             std::cout << "Adding source search path: " << absolutePath.string() << "\n";
 
-        m_source_search_paths.CommitSearchPath(std::make_unique<SearchPathFilesystem>(absolutePath.string()));
+        m_source_search_paths.CommitSearchPath(std::make_unique<SearchPathFilesystem>(absolutePath.string(), m_args.m_index_search_paths));
     }
 
     return true;
 }
 
-void LinkerSearchPaths::UnloadProjectSpecificSearchPaths()
+void LinkerSearchPaths::UnloadProjectSpecificSearchPaths(std::vector<std::unique_ptr<ISearchPath>>& loadedSearchPaths)
 {
-    for (const auto& loadedSearchPath : m_loaded_project_search_paths)
+    for (const auto& loadedSearchPath : loadedSearchPaths)
     {
         UnloadSearchPath(loadedSearchPath.get());
     }
 
-    m_loaded_project_search_paths.clear();
+    loadedSearchPaths.clear();
+
+    // Building a project may have written files into search paths that are used by the next project
+    m_asset_search_paths.InvalidateIndex();
+    m_gdt_search_paths.InvalidateIndex();
+    m_source_search_paths.InvalidateIndex();
 }
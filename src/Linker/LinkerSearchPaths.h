@@ -22,7 +22,17 @@ public:
      */
     void UnloadSearchPath(ISearchPath* searchPath) const;
 
-    SearchPaths GetAssetSearchPathsForProject(const std::string& gameName, const std::string& projectName);
+    /**
+     * \brief Creates the asset search paths for building a target of a project.
+     * Targets can be built concurrently since everything that is specific to the build is owned by the caller.
+     * \param gameName The name of the game the target is built for.
+     * \param projectName The name of the project the target belongs to.
+     * \param loadedSearchPaths Receives the project specific search paths that were loaded. They must outlive the returned search paths.
+     * \return The asset search paths for the project.
+     */
+    SearchPaths GetAssetSearchPathsForProject(const std::string& gameName,
+                                              const std::string& projectName,
+                                              std::vector<std::unique_ptr<ISearchPath>>& loadedSearchPaths);
 
     SearchPaths GetGdtSearchPathsForProject(const std::string& gameName, const std::string& projectName);
 
@@ -34,11 +44,14 @@ public:
      */
     bool BuildProjectIndependentSearchPaths();
 
-    void UnloadProjectSpecificSearchPaths();
+    /**
+     * \brief Unloads the project specific search paths of a build after it finished.
+     * \param loadedSearchPaths The search paths that were loaded for the build.
+     */
+    void UnloadProjectSpecificSearchPaths(std::vector<std::unique_ptr<ISearchPath>>& loadedSearchPaths);
 
 private:
     const LinkerArgs& m_args;
-    std::vector<std::unique_ptr<ISearchPath>> m_loaded_project_search_paths;
     SearchPaths m_asset_search_paths;
     SearchPaths m_gdt_search_paths;
     SearchPaths m_source_search_paths;
@@ -1,9 +1,11 @@
 #pragma once
 #include "Obj/Gdt/Gdt.h"
 #include "SearchPath/ISearchPath.h"
+#include "Utils/ThreadPool.h"
 #include "Zone/AssetList/AssetList.h"
 #include "Zone/Definition/ZoneDefinition.h"
 
+#include <filesystem>
 #include <memory>
 #include <string>
 #include <vector>
@@ -16,6 +18,17 @@ public:
     ZoneDefinition* m_definition;
     std::vector<std::unique_ptr<Gdt>> m_gdt_files;
     AssetList m_ignored_assets;
+    std::filesystem::path m_output_folder;
+
+    /**
+     * \brief The paths of all files that were written to the output folder while creating the zone, not including the zone itself.
+     */
+    std::vector<std::filesystem::path> m_output_files;
+
+    /**
+     * \brief The thread pool to read and parse the files of assets on ahead of loading them or \c nullptr to load them on the calling thread only.
+     */
+    ThreadPool* m_loading_thread_pool;
 
     ZoneCreationContext();
     ZoneCreationContext(ISearchPath* assetSearchPath, ZoneDefinition* definition);
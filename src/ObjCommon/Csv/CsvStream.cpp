@@ -1,76 +1,128 @@
 #include "CsvStream.h"
 
-#include <sstream>
+#include <cstring>
 
 constexpr char CSV_SEPARATOR = ',';
 
 CsvInputStream::CsvInputStream(std::istream& stream)
-    : m_stream(stream)
+    : m_stream(stream),
+      m_buffer(BUFFER_SIZE),
+      m_buffer_offset(0u),
+      m_buffer_size(0u)
 {
 }
 
-bool CsvInputStream::NextRow(std::vector<std::string>& out) const
+bool CsvInputStream::NextRow(std::vector<std::string>& out)
 {
     if (!out.empty())
         out.clear();
 
-    return EmitNextRow(
-        [&out](std::string value)
-        {
-            out.emplace_back(std::move(value));
-        });
+    std::vector<std::string_view> cells;
+    if (!NextRow(cells))
+        return false;
+
+    out.reserve(cells.size());
+    for (const auto& cell : cells)
+        out.emplace_back(cell);
+
+    return true;
 }
 
-bool CsvInputStream::NextRow(std::vector<const char*>& out, MemoryManager& memory) const
+bool CsvInputStream::NextRow(std::vector<const char*>& out, MemoryManager& memory)
 {
     if (!out.empty())
         out.clear();
 
-    return EmitNextRow(
-        [&out, &memory](const std::string& value)
-        {
-            out.emplace_back(memory.Dup(value.c_str()));
-        });
+    std::vector<std::string_view> cells;
+    if (!NextRow(cells))
+        return false;
+
+    out.reserve(cells.size());
+    for (const auto& cell : cells)
+        out.emplace_back(memory.Dup(cell));
+
+    return true;
 }
 
-bool CsvInputStream::EmitNextRow(const std::function<void(std::string)>& cb) const
+bool CsvInputStream::NextRow(std::vector<std::string_view>& out)
 {
-    auto c = m_stream.get();
-    const auto isEof = c == EOF;
-    std::ostringstream col;
-    while (c != EOF)
+    if (!out.empty())
+        out.clear();
+
+    std::string_view line;
+    if (!NextLine(line))
+        return false;
+
+    while (true)
     {
-        if (c == CSV_SEPARATOR)
-        {
-            cb(col.str());
-            col.clear();
-            col.str(std::string());
-        }
-        else if (c == '\r')
-        {
-            c = m_stream.get();
-            if (c == '\n')
-                break;
-            col << '\r';
-        }
-        else if (c == '\n')
-        {
+        const auto* separator = static_cast<const char*>(memchr(line.data(), CSV_SEPARATOR, line.size()));
+        if (!separator)
             break;
+
+        const auto cellLength = static_cast<size_t>(separator - line.data());
+        out.emplace_back(line.substr(0, cellLength));
+        line.remove_prefix(cellLength + 1);
+    }
+
+    out.emplace_back(line);
+
+    return true;
+}
+
+bool CsvInputStream::NextLine(std::string_view& line)
+{
+    auto searchOffset = m_buffer_offset;
+
+    while (true)
+    {
+        const auto* lineEnd = static_cast<const char*>(memchr(m_buffer.data() + searchOffset, '\n', m_buffer_size - searchOffset));
+        if (lineEnd)
+        {
+            const auto lineEndOffset = static_cast<size_t>(lineEnd - m_buffer.data());
+            line = std::string_view(m_buffer.data() + m_buffer_offset, lineEndOffset - m_buffer_offset);
+            m_buffer_offset = lineEndOffset + 1;
+
+            // Only a carriage return directly before the line break is part of the line ending
+            if (!line.empty() && line.back() == '\r')
+                line.remove_suffix(1);
+
+            return true;
         }
-        else
+
+        // Everything that was already searched is moved to the front of the buffer when filling it
+        const auto searchedSize = m_buffer_size - m_buffer_offset;
+        if (!FillBuffer())
         {
-            col << static_cast<char>(c);
+            if (m_buffer_offset >= m_buffer_size)
+                return false;
+
+            line = std::string_view(m_buffer.data() + m_buffer_offset, m_buffer_size - m_buffer_offset);
+            m_buffer_offset = m_buffer_size;
+            return true;
         }
 
-        c = m_stream.get();
+        searchOffset = searchedSize;
     }
+}
 
-    if (!isEof)
+bool CsvInputStream::FillBuffer()
+{
+    if (m_buffer_offset > 0)
     {
-        cb(col.str());
+        std::memmove(m_buffer.data(), m_buffer.data() + m_buffer_offset, m_buffer_size - m_buffer_offset);
+        m_buffer_size -= m_buffer_offset;
+        m_buffer_offset = 0;
     }
 
-    return !isEof;
+    // A single row is larger than the buffer
+    if (m_buffer_size == m_buffer.size())
+        m_buffer.resize(m_buffer.size() * 2);
+
+    m_stream.read(m_buffer.data() + m_buffer_size, static_cast<std::streamsize>(m_buffer.size() - m_buffer_size));
+    const auto readSize = static_cast<size_t>(m_stream.gcount());
+    m_buffer_size += readSize;
+
+    return readSize > 0;
 }
 
 CsvOutputStream::CsvOutputStream(std::ostream& stream)
@@ -4,6 +4,7 @@
 #include <functional>
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 class CsvInputStream
@@ -11,13 +12,26 @@ class CsvInputStream
 public:
     explicit CsvInputStream(std::istream& stream);
 
-    bool NextRow(std::vector<std::string>& out) const;
-    bool NextRow(std::vector<const char*>& out, MemoryManager& memory) const;
+    bool NextRow(std::vector<std::string>& out);
+    bool NextRow(std::vector<const char*>& out, MemoryManager& memory);
+
+    /**
+     * \brief Reads the next row without copying its cells.
+     * \param out The cells of the row. They point into the buffer of the stream and are only valid until the next row is read.
+     * \return \c true if a row was read, \c false if the end of the stream was reached.
+     */
+    bool NextRow(std::vector<std::string_view>& out);
 
 private:
-    bool EmitNextRow(const std::function<void(std::string)>& cb) const;
+    static constexpr size_t BUFFER_SIZE = 0x10000;
+
+    bool NextLine(std::string_view& line);
+    bool FillBuffer();
 
     std::istream& m_stream;
+    std::vector<char> m_buffer;
+    size_t m_buffer_offset;
+    size_t m_buffer_size;
 };
 
 class CsvOutputStream
@@ -42,7 +42,7 @@ float ParsedCsvRow::GetValueFloat(const std::string& header, const bool required
     return {};
 }
 
-ParsedCsv::ParsedCsv(const CsvInputStream& inputStream, const bool hasHeaders)
+ParsedCsv::ParsedCsv(CsvInputStream& inputStream, const bool hasHeaders)
 {
     std::vector<std::vector<std::string>> csvLines;
     std::vector<std::string> currentLine;
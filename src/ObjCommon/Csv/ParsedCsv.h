@@ -37,7 +37,7 @@ class ParsedCsv
     std::vector<ParsedCsvRow> rows;
 
 public:
-    explicit ParsedCsv(const CsvInputStream& inputStream, bool hasHeaders = true);
+    explicit ParsedCsv(CsvInputStream& inputStream, bool hasHeaders = true);
 
     _NODISCARD size_t Size() const;
 
@@ -3,6 +3,11 @@
 #include <iostream>
 #include <sstream>
 
+namespace
+{
+    thread_local GdtOutputStream::EntryBuffer* capturingEntryBuffer = nullptr;
+}
+
 class GdtConst
 {
 public:
@@ -348,6 +353,14 @@ void GdtOutputStream::WriteEscaped(const std::string& str) const
 
 void GdtOutputStream::WriteEntry(const GdtEntry& entry)
 {
+    if (capturingEntryBuffer && capturingEntryBuffer->m_stream == this)
+    {
+        capturingEntryBuffer->m_entries.emplace_back(entry);
+        return;
+    }
+
+    std::lock_guard lock(m_entry_mutex);
+
     DoIntendation();
     m_stream << "\"" << entry.m_name << "\" ";
     if (entry.m_parent)
@@ -393,3 +406,37 @@ void GdtOutputStream::WriteGdt(const Gdt& gdt, std::ostream& stream)
 
     out.EndStream();
 }
+
+GdtOutputStream::EntryBuffer::EntryBuffer(GdtOutputStream* stream)
+    : m_stream(stream)
+{
+}
+
+void GdtOutputStream::EntryBuffer::Capture(const std::function<void()>& func)
+{
+    auto* previousEntryBuffer = capturingEntryBuffer;
+    capturingEntryBuffer = this;
+
+    try
+    {
+        func();
+    }
+    catch (...)
+    {
+        capturingEntryBuffer = previousEntryBuffer;
+        throw;
+    }
+
+    capturingEntryBuffer = previousEntryBuffer;
+}
+
+void GdtOutputStream::EntryBuffer::Flush()
+{
+    if (m_stream)
+    {
+        for (const auto& entry : m_entries)
+            m_stream->WriteEntry(entry);
+    }
+
+    m_entries.clear();
+}
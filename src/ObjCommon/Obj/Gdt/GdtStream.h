@@ -1,7 +1,10 @@
 #pragma once
 #include "Gdt.h"
 
+#include <functional>
 #include <iostream>
+#include <mutex>
+#include <vector>
 
 class GdtReader
 {
@@ -25,9 +28,39 @@ public:
 
 class GdtOutputStream
 {
+public:
+    /**
+     * \brief Holds back the entries that are written to a gdt on the thread that captures them,
+     * so entries that are written concurrently can be written in a fixed order afterwards.
+     * Entries are copied, so the parents of entries must outlive the buffer.
+     */
+    class EntryBuffer
+    {
+        friend class GdtOutputStream;
+
+        GdtOutputStream* m_stream;
+        std::vector<GdtEntry> m_entries;
+
+    public:
+        explicit EntryBuffer(GdtOutputStream* stream);
+
+        /**
+         * \brief Executes the function while holding back all entries that are written to the stream on the calling thread.
+         * Buffers can be nested, entries are held back by the innermost one.
+         */
+        void Capture(const std::function<void()>& func);
+
+        /**
+         * \brief Writes the held back entries to the stream in the order they were written in.
+         */
+        void Flush();
+    };
+
+private:
     std::ostream& m_stream;
     bool m_open;
     unsigned m_intendation_level;
+    std::mutex m_entry_mutex;
 
     void DoIntendation() const;
 
@@ -37,6 +70,10 @@ public:
     void BeginStream();
     void WriteVersion(const GdtVersion& gdtVersion);
     void WriteEscaped(const std::string& str) const;
+    /**
+     * \brief Writes an entry to the gdt or holds it back if an \c EntryBuffer of this stream captures on the calling thread.
+     * Can be called from multiple threads at once.
+     */
     void WriteEntry(const GdtEntry& entry);
     void EndStream();
 
@@ -1,9 +1,16 @@
 #include "AssetLoadingContext.h"
 
 AssetLoadingContext::AssetLoadingContext(Zone* zone, ISearchPath* rawSearchPath, std::vector<Gdt*> gdtFiles)
+    : AssetLoadingContext(zone, rawSearchPath, std::move(gdtFiles), nullptr)
+{
+}
+
+AssetLoadingContext::AssetLoadingContext(Zone* zone, ISearchPath* rawSearchPath, std::vector<Gdt*> gdtFiles, ThreadPool* rawAssetPreparationThreadPool)
     : m_zone(zone),
       m_raw_search_path(rawSearchPath),
-      m_gdt_files(std::move(gdtFiles))
+      m_gdt_files(std::move(gdtFiles)),
+      m_output_files(nullptr),
+      m_raw_asset_preparer(rawAssetPreparationThreadPool)
 {
     BuildGdtEntryCache();
 }
@@ -3,9 +3,11 @@
 #include "IGdtQueryable.h"
 #include "IZoneAssetLoaderState.h"
 #include "Obj/Gdt/Gdt.h"
+#include "RawAssetPreparer.h"
 #include "SearchPath/ISearchPath.h"
 #include "Zone/Zone.h"
 
+#include <filesystem>
 #include <type_traits>
 #include <typeindex>
 #include <unordered_map>
@@ -23,7 +25,20 @@ public:
     const std::vector<Gdt*> m_gdt_files;
     std::unordered_map<std::string, asset_type_t> m_ignored_asset_map;
 
+    /**
+     * \brief The folder that files which are built alongside the zone, like sound banks, are written to.
+     */
+    std::filesystem::path m_output_folder;
+
+    /**
+     * \brief Collects the paths of all files that were written to the output folder or \c nullptr if they are not collected.
+     */
+    std::vector<std::filesystem::path>* m_output_files;
+
+    RawAssetPreparer m_raw_asset_preparer;
+
     AssetLoadingContext(Zone* zone, ISearchPath* rawSearchPath, std::vector<Gdt*> gdtFiles);
+    AssetLoadingContext(Zone* zone, ISearchPath* rawSearchPath, std::vector<Gdt*> gdtFiles, ThreadPool* rawAssetPreparationThreadPool);
     GdtEntry* GetGdtEntryByGdfAndName(const std::string& gdfName, const std::string& entryName) override;
 
     template<typename T> T* GetZoneAssetLoaderState()
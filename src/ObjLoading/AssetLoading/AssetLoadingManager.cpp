@@ -18,6 +18,36 @@ bool AssetLoadingManager::LoadAssetFromLoader(const asset_type_t assetType, cons
     return LoadDependency(assetType, assetName) != nullptr;
 }
 
+void AssetLoadingManager::PrepareAssetFromLoader(const asset_type_t assetType, const std::string& assetName)
+{
+    if (!m_context.m_raw_asset_preparer.IsEnabled())
+        return;
+
+    const auto loader = m_asset_loaders_by_type.find(assetType);
+    if (loader == m_asset_loaders_by_type.end())
+        return;
+
+    const auto* assetLoader = loader->second.get();
+    if (!assetLoader->CanLoadFromRaw() || !assetLoader->CanPrepareFromRaw())
+        return;
+
+    // Assets that are not loaded from raw must not open their raw files since everything opened counts as a dependency of the build
+    if (assetLoader->CanLoadFromGdt() && !m_context.m_gdt_files.empty())
+        return;
+
+    const auto ignoreEntry = m_context.m_ignored_asset_map.find(assetName);
+    if (ignoreEntry != m_context.m_ignored_asset_map.end() && ignoreEntry->second == assetType)
+        return;
+
+    auto* searchPath = m_context.m_raw_search_path;
+    m_context.m_raw_asset_preparer.Prepare(assetType,
+                                           assetName,
+                                           [assetLoader, assetName, searchPath]
+                                           {
+                                               return assetLoader->PrepareFromRaw(assetName, searchPath);
+                                           });
+}
+
 AssetLoadingContext* AssetLoadingManager::GetAssetLoadingContext() const
 {
     return &m_context;
@@ -69,6 +99,24 @@ XAssetInfoGeneric* AssetLoadingManager::LoadIgnoredDependency(const asset_type_t
     return nullptr;
 }
 
+bool AssetLoadingManager::LoadAssetFromRaw(const asset_type_t assetType, const std::string& assetName, const IAssetLoader* loader)
+{
+    if (!loader->CanPrepareFromRaw())
+        return loader->LoadFromRaw(assetName, m_context.m_raw_search_path, m_context.m_zone->GetMemory(), this, m_context.m_zone);
+
+    auto* searchPath = m_context.m_raw_search_path;
+    const auto preparedAsset = m_context.m_raw_asset_preparer.Take(assetType,
+                                                                   assetName,
+                                                                   [loader, &assetName, searchPath]
+                                                                   {
+                                                                       return loader->PrepareFromRaw(assetName, searchPath);
+                                                                   });
+    if (!preparedAsset)
+        return false;
+
+    return loader->LoadFromPrepared(assetName, *preparedAsset, m_context.m_zone->GetMemory(), this, m_context.m_zone);
+}
+
 XAssetInfoGeneric* AssetLoadingManager::LoadAssetDependency(const asset_type_t assetType, const std::string& assetName, const IAssetLoader* loader)
 {
     if (loader->CanLoadFromGdt() && !m_context.m_gdt_files.empty()
@@ -79,7 +127,7 @@ XAssetInfoGeneric* AssetLoadingManager::LoadAssetDependency(const asset_type_t a
         return lastDependency;
     }
 
-    if (loader->CanLoadFromRaw() && loader->LoadFromRaw(assetName, m_context.m_raw_search_path, m_context.m_zone->GetMemory(), this, m_context.m_zone))
+    if (loader->CanLoadFromRaw() && LoadAssetFromRaw(assetType, assetName, loader))
     {
         auto* lastDependency = m_last_dependency_loaded;
         m_last_dependency_loaded = nullptr;
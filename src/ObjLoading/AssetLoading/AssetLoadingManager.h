@@ -13,6 +13,13 @@ public:
 
     bool LoadAssetFromLoader(asset_type_t assetType, const std::string& assetName);
 
+    /**
+     * \brief Starts preparing the raw files of an asset ahead of loading it if its loader supports it.
+     * \param assetType The type of the asset.
+     * \param assetName The name of the asset.
+     */
+    void PrepareAssetFromLoader(asset_type_t assetType, const std::string& assetName);
+
     [[nodiscard]] AssetLoadingContext* GetAssetLoadingContext() const override;
 
     XAssetInfoGeneric* AddAsset(std::unique_ptr<XAssetInfoGeneric> xAssetInfo) override;
@@ -22,6 +29,7 @@ public:
 private:
     XAssetInfoGeneric* LoadIgnoredDependency(asset_type_t assetType, const std::string& assetName, IAssetLoader* loader);
     XAssetInfoGeneric* LoadAssetDependency(asset_type_t assetType, const std::string& assetName, const IAssetLoader* loader);
+    bool LoadAssetFromRaw(asset_type_t assetType, const std::string& assetName, const IAssetLoader* loader);
 
     XAssetInfoGeneric* AddAssetInternal(std::unique_ptr<XAssetInfoGeneric> xAssetInfo);
 
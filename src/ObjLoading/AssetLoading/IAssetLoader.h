@@ -1,10 +1,12 @@
 #pragma once
 #include "IAssetLoadingManager.h"
 #include "IGdtQueryable.h"
+#include "IPreparedRawAsset.h"
 #include "SearchPath/ISearchPath.h"
 #include "Utils/ClassUtils.h"
 #include "Zone/ZoneTypes.h"
 
+#include <memory>
 #include <string>
 
 class IAssetLoader
@@ -36,6 +38,14 @@ public:
         return false;
     }
 
+    /**
+     * \brief Whether loading from raw is split into \c PrepareFromRaw and \c LoadFromPrepared.
+     */
+    _NODISCARD virtual bool CanPrepareFromRaw() const
+    {
+        return false;
+    }
+
     virtual bool LoadFromGdt(const std::string& assetName, IGdtQueryable* gdtQueryable, MemoryManager* memory, IAssetLoadingManager* manager, Zone* zone) const
     {
         return false;
@@ -46,6 +56,26 @@ public:
         return false;
     }
 
+    /**
+     * \brief Reads and parses the raw files of an asset. Can be called from any thread ahead of loading the asset, so it must not access the zone.
+     * \param assetName The name of the asset.
+     * \param searchPath The search path to read the raw files from.
+     * \return The prepared data or \c nullptr if there are no raw files for the asset.
+     */
+    _NODISCARD virtual std::unique_ptr<IPreparedRawAsset> PrepareFromRaw(const std::string& assetName, ISearchPath* searchPath) const
+    {
+        return nullptr;
+    }
+
+    /**
+     * \brief Loads an asset from the data that was returned by \c PrepareFromRaw.
+     */
+    virtual bool LoadFromPrepared(
+        const std::string& assetName, IPreparedRawAsset& preparedAsset, MemoryManager* memory, IAssetLoadingManager* manager, Zone* zone) const
+    {
+        return false;
+    }
+
     virtual void FinalizeAssetsForZone(AssetLoadingContext* context) const
     {
         // Do nothing by default
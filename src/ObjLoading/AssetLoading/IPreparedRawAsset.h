@@ -0,0 +1,17 @@
+#pragma once
+
+/**
+ * \brief Data of an asset that was read and parsed from raw files ahead of loading it into a zone.
+ */
+class IPreparedRawAsset
+{
+protected:
+    IPreparedRawAsset() = default;
+
+public:
+    virtual ~IPreparedRawAsset() = default;
+    IPreparedRawAsset(const IPreparedRawAsset& other) = default;
+    IPreparedRawAsset(IPreparedRawAsset&& other) noexcept = default;
+    IPreparedRawAsset& operator=(const IPreparedRawAsset& other) = default;
+    IPreparedRawAsset& operator=(IPreparedRawAsset&& other) noexcept = default;
+};
@@ -0,0 +1,111 @@
+#include "RawAssetPreparer.h"
+
+RawAssetPreparer::Preparation::Preparation(prepare_func_t prepare)
+    : m_state(PreparationState::QUEUED),
+      m_prepare(std::move(prepare))
+{
+}
+
+RawAssetPreparer::RawAssetPreparer(ThreadPool* threadPool)
+    : m_thread_pool(threadPool),
+      m_tasks(threadPool)
+{
+}
+
+bool RawAssetPreparer::IsEnabled() const
+{
+    return m_thread_pool != nullptr;
+}
+
+void RawAssetPreparer::Prepare(const asset_type_t assetType, const std::string& assetName, prepare_func_t prepare)
+{
+    if (m_thread_pool == nullptr)
+        return;
+
+    auto key = std::make_pair(assetType, assetName);
+    {
+        std::lock_guard lock(m_mutex);
+        if (!m_preparations.try_emplace(key, std::move(prepare)).second)
+            return;
+    }
+
+    m_tasks.Run(
+        [this, key = std::move(key)]
+        {
+            RunPreparation(key);
+        });
+}
+
+void RawAssetPreparer::RunPreparation(const std::pair<asset_type_t, std::string>& key)
+{
+    prepare_func_t prepare;
+    {
+        std::lock_guard lock(m_mutex);
+
+        // The asset may have been taken and prepared by the loading thread already
+        const auto preparation = m_preparations.find(key);
+        if (preparation == m_preparations.end() || preparation->second.m_state != PreparationState::QUEUED)
+            return;
+
+        preparation->second.m_state = PreparationState::RUNNING;
+        prepare = std::move(preparation->second.m_prepare);
+    }
+
+    std::unique_ptr<IPreparedRawAsset> result;
+    std::exception_ptr error;
+    try
+    {
+        result = prepare();
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+
+        auto& preparation = m_preparations.at(key);
+        preparation.m_state = PreparationState::DONE;
+        preparation.m_result = std::move(result);
+        preparation.m_error = error;
+    }
+
+    m_preparation_done.notify_all();
+}
+
+std::unique_ptr<IPreparedRawAsset> RawAssetPreparer::Take(const asset_type_t assetType, const std::string& assetName, const prepare_func_t& prepare)
+{
+    std::unique_lock lock(m_mutex);
+
+    const auto preparation = m_preparations.find(std::make_pair(assetType, assetName));
+    if (preparation == m_preparations.end())
+    {
+        lock.unlock();
+        return prepare();
+    }
+
+    if (preparation->second.m_state == PreparationState::QUEUED)
+    {
+        // Do not wait for the queued task to be picked up when the asset is needed right now
+        m_preparations.erase(preparation);
+        lock.unlock();
+        return prepare();
+    }
+
+    m_preparation_done.wait(lock,
+                            [&preparation]
+                            {
+                                return preparation->second.m_state == PreparationState::DONE;
+                            });
+
+    auto result = std::move(preparation->second.m_result);
+    const auto error = preparation->second.m_error;
+    m_preparations.erase(preparation);
+    lock.unlock();
+
+    if (error)
+        std::rethrow_exception(error);
+
+    return result;
+}
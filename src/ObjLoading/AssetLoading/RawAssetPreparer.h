@@ -0,0 +1,84 @@
+#pragma once
+
+#include "IPreparedRawAsset.h"
+#include "Utils/ClassUtils.h"
+#include "Utils/TaskGroup.h"
+#include "Utils/ThreadPool.h"
+#include "Zone/ZoneTypes.h"
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+/**
+ * \brief Reads and parses the raw files of assets on a thread pool before they are loaded, so that loading them only has to add them to the zone.
+ * Assets are still loaded in the same order as without preparing them, so the resulting zone does not change.
+ * Without a thread pool nothing is prepared ahead of time.
+ */
+class RawAssetPreparer
+{
+public:
+    using prepare_func_t = std::function<std::unique_ptr<IPreparedRawAsset>()>;
+
+private:
+    enum class PreparationState
+    {
+        QUEUED,
+        RUNNING,
+        DONE
+    };
+
+    class Preparation
+    {
+    public:
+        PreparationState m_state;
+        prepare_func_t m_prepare;
+        std::unique_ptr<IPreparedRawAsset> m_result;
+        std::exception_ptr m_error;
+
+        explicit Preparation(prepare_func_t prepare);
+    };
+
+    ThreadPool* m_thread_pool;
+    std::mutex m_mutex;
+    std::condition_variable m_preparation_done;
+    std::map<std::pair<asset_type_t, std::string>, Preparation> m_preparations;
+
+    // Declared last so that all tasks referencing the preparations finished before they are destroyed
+    TaskGroup m_tasks;
+
+    void RunPreparation(const std::pair<asset_type_t, std::string>& key);
+
+public:
+    explicit RawAssetPreparer(ThreadPool* threadPool);
+    ~RawAssetPreparer() = default;
+    RawAssetPreparer(const RawAssetPreparer& other) = delete;
+    RawAssetPreparer(RawAssetPreparer&& other) noexcept = delete;
+    RawAssetPreparer& operator=(const RawAssetPreparer& other) = delete;
+    RawAssetPreparer& operator=(RawAssetPreparer&& other) noexcept = delete;
+
+    _NODISCARD bool IsEnabled() const;
+
+    /**
+     * \brief Starts preparing an asset on the thread pool. Does nothing if the asset is already being prepared or there is no thread pool.
+     * \param assetType The type of the asset.
+     * \param assetName The name of the asset.
+     * \param prepare Reads and parses the files of the asset. It must not access the zone since it runs concurrently to loading other assets.
+     */
+    void Prepare(asset_type_t assetType, const std::string& assetName, prepare_func_t prepare);
+
+    /**
+     * \brief Gets the prepared data of an asset. Waits for the preparation if it is running and prepares the asset on the calling thread if it did not start
+     * yet or was never requested. Exceptions thrown while preparing are rethrown.
+     * \param assetType The type of the asset.
+     * \param assetName The name of the asset.
+     * \param prepare Prepares the asset in case it was not prepared ahead of time.
+     * \return The prepared data of the asset.
+     */
+    std::unique_ptr<IPreparedRawAsset> Take(asset_type_t assetType, const std::string& assetName, const prepare_func_t& prepare);
+};
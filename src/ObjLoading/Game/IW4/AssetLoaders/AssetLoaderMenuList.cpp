@@ -93,7 +93,7 @@ namespace IW4
         }
 
         static std::unique_ptr<menu::ParsingResult>
-            ParseMenuFile(const std::string& menuFileName, ISearchPath* searchPath, const menu::MenuAssetZoneState* zoneState)
+            ParseMenuFile(const std::string& menuFileName, ISearchPath* searchPath, menu::MenuAssetZoneState* zoneState)
         {
             const auto file = searchPath->Open(menuFileName);
             if (!file.IsOpen())
@@ -112,6 +112,7 @@ namespace IW4
                                         });
 
             reader.IncludeZoneState(zoneState);
+            reader.SetIncludeCache(&zoneState->m_include_cache);
             reader.SetPermissiveMode(ObjLoading::Configuration.MenuPermissiveParsing);
 
             return reader.ReadMenuFile();
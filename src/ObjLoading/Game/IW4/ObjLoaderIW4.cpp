@@ -213,6 +213,12 @@ void ObjLoader::LoadObjDataForZone(ISearchPath* searchPath, Zone* zone) const
     LoadImageData(searchPath, zone);
 }
 
+void ObjLoader::PrepareAssetForZone(AssetLoadingContext* context, const asset_type_t assetType, const std::string& assetName) const
+{
+    AssetLoadingManager assetLoadingManager(m_asset_loaders_by_type, *context);
+    assetLoadingManager.PrepareAssetFromLoader(assetType, assetName);
+}
+
 bool ObjLoader::LoadAssetForZone(AssetLoadingContext* context, asset_type_t assetType, const std::string& assetName) const
 {
     AssetLoadingManager assetLoadingManager(m_asset_loaders_by_type, *context);
@@ -31,6 +31,7 @@ namespace IW5
 
         void LoadObjDataForZone(ISearchPath* searchPath, Zone* zone) const override;
 
+        void PrepareAssetForZone(AssetLoadingContext* context, asset_type_t assetType, const std::string& assetName) const override;
         bool LoadAssetForZone(AssetLoadingContext* context, asset_type_t assetType, const std::string& assetName) const override;
         void FinalizeAssetsForZone(AssetLoadingContext* context) const override;
     };
@@ -169,7 +169,7 @@ bool AssetLoaderFontIcon::LoadFromRaw(
     auto* fontIcon = memory->Create<FontIcon>();
     fontIcon->name = memory->Dup(assetName.c_str());
 
-    const CsvInputStream csv(*file.m_stream);
+    CsvInputStream csv(*file.m_stream);
     std::vector<XAssetInfoGeneric*> dependencies;
     std::vector<std::string> currentRow;
     std::vector<FontIconEntry> entries;
@@ -2,16 +2,27 @@
 
 #include "Game/T6/CommonT6.h"
 #include "Game/T6/T6.h"
-#include "Image/IwiLoader.h"
+#include "Image/IwiFileCache.h"
+#include "ObjLoading.h"
 #include "Pool/GlobalAssetPool.h"
 
 #include <cstring>
 #include <iostream>
-#include <sstream>
-#include <zlib.h>
 
 using namespace T6;
 
+namespace
+{
+    class PreparedGfxImage final : public IPreparedRawAsset
+    {
+    public:
+        std::string m_file_name;
+        size_t m_file_size = 0;
+        bool m_valid = false;
+        IwiFileInfo m_iwi_info;
+    };
+} // namespace
+
 void* AssetLoaderGfxImage::CreateEmptyAsset(const std::string& assetName, MemoryManager* memory)
 {
     auto* image = memory->Create<GfxImage>();
@@ -28,26 +39,52 @@ bool AssetLoaderGfxImage::CanLoadFromRaw() const
 bool AssetLoaderGfxImage::LoadFromRaw(
     const std::string& assetName, ISearchPath* searchPath, MemoryManager* memory, IAssetLoadingManager* manager, Zone* zone) const
 {
-    const auto fileName = "images/" + assetName + ".iwi";
-    const auto file = searchPath->Open(fileName);
-    if (!file.IsOpen())
+    const auto preparedImage = PrepareFromRaw(assetName, searchPath);
+    if (!preparedImage)
         return false;
 
-    const auto fileSize = static_cast<size_t>(file.m_length);
-    const auto fileData = std::make_unique<char[]>(fileSize);
-    file.m_stream->read(fileData.get(), fileSize);
-    const auto dataHash = static_cast<unsigned>(crc32(0u, reinterpret_cast<const Bytef*>(fileData.get()), fileSize));
+    return LoadFromPrepared(assetName, *preparedImage, memory, manager, zone);
+}
+
+bool AssetLoaderGfxImage::CanPrepareFromRaw() const
+{
+    return true;
+}
 
-    MemoryManager tempMemory;
-    IwiLoader iwiLoader(&tempMemory);
-    std::istringstream ss(std::string(fileData.get(), fileSize));
-    const auto texture = iwiLoader.LoadIwi(ss);
-    if (!texture)
+std::unique_ptr<IPreparedRawAsset> AssetLoaderGfxImage::PrepareFromRaw(const std::string& assetName, ISearchPath* searchPath) const
+{
+    auto preparedImage = std::make_unique<PreparedGfxImage>();
+    preparedImage->m_file_name = "images/" + assetName + ".iwi";
+
+    const auto file = searchPath->Open(preparedImage->m_file_name);
+    if (!file.IsOpen())
+        return nullptr;
+
+    preparedImage->m_file_size = static_cast<size_t>(file.m_length);
+
+    // Only the header and the hash of the image are needed, the pixel data is written to the ipak
+    auto* iwiFileCache = ObjLoading::Configuration.ImageFileCache;
+    if (iwiFileCache)
+        preparedImage->m_valid = iwiFileCache->GetFileInfo(file, preparedImage->m_iwi_info);
+    else
+        preparedImage->m_valid = IwiFileCache::ReadFileInfo(file, preparedImage->m_iwi_info);
+
+    return preparedImage;
+}
+
+bool AssetLoaderGfxImage::LoadFromPrepared(
+    const std::string& assetName, IPreparedRawAsset& preparedAsset, MemoryManager* memory, IAssetLoadingManager* manager, Zone* zone) const
+{
+    const auto& preparedImage = dynamic_cast<const PreparedGfxImage&>(preparedAsset);
+    if (!preparedImage.m_valid)
     {
-        std::cerr << "Failed to load texture from: " << fileName << "\n";
+        std::cerr << "Failed to load texture from: " << preparedImage.m_file_name << "\n";
         return false;
     }
 
+    const auto& iwiInfo = preparedImage.m_iwi_info;
+    const auto fileSize = preparedImage.m_file_size;
+
     auto* image = memory->Create<GfxImage>();
     memset(image, 0, sizeof(GfxImage));
 
@@ -55,15 +92,15 @@ bool AssetLoaderGfxImage::LoadFromRaw(
     image->hash = Common::R_HashString(image->name, 0);
     image->delayLoadPixels = true;
 
-    image->noPicmip = !texture->HasMipMaps();
-    image->width = static_cast<uint16_t>(texture->GetWidth());
-    image->height = static_cast<uint16_t>(texture->GetHeight());
-    image->depth = static_cast<uint16_t>(texture->GetDepth());
+    image->noPicmip = !iwiInfo.m_has_mip_maps;
+    image->width = static_cast<uint16_t>(iwiInfo.m_width);
+    image->height = static_cast<uint16_t>(iwiInfo.m_height);
+    image->depth = static_cast<uint16_t>(iwiInfo.m_depth);
 
     image->streaming = 1;
     image->streamedParts[0].levelCount = 1;
     image->streamedParts[0].levelSize = static_cast<uint32_t>(fileSize);
-    image->streamedParts[0].hash = dataHash & 0x1FFFFFFF;
+    image->streamedParts[0].hash = iwiInfo.m_data_hash & 0x1FFFFFFF;
     image->streamedPartCount = 1;
 
     manager->AddAsset<AssetImage>(assetName, image);
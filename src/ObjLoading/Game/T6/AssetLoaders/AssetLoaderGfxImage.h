@@ -13,5 +13,9 @@ namespace T6
         _NODISCARD bool CanLoadFromRaw() const override;
         bool
             LoadFromRaw(const std::string& assetName, ISearchPath* searchPath, MemoryManager* memory, IAssetLoadingManager* manager, Zone* zone) const override;
+        _NODISCARD bool CanPrepareFromRaw() const override;
+        _NODISCARD std::unique_ptr<IPreparedRawAsset> PrepareFromRaw(const std::string& assetName, ISearchPath* searchPath) const override;
+        bool LoadFromPrepared(
+            const std::string& assetName, IPreparedRawAsset& preparedAsset, MemoryManager* memory, IAssetLoadingManager* manager, Zone* zone) const override;
     };
 } // namespace T6
@@ -41,16 +41,36 @@ std::string AssetLoaderMaterial::GetFileNameForAsset(const std::string& assetNam
 
 bool AssetLoaderMaterial::LoadFromRaw(
     const std::string& assetName, ISearchPath* searchPath, MemoryManager* memory, IAssetLoadingManager* manager, Zone* zone) const
+{
+    const auto preparedMaterial = PrepareFromRaw(assetName, searchPath);
+    if (!preparedMaterial)
+        return false;
+
+    return LoadFromPrepared(assetName, *preparedMaterial, memory, manager, zone);
+}
+
+bool AssetLoaderMaterial::CanPrepareFromRaw() const
+{
+    return true;
+}
+
+std::unique_ptr<IPreparedRawAsset> AssetLoaderMaterial::PrepareFromRaw(const std::string& assetName, ISearchPath* searchPath) const
 {
     const auto file = searchPath->Open(GetFileNameForAsset(assetName));
     if (!file.IsOpen())
-        return false;
+        return nullptr;
 
+    return PrepareMaterialAsJson(*file.m_stream);
+}
+
+bool AssetLoaderMaterial::LoadFromPrepared(
+    const std::string& assetName, IPreparedRawAsset& preparedAsset, MemoryManager* memory, IAssetLoadingManager* manager, Zone* zone) const
+{
     auto* material = memory->Alloc<Material>();
     material->info.name = memory->Dup(assetName.c_str());
 
     std::vector<XAssetInfoGeneric*> dependencies;
-    if (LoadMaterialAsJson(*file.m_stream, *material, memory, manager, dependencies))
+    if (LoadMaterialAsJson(preparedAsset, *material, memory, manager, dependencies))
         manager->AddAsset<AssetMaterial>(assetName, material, std::move(dependencies));
     else
         std::cerr << "Failed to load material \"" << assetName << "\"\n";
@@ -40,9 +40,9 @@ namespace
         return soundFilePath;
     }
 
-    _NODISCARD std::unique_ptr<std::ofstream> OpenSoundBankOutputFile(const std::string& bankName)
+    _NODISCARD std::unique_ptr<std::ofstream> OpenSoundBankOutputFile(AssetLoadingContext& context, const std::string& bankName)
     {
-        fs::path assetPath = SoundBankWriter::OutputPath / bankName;
+        fs::path assetPath = context.m_output_folder / bankName;
 
         auto assetDir(assetPath);
         assetDir.remove_filename();
@@ -53,6 +53,9 @@ namespace
 
         if (outputStream->is_open())
         {
+            if (context.m_output_files)
+                context.m_output_files->emplace_back(std::move(assetPath));
+
             return std::move(outputStream);
         }
 
@@ -263,7 +266,7 @@ bool LoadSoundAliasIndexList(MemoryManager* memory, SndBank* sndBank)
 bool LoadSoundAliasList(
     MemoryManager* memory, SndBank* sndBank, const SearchPathOpenFile& file, unsigned int* loadedEntryCount, unsigned int* streamedEntryCount)
 {
-    const CsvInputStream aliasCsvStream(*file.m_stream);
+    CsvInputStream aliasCsvStream(*file.m_stream);
     const ParsedCsv aliasCsv(aliasCsvStream, true);
 
     // Ensure there is at least one entry in the csv after the headers
@@ -333,7 +336,7 @@ bool LoadSoundAliasList(
 
 bool LoadSoundRadverbs(MemoryManager* memory, SndBank* sndBank, const SearchPathOpenFile& file)
 {
-    const CsvInputStream radverbCsvStream(*file.m_stream);
+    CsvInputStream radverbCsvStream(*file.m_stream);
     const ParsedCsv radverbCsv(radverbCsvStream, true);
 
     if (radverbCsv.Size() > 0)
@@ -375,7 +378,7 @@ bool LoadSoundRadverbs(MemoryManager* memory, SndBank* sndBank, const SearchPath
 
 bool LoadSoundDuckList(ISearchPath* searchPath, MemoryManager* memory, SndBank* sndBank, const SearchPathOpenFile& file)
 {
-    const CsvInputStream duckListCsvStream(*file.m_stream);
+    CsvInputStream duckListCsvStream(*file.m_stream);
     const ParsedCsv duckListCsv(duckListCsvStream, true);
 
     if (duckListCsv.Size() > 0)
@@ -501,7 +504,7 @@ bool AssetLoaderSoundBank::LoadFromRaw(
         sndBank->runtimeAssetLoad = true;
 
         const auto sablName = assetName + ".sabl";
-        sablStream = OpenSoundBankOutputFile(sablName);
+        sablStream = OpenSoundBankOutputFile(*manager->GetAssetLoadingContext(), sablName);
         if (sablStream)
             sablWriter = SoundBankWriter::Create(sablName, *sablStream, searchPath);
     }
@@ -513,7 +516,7 @@ bool AssetLoaderSoundBank::LoadFromRaw(
         memset(sndBank->streamAssetBank.linkTimeChecksum, 0xCC, 16);
 
         const auto sabsName = assetName + ".sabs";
-        sabsStream = OpenSoundBankOutputFile(sabsName);
+        sabsStream = OpenSoundBankOutputFile(*manager->GetAssetLoadingContext(), sabsName);
         if (sabsStream)
             sabsWriter = SoundBankWriter::Create(sabsName, *sabsStream, searchPath);
     }
@@ -17,6 +17,16 @@
 
 using namespace T6;
 
+namespace
+{
+    class PreparedWeapon final : public IPreparedRawAsset
+    {
+    public:
+        bool m_parsed = false;
+        InfoString m_info_string;
+    };
+} // namespace
+
 namespace T6
 {
     class InfoStringToWeaponConverter final : public InfoStringToStructConverter
@@ -668,17 +678,39 @@ bool AssetLoaderWeapon::CanLoadFromRaw() const
 bool AssetLoaderWeapon::LoadFromRaw(
     const std::string& assetName, ISearchPath* searchPath, MemoryManager* memory, IAssetLoadingManager* manager, Zone* zone) const
 {
-    const auto fileName = "weapons/" + assetName;
-    const auto file = searchPath->Open(fileName);
-    if (!file.IsOpen())
+    const auto preparedWeapon = PrepareFromRaw(assetName, searchPath);
+    if (!preparedWeapon)
         return false;
 
-    InfoString infoString;
-    if (!infoString.FromStream(ObjConstants::INFO_STRING_PREFIX_WEAPON, *file.m_stream))
+    return LoadFromPrepared(assetName, *preparedWeapon, memory, manager, zone);
+}
+
+bool AssetLoaderWeapon::CanPrepareFromRaw() const
+{
+    return true;
+}
+
+std::unique_ptr<IPreparedRawAsset> AssetLoaderWeapon::PrepareFromRaw(const std::string& assetName, ISearchPath* searchPath) const
+{
+    const auto file = searchPath->Open("weapons/" + assetName);
+    if (!file.IsOpen())
+        return nullptr;
+
+    auto preparedWeapon = std::make_unique<PreparedWeapon>();
+    preparedWeapon->m_parsed = preparedWeapon->m_info_string.FromStream(ObjConstants::INFO_STRING_PREFIX_WEAPON, *file.m_stream);
+
+    return preparedWeapon;
+}
+
+bool AssetLoaderWeapon::LoadFromPrepared(
+    const std::string& assetName, IPreparedRawAsset& preparedAsset, MemoryManager* memory, IAssetLoadingManager* manager, Zone* zone) const
+{
+    const auto& preparedWeapon = dynamic_cast<const PreparedWeapon&>(preparedAsset);
+    if (!preparedWeapon.m_parsed)
     {
-        std::cerr << "Could not parse as info string file: \"" << fileName << "\"\n";
+        std::cerr << "Could not parse as info string file: \"weapons/" << assetName << "\"\n";
         return true;
     }
 
-    return LoadFromInfoString(infoString, assetName, memory, manager, zone);
+    return LoadFromInfoString(preparedWeapon.m_info_string, assetName, memory, manager, zone);
 }
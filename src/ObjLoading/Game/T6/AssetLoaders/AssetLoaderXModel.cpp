@@ -26,16 +26,36 @@ bool AssetLoaderXModel::CanLoadFromRaw() const
 
 bool AssetLoaderXModel::LoadFromRaw(
     const std::string& assetName, ISearchPath* searchPath, MemoryManager* memory, IAssetLoadingManager* manager, Zone* zone) const
+{
+    const auto preparedXModel = PrepareFromRaw(assetName, searchPath);
+    if (!preparedXModel)
+        return false;
+
+    return LoadFromPrepared(assetName, *preparedXModel, memory, manager, zone);
+}
+
+bool AssetLoaderXModel::CanPrepareFromRaw() const
+{
+    return true;
+}
+
+std::unique_ptr<IPreparedRawAsset> AssetLoaderXModel::PrepareFromRaw(const std::string& assetName, ISearchPath* searchPath) const
 {
     const auto file = searchPath->Open(std::format("xmodel/{}.json", assetName));
     if (!file.IsOpen())
-        return false;
+        return nullptr;
 
+    return PrepareXModelAsJson(*file.m_stream);
+}
+
+bool AssetLoaderXModel::LoadFromPrepared(
+    const std::string& assetName, IPreparedRawAsset& preparedAsset, MemoryManager* memory, IAssetLoadingManager* manager, Zone* zone) const
+{
     auto* xmodel = memory->Alloc<XModel>();
     xmodel->name = memory->Dup(assetName.c_str());
 
     std::vector<XAssetInfoGeneric*> dependencies;
-    if (LoadXModelAsJson(*file.m_stream, *xmodel, memory, manager, dependencies))
+    if (LoadXModelAsJson(preparedAsset, *xmodel, memory, manager, dependencies))
         manager->AddAsset<AssetXModel>(assetName, xmodel, std::move(dependencies));
     else
         std::cerr << "Failed to load xmodel \"" << assetName << "\"\n";
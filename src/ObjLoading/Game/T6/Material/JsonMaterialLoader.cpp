@@ -12,35 +12,52 @@ using namespace T6;
 
 namespace
 {
+    class PreparedJsonMaterial final : public IPreparedRawAsset
+    {
+    public:
+        bool m_has_expected_type = false;
+        JsonMaterial m_material;
+    };
+
     class JsonLoader
     {
     public:
-        JsonLoader(std::istream& stream, MemoryManager& memory, IAssetLoadingManager& manager, std::vector<XAssetInfoGeneric*>& dependencies)
-            : m_stream(stream),
-              m_memory(memory),
+        JsonLoader(MemoryManager& memory, IAssetLoadingManager& manager, std::vector<XAssetInfoGeneric*>& dependencies)
+            : m_memory(memory),
               m_manager(manager),
               m_dependencies(dependencies)
 
         {
         }
 
-        bool Load(Material& material) const
+        static std::unique_ptr<PreparedJsonMaterial> Prepare(std::istream& stream)
         {
-            const auto jRoot = json::parse(m_stream);
+            const auto jRoot = json::parse(stream);
             std::string type;
             unsigned version;
 
             jRoot.at("_type").get_to(type);
             jRoot.at("_version").get_to(version);
 
+            auto preparedMaterial = std::make_unique<PreparedJsonMaterial>();
             if (type != "material" || version != 1u)
+                return preparedMaterial;
+
+            preparedMaterial->m_has_expected_type = true;
+            preparedMaterial->m_material = jRoot.get<JsonMaterial>();
+
+            return preparedMaterial;
+        }
+
+        bool Load(const PreparedJsonMaterial& preparedMaterial, Material& material) const
+        {
+            if (!preparedMaterial.m_has_expected_type)
             {
                 std::cerr << "Tried to load material \"" << material.info.name << "\" but did not find expected type material of version 1\n";
                 return false;
             }
 
-            const auto jMaterial = jRoot.get<JsonMaterial>();
-            return CreateMaterialFromJson(jMaterial, material);
+            return CreateMaterialFromJson(preparedMaterial.m_material, material);
         }
 
     private:
@@ -354,7 +371,6 @@ namespace
             return true;
         }
 
-        std::istream& m_stream;
         MemoryManager& m_memory;
         IAssetLoadingManager& m_manager;
         std::vector<XAssetInfoGeneric*>& m_dependencies;
@@ -363,11 +379,19 @@ namespace
 
 namespace T6
 {
-    bool LoadMaterialAsJson(
-        std::istream& stream, Material& material, MemoryManager* memory, IAssetLoadingManager* manager, std::vector<XAssetInfoGeneric*>& dependencies)
+    std::unique_ptr<IPreparedRawAsset> PrepareMaterialAsJson(std::istream& stream)
+    {
+        return JsonLoader::Prepare(stream);
+    }
+
+    bool LoadMaterialAsJson(const IPreparedRawAsset& preparedMaterial,
+                            Material& material,
+                            MemoryManager* memory,
+                            IAssetLoadingManager* manager,
+                            std::vector<XAssetInfoGeneric*>& dependencies)
     {
-        const JsonLoader loader(stream, *memory, *manager, dependencies);
+        const JsonLoader loader(*memory, *manager, dependencies);
 
-        return loader.Load(material);
+        return loader.Load(dynamic_cast<const PreparedJsonMaterial&>(preparedMaterial), material);
     }
 } // namespace T6
@@ -1,13 +1,23 @@
 #pragma once
 
 #include "AssetLoading/IAssetLoadingManager.h"
+#include "AssetLoading/IPreparedRawAsset.h"
 #include "Game/T6/T6.h"
 #include "Utils/MemoryManager.h"
 
 #include <istream>
+#include <memory>
 
 namespace T6
 {
-    bool LoadMaterialAsJson(
-        std::istream& stream, Material& material, MemoryManager* memory, IAssetLoadingManager* manager, std::vector<XAssetInfoGeneric*>& dependencies);
+    /**
+     * \brief Parses a material json file. Does not access the zone, so it can be done ahead of loading the material on any thread.
+     */
+    std::unique_ptr<IPreparedRawAsset> PrepareMaterialAsJson(std::istream& stream);
+
+    bool LoadMaterialAsJson(const IPreparedRawAsset& preparedMaterial,
+                            Material& material,
+                            MemoryManager* memory,
+                            IAssetLoadingManager* manager,
+                            std::vector<XAssetInfoGeneric*>& dependencies);
 } // namespace T6
@@ -237,7 +237,7 @@ namespace T6
         auto file = searchPath->Open(ipakFilename);
         if (file.IsOpen())
         {
-            auto ipak = std::make_unique<IPak>(ipakFilename, std::move(file.m_stream));
+            auto ipak = std::make_unique<IPak>(ipakFilename, std::move(file.m_stream), file.m_disk_path);
 
             if (ipak->Initialize())
             {
@@ -459,6 +459,12 @@ namespace T6
         LoadImageData(searchPath, zone);
     }
 
+    void ObjLoader::PrepareAssetForZone(AssetLoadingContext* context, const asset_type_t assetType, const std::string& assetName) const
+    {
+        AssetLoadingManager assetLoadingManager(m_asset_loaders_by_type, *context);
+        assetLoadingManager.PrepareAssetFromLoader(assetType, assetName);
+    }
+
     bool ObjLoader::LoadAssetForZone(AssetLoadingContext* context, const asset_type_t assetType, const std::string& assetName) const
     {
         AssetLoadingManager assetLoadingManager(m_asset_loaders_by_type, *context);
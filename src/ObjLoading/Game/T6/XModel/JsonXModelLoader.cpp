@@ -13,35 +13,52 @@ using namespace T6;
 
 namespace
 {
+    class PreparedJsonXModel final : public IPreparedRawAsset
+    {
+    public:
+        bool m_has_expected_type = false;
+        JsonXModel m_xmodel;
+    };
+
     class JsonLoader
     {
     public:
-        JsonLoader(std::istream& stream, MemoryManager& memory, IAssetLoadingManager& manager, std::set<XAssetInfoGeneric*>& dependencies)
-            : m_stream(stream),
-              m_memory(memory),
+        JsonLoader(MemoryManager& memory, IAssetLoadingManager& manager, std::set<XAssetInfoGeneric*>& dependencies)
+            : m_memory(memory),
               m_manager(manager),
               m_dependencies(dependencies)
 
         {
         }
 
-        bool Load(XModel& xmodel) const
+        static std::unique_ptr<PreparedJsonXModel> Prepare(std::istream& stream)
         {
-            const auto jRoot = json::parse(m_stream);
+            const auto jRoot = json::parse(stream);
             std::string type;
             unsigned version;
 
             jRoot.at("_type").get_to(type);
             jRoot.at("_version").get_to(version);
 
+            auto preparedXModel = std::make_unique<PreparedJsonXModel>();
             if (type != "xmodel" || version != 1u)
+                return preparedXModel;
+
+            preparedXModel->m_has_expected_type = true;
+            preparedXModel->m_xmodel = jRoot.get<JsonXModel>();
+
+            return preparedXModel;
+        }
+
+        bool Load(const PreparedJsonXModel& preparedXModel, XModel& xmodel) const
+        {
+            if (!preparedXModel.m_has_expected_type)
             {
                 std::cerr << "Tried to load xmodel \"" << xmodel.name << "\" but did not find expected type material of version 1\n";
                 return false;
             }
 
-            const auto jXModel = jRoot.get<JsonXModel>();
-            return CreateXModelFromJson(jXModel, xmodel);
+            return CreateXModelFromJson(preparedXModel.m_xmodel, xmodel);
         }
 
     private:
@@ -95,7 +112,6 @@ namespace
             return true;
         }
 
-        std::istream& m_stream;
         MemoryManager& m_memory;
         IAssetLoadingManager& m_manager;
         std::set<XAssetInfoGeneric*>& m_dependencies;
@@ -104,14 +120,22 @@ namespace
 
 namespace T6
 {
-    bool LoadXModelAsJson(
-        std::istream& stream, XModel& xmodel, MemoryManager* memory, IAssetLoadingManager* manager, std::vector<XAssetInfoGeneric*>& dependencies)
+    std::unique_ptr<IPreparedRawAsset> PrepareXModelAsJson(std::istream& stream)
+    {
+        return JsonLoader::Prepare(stream);
+    }
+
+    bool LoadXModelAsJson(const IPreparedRawAsset& preparedXModel,
+                          XModel& xmodel,
+                          MemoryManager* memory,
+                          IAssetLoadingManager* manager,
+                          std::vector<XAssetInfoGeneric*>& dependencies)
     {
         std::set<XAssetInfoGeneric*> dependenciesSet;
-        const JsonLoader loader(stream, *memory, *manager, dependenciesSet);
+        const JsonLoader loader(*memory, *manager, dependenciesSet);
 
         dependencies.assign(dependenciesSet.cbegin(), dependenciesSet.cend());
 
-        return loader.Load(xmodel);
+        return loader.Load(dynamic_cast<const PreparedJsonXModel&>(preparedXModel), xmodel);
     }
 } // namespace T6
@@ -1,13 +1,23 @@
 #pragma once
 
 #include "AssetLoading/IAssetLoadingManager.h"
+#include "AssetLoading/IPreparedRawAsset.h"
 #include "Game/T6/T6.h"
 #include "Utils/MemoryManager.h"
 
 #include <istream>
+#include <memory>
 
 namespace T6
 {
-    bool LoadXModelAsJson(
-        std::istream& stream, XModel& xmodel, MemoryManager* memory, IAssetLoadingManager* manager, std::vector<XAssetInfoGeneric*>& dependencies);
+    /**
+     * \brief Parses an xmodel json file. Does not access the zone, so it can be done ahead of loading the xmodel on any thread.
+     */
+    std::unique_ptr<IPreparedRawAsset> PrepareXModelAsJson(std::istream& stream);
+
+    bool LoadXModelAsJson(const IPreparedRawAsset& preparedXModel,
+                          XModel& xmodel,
+                          MemoryManager* memory,
+                          IAssetLoadingManager* manager,
+                          std::vector<XAssetInfoGeneric*>& dependencies);
 } // namespace T6
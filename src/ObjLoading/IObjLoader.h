@@ -36,6 +36,14 @@ public:
      */
     virtual void LoadObjDataForZone(ISearchPath* searchPath, Zone* zone) const = 0;
 
+    /**
+     * \brief Starts reading and parsing the raw files of an asset ahead of loading it, if the asset loading context has a thread pool for that.
+     * \param context The context of the zone the asset is loaded for later on.
+     * \param assetType The type of the asset.
+     * \param assetName The name of the asset.
+     */
+    virtual void PrepareAssetForZone(AssetLoadingContext* context, asset_type_t assetType, const std::string& assetName) const = 0;
+
     virtual bool LoadAssetForZone(AssetLoadingContext* context, asset_type_t assetType, const std::string& assetName) const = 0;
     virtual void FinalizeAssetsForZone(AssetLoadingContext* context) const = 0;
 };
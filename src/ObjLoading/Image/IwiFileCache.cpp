@@ -0,0 +1,156 @@
+#include "IwiFileCache.h"
+
+#include "IwiLoader.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <sstream>
+#include <zlib.h>
+
+namespace fs = std::filesystem;
+
+IwiFileInfo::IwiFileInfo()
+    : m_width(0u),
+      m_height(0u),
+      m_depth(0u),
+      m_has_mip_maps(false),
+      m_data_hash(0u)
+{
+}
+
+bool IwiFileCache::Key::operator==(const Key& other) const
+{
+    return m_disk_path == other.m_disk_path && m_size == other.m_size && m_last_write_time == other.m_last_write_time;
+}
+
+size_t IwiFileCache::KeyHash::operator()(const Key& key) const noexcept
+{
+    auto hash = std::hash<std::string>()(key.m_disk_path);
+    hash ^= std::hash<int64_t>()(key.m_size) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<int64_t>()(key.m_last_write_time) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+
+    return hash;
+}
+
+bool IwiFileCache::MakeKey(const SearchPathOpenFile& file, Key& key)
+{
+    if (file.m_disk_path.empty())
+        return false;
+
+    std::error_code ec;
+    const auto lastWriteTime = fs::last_write_time(file.m_disk_path, ec);
+    if (ec)
+        return false;
+
+    key.m_disk_path = file.m_disk_path;
+    key.m_size = file.m_length;
+    key.m_last_write_time = static_cast<int64_t>(lastWriteTime.time_since_epoch().count());
+
+    return true;
+}
+
+bool IwiFileCache::FindEntry(const Key& key, Entry& entry)
+{
+    std::lock_guard lock(m_mutex);
+
+    const auto existingEntry = m_entries.find(key);
+    if (existingEntry == m_entries.end())
+        return false;
+
+    entry = existingEntry->second;
+    return true;
+}
+
+void IwiFileCache::UpdateEntry(const Key& key, const Entry& entry)
+{
+    std::lock_guard lock(m_mutex);
+
+    auto& existingEntry = m_entries[key];
+    if (entry.m_has_header)
+    {
+        existingEntry.m_info.m_width = entry.m_info.m_width;
+        existingEntry.m_info.m_height = entry.m_info.m_height;
+        existingEntry.m_info.m_depth = entry.m_info.m_depth;
+        existingEntry.m_info.m_has_mip_maps = entry.m_info.m_has_mip_maps;
+        existingEntry.m_has_header = true;
+    }
+
+    if (entry.m_has_data_hash)
+    {
+        existingEntry.m_info.m_data_hash = entry.m_info.m_data_hash;
+        existingEntry.m_has_data_hash = true;
+    }
+}
+
+bool IwiFileCache::GetFileInfo(const SearchPathOpenFile& file, IwiFileInfo& info)
+{
+    Key key;
+    Entry entry;
+    const auto isCacheable = MakeKey(file, key);
+
+    if (isCacheable && FindEntry(key, entry) && entry.m_has_header && entry.m_has_data_hash)
+    {
+        info = entry.m_info;
+        return true;
+    }
+
+    if (!ReadFileInfo(file, entry.m_info))
+        return false;
+
+    entry.m_has_header = true;
+    entry.m_has_data_hash = true;
+
+    if (isCacheable)
+        UpdateEntry(key, entry);
+
+    info = entry.m_info;
+    return true;
+}
+
+unsigned IwiFileCache::GetDataHash(const SearchPathOpenFile& file, const void* data, const size_t dataSize)
+{
+    Key key;
+    Entry entry;
+    const auto isCacheable = MakeKey(file, key);
+
+    if (isCacheable && FindEntry(key, entry) && entry.m_has_data_hash)
+        return entry.m_info.m_data_hash;
+
+    entry.m_info.m_data_hash = HashData(data, dataSize);
+    entry.m_has_data_hash = true;
+
+    if (isCacheable)
+        UpdateEntry(key, entry);
+
+    return entry.m_info.m_data_hash;
+}
+
+bool IwiFileCache::ReadFileInfo(const SearchPathOpenFile& file, IwiFileInfo& info)
+{
+    // Probing the header checks the size of the file by seeking to its end, after which hashing it would have to seek back to its start.
+    // Reading the file into memory once instead avoids inflating files from iwds twice.
+    std::string data(static_cast<size_t>(std::max<int64_t>(file.m_length, 0)), '\0');
+    file.m_stream->read(data.data(), static_cast<std::streamsize>(data.size()));
+    data.resize(static_cast<size_t>(file.m_stream->gcount()));
+
+    info.m_data_hash = HashData(data.data(), data.size());
+
+    MemoryManager tempMemory;
+    IwiLoader iwiLoader(&tempMemory);
+    std::istringstream dataStream(std::move(data));
+    const auto* texture = iwiLoader.LoadIwiHeader(dataStream);
+    if (!texture)
+        return false;
+
+    info.m_width = texture->GetWidth();
+    info.m_height = texture->GetHeight();
+    info.m_depth = texture->GetDepth();
+    info.m_has_mip_maps = texture->HasMipMaps();
+
+    return true;
+}
+
+unsigned IwiFileCache::HashData(const void* data, const size_t dataSize)
+{
+    return static_cast<unsigned>(crc32(0u, static_cast<const Bytef*>(data), static_cast<uInt>(dataSize)));
+}
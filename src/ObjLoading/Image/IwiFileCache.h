@@ -0,0 +1,108 @@
+#pragma once
+
+#include "SearchPath/ISearchPath.h"
+#include "Utils/ClassUtils.h"
+
+#include <cstdint>
+#include <istream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+class IwiFileInfo
+{
+public:
+    unsigned m_width;
+    unsigned m_height;
+    unsigned m_depth;
+    bool m_has_mip_maps;
+
+    /**
+     * \brief The crc32 of the entire iwi file.
+     */
+    unsigned m_data_hash;
+
+    IwiFileInfo();
+};
+
+/**
+ * \brief Remembers the header and data hash of iwi files on disk so each file is probed and hashed at most once while building.
+ * Files are identified by their path on disk, their size and their last write time. Files that are not on disk are never cached.
+ * The linker owns one cache per run and makes it available via \c ObjLoading::Configuration.ImageFileCache.
+ */
+class IwiFileCache
+{
+    class Key
+    {
+    public:
+        std::string m_disk_path;
+        int64_t m_size;
+        int64_t m_last_write_time;
+
+        bool operator==(const Key& other) const;
+    };
+
+    class KeyHash
+    {
+    public:
+        size_t operator()(const Key& key) const noexcept;
+    };
+
+    class Entry
+    {
+    public:
+        IwiFileInfo m_info;
+        bool m_has_header = false;
+        bool m_has_data_hash = false;
+    };
+
+    std::mutex m_mutex;
+    std::unordered_map<Key, Entry, KeyHash> m_entries;
+
+    static bool MakeKey(const SearchPathOpenFile& file, Key& key);
+
+    bool FindEntry(const Key& key, Entry& entry);
+    void UpdateEntry(const Key& key, const Entry& entry);
+
+public:
+    IwiFileCache() = default;
+    ~IwiFileCache() = default;
+    IwiFileCache(const IwiFileCache& other) = delete;
+    IwiFileCache(IwiFileCache&& other) noexcept = delete;
+    IwiFileCache& operator=(const IwiFileCache& other) = delete;
+    IwiFileCache& operator=(IwiFileCache&& other) noexcept = delete;
+
+    /**
+     * \brief Gets the header and data hash of an iwi file without decoding its pixel data.
+     * \param file The opened iwi file. Its stream is read when the file is not cached yet.
+     * \param info The information about the iwi file.
+     * \return \c true if the file is a valid iwi, \c false otherwise.
+     */
+    _NODISCARD bool GetFileInfo(const SearchPathOpenFile& file, IwiFileInfo& info);
+
+    /**
+     * \brief Gets the crc32 of an iwi file whose data was already read.
+     * \param file The opened iwi file.
+     * \param data The entire data of the file.
+     * \param dataSize The size of the data of the file.
+     * \return The crc32 of the data of the file.
+     */
+    _NODISCARD unsigned GetDataHash(const SearchPathOpenFile& file, const void* data, size_t dataSize);
+
+    /**
+     * \brief Gets the header and data hash of an iwi file without a cache.
+     * The file is read exactly once, so files that need to be inflated, like ones in iwds, are not inflated again for hashing them.
+     * \param file The opened iwi file. Its stream is read from its current position to its end.
+     * \param info The information about the iwi file.
+     * \return \c true if the file is a valid iwi, \c false otherwise.
+     */
+    _NODISCARD static bool ReadFileInfo(const SearchPathOpenFile& file, IwiFileInfo& info);
+
+    /**
+     * \brief Gets the crc32 of the data of an iwi file without a cache.
+     * \param data The entire data of the file.
+     * \param dataSize The size of the data of the file.
+     * \return The crc32 of the data of the file.
+     */
+    _NODISCARD static unsigned HashData(const void* data, size_t dataSize);
+};
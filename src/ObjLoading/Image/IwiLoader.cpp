@@ -47,7 +47,7 @@ const ImageFormat* IwiLoader::GetFormat6(int8_t format)
     return nullptr;
 }
 
-Texture* IwiLoader::LoadIwi6(std::istream& stream) const
+Texture* IwiLoader::LoadIwi6(std::istream& stream, const bool headerOnly) const
 {
     iwi6::IwiHeader header{};
 
@@ -78,7 +78,8 @@ Texture* IwiLoader::LoadIwi6(std::istream& stream) const
         texture = m_memory_manager->Create<Texture2D>(format, width, height, hasMipMaps);
     }
 
-    texture->Allocate();
+    if (!headerOnly)
+        texture->Allocate();
 
     auto currentFileSize = sizeof(iwi6::IwiHeader) + sizeof(IwiVersion);
     const auto mipMapCount = hasMipMaps ? texture->GetMipMapCount() : 1;
@@ -97,6 +98,9 @@ Texture* IwiLoader::LoadIwi6(std::istream& stream) const
             return nullptr;
         }
 
+        if (headerOnly)
+            continue;
+
         stream.read(reinterpret_cast<char*>(texture->GetBufferForMipLevel(currentMipLevel)), sizeOfMipLevel);
         if (stream.gcount() != sizeOfMipLevel)
         {
@@ -107,6 +111,14 @@ Texture* IwiLoader::LoadIwi6(std::istream& stream) const
         }
     }
 
+    if (headerOnly && !HasRemainingSize(stream, currentFileSize - sizeof(IwiVersion) - sizeof(header)))
+    {
+        printf("Unexpected eof of iwi\n");
+
+        m_memory_manager->Delete(texture);
+        return nullptr;
+    }
+
     return texture;
 }
 
@@ -155,7 +167,7 @@ const ImageFormat* IwiLoader::GetFormat8(int8_t format)
     return nullptr;
 }
 
-Texture* IwiLoader::LoadIwi8(std::istream& stream) const
+Texture* IwiLoader::LoadIwi8(std::istream& stream, const bool headerOnly) const
 {
     iwi8::IwiHeader header{};
 
@@ -196,7 +208,8 @@ Texture* IwiLoader::LoadIwi8(std::istream& stream) const
         return nullptr;
     }
 
-    texture->Allocate();
+    if (!headerOnly)
+        texture->Allocate();
 
     auto currentFileSize = sizeof(iwi8::IwiHeader) + sizeof(IwiVersion);
     const auto mipMapCount = hasMipMaps ? texture->GetMipMapCount() : 1;
@@ -215,6 +228,9 @@ Texture* IwiLoader::LoadIwi8(std::istream& stream) const
             return nullptr;
         }
 
+        if (headerOnly)
+            continue;
+
         stream.read(reinterpret_cast<char*>(texture->GetBufferForMipLevel(currentMipLevel)), sizeOfMipLevel);
         if (stream.gcount() != sizeOfMipLevel)
         {
@@ -225,6 +241,14 @@ Texture* IwiLoader::LoadIwi8(std::istream& stream) const
         }
     }
 
+    if (headerOnly && !HasRemainingSize(stream, currentFileSize - sizeof(IwiVersion) - sizeof(header)))
+    {
+        printf("Unexpected eof of iwi\n");
+
+        m_memory_manager->Delete(texture);
+        return nullptr;
+    }
+
     return texture;
 }
 
@@ -270,7 +294,7 @@ const ImageFormat* IwiLoader::GetFormat13(int8_t format)
     return nullptr;
 }
 
-Texture* IwiLoader::LoadIwi13(std::istream& stream) const
+Texture* IwiLoader::LoadIwi13(std::istream& stream, const bool headerOnly) const
 {
     iwi13::IwiHeader header{};
 
@@ -301,7 +325,8 @@ Texture* IwiLoader::LoadIwi13(std::istream& stream) const
         texture = m_memory_manager->Create<Texture2D>(format, width, height, hasMipMaps);
     }
 
-    texture->Allocate();
+    if (!headerOnly)
+        texture->Allocate();
 
     auto currentFileSize = sizeof(iwi13::IwiHeader) + sizeof(IwiVersion);
     const auto mipMapCount = hasMipMaps ? texture->GetMipMapCount() : 1;
@@ -320,6 +345,9 @@ Texture* IwiLoader::LoadIwi13(std::istream& stream) const
             return nullptr;
         }
 
+        if (headerOnly)
+            continue;
+
         stream.read(reinterpret_cast<char*>(texture->GetBufferForMipLevel(currentMipLevel)), sizeOfMipLevel);
         if (stream.gcount() != sizeOfMipLevel)
         {
@@ -330,6 +358,14 @@ Texture* IwiLoader::LoadIwi13(std::istream& stream) const
         }
     }
 
+    if (headerOnly && !HasRemainingSize(stream, currentFileSize - sizeof(IwiVersion) - sizeof(header)))
+    {
+        printf("Unexpected eof of iwi\n");
+
+        m_memory_manager->Delete(texture);
+        return nullptr;
+    }
+
     return texture;
 }
 
@@ -377,7 +413,7 @@ const ImageFormat* IwiLoader::GetFormat27(int8_t format)
     return nullptr;
 }
 
-Texture* IwiLoader::LoadIwi27(std::istream& stream) const
+Texture* IwiLoader::LoadIwi27(std::istream& stream, const bool headerOnly) const
 {
     iwi27::IwiHeader header{};
 
@@ -408,7 +444,8 @@ Texture* IwiLoader::LoadIwi27(std::istream& stream) const
         texture = m_memory_manager->Create<Texture2D>(format, width, height, hasMipMaps);
     }
 
-    texture->Allocate();
+    if (!headerOnly)
+        texture->Allocate();
 
     auto currentFileSize = sizeof(iwi27::IwiHeader) + sizeof(IwiVersion);
     const auto mipMapCount = hasMipMaps ? texture->GetMipMapCount() : 1;
@@ -427,6 +464,9 @@ Texture* IwiLoader::LoadIwi27(std::istream& stream) const
             return nullptr;
         }
 
+        if (headerOnly)
+            continue;
+
         stream.read(reinterpret_cast<char*>(texture->GetBufferForMipLevel(currentMipLevel)), sizeOfMipLevel);
         if (stream.gcount() != sizeOfMipLevel)
         {
@@ -437,10 +477,38 @@ Texture* IwiLoader::LoadIwi27(std::istream& stream) const
         }
     }
 
+    if (headerOnly && !HasRemainingSize(stream, currentFileSize - sizeof(IwiVersion) - sizeof(header)))
+    {
+        printf("Unexpected eof of iwi\n");
+
+        m_memory_manager->Delete(texture);
+        return nullptr;
+    }
+
     return texture;
 }
 
+bool IwiLoader::HasRemainingSize(std::istream& stream, const size_t size)
+{
+    const auto currentPosition = stream.tellg();
+    stream.seekg(0, std::ios::end);
+    const auto endPosition = stream.tellg();
+    stream.seekg(currentPosition, std::ios::beg);
+
+    return currentPosition >= 0 && endPosition >= currentPosition && static_cast<size_t>(endPosition - currentPosition) >= size;
+}
+
 Texture* IwiLoader::LoadIwi(std::istream& stream)
+{
+    return LoadIwi(stream, false);
+}
+
+Texture* IwiLoader::LoadIwiHeader(std::istream& stream)
+{
+    return LoadIwi(stream, true);
+}
+
+Texture* IwiLoader::LoadIwi(std::istream& stream, const bool headerOnly)
 {
     IwiVersion iwiVersion{};
 
@@ -456,16 +524,16 @@ Texture* IwiLoader::LoadIwi(std::istream& stream)
     switch (iwiVersion.version)
     {
     case 6:
-        return LoadIwi6(stream);
+        return LoadIwi6(stream, headerOnly);
 
     case 8:
-        return LoadIwi8(stream);
+        return LoadIwi8(stream, headerOnly);
 
     case 13:
-        return LoadIwi13(stream);
+        return LoadIwi13(stream, headerOnly);
 
     case 27:
-        return LoadIwi27(stream);
+        return LoadIwi27(stream, headerOnly);
 
     default:
         break;
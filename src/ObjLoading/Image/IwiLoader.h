@@ -10,19 +10,29 @@ class IwiLoader
     MemoryManager* m_memory_manager;
 
     static const ImageFormat* GetFormat6(int8_t format);
-    Texture* LoadIwi6(std::istream& stream) const;
+    Texture* LoadIwi6(std::istream& stream, bool headerOnly) const;
 
     static const ImageFormat* GetFormat8(int8_t format);
-    Texture* LoadIwi8(std::istream& stream) const;
+    Texture* LoadIwi8(std::istream& stream, bool headerOnly) const;
 
     static const ImageFormat* GetFormat13(int8_t format);
-    Texture* LoadIwi13(std::istream& stream) const;
+    Texture* LoadIwi13(std::istream& stream, bool headerOnly) const;
 
     static const ImageFormat* GetFormat27(int8_t format);
-    Texture* LoadIwi27(std::istream& stream) const;
+    Texture* LoadIwi27(std::istream& stream, bool headerOnly) const;
+
+    static bool HasRemainingSize(std::istream& stream, size_t size);
+    Texture* LoadIwi(std::istream& stream, bool headerOnly);
 
 public:
     explicit IwiLoader(MemoryManager* memoryManager);
 
     Texture* LoadIwi(std::istream& stream);
+
+    /**
+     * \brief Loads the format, dimensions and mip map layout of an iwi without reading its pixel data.
+     * \param stream The stream to read the iwi from. Must be seekable to validate the size of the pixel data.
+     * \return A texture without allocated data or \c nullptr if the iwi is invalid.
+     */
+    Texture* LoadIwiHeader(std::istream& stream);
 };
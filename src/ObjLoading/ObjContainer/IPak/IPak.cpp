@@ -6,6 +6,7 @@
 #include "Utils/FileUtils.h"
 #include "zlib.h"
 
+#include <algorithm>
 #include <filesystem>
 #include <memory>
 #include <sstream>
@@ -41,19 +42,26 @@ class IPak::Impl : public ObjContainerReferenceable
 
     bool ReadIndexSection()
     {
+        // The entry count is read from the file, so it must not be trusted before allocating memory for the entries
+        m_stream->seekg(0, std::ios::end);
+        const auto streamSize = static_cast<int64_t>(m_stream->tellg());
+        const auto indexOffset = static_cast<int64_t>(m_index_section->offset);
+        if (streamSize < indexOffset
+            || static_cast<uint64_t>(m_index_section->itemCount) > static_cast<uint64_t>(streamSize - indexOffset) / sizeof(IPakIndexEntry))
+        {
+            printf("Index section with %u entries exceeds the size of the ipak.\n", m_index_section->itemCount);
+            return false;
+        }
+
         m_stream->seekg(m_index_section->offset);
-        IPakIndexEntry indexEntry{};
 
-        for (unsigned itemIndex = 0; itemIndex < m_index_section->itemCount; itemIndex++)
+        m_index_entries.resize(m_index_section->itemCount);
+        const auto indexSize = static_cast<std::streamsize>(sizeof(IPakIndexEntry) * m_index_entries.size());
+        m_stream->read(reinterpret_cast<char*>(m_index_entries.data()), indexSize);
+        if (m_stream->gcount() != indexSize)
         {
-            m_stream->read(reinterpret_cast<char*>(&indexEntry), sizeof(indexEntry));
-            if (m_stream->gcount() != sizeof(indexEntry))
-            {
-                printf("Unexpected eof when trying to load index entry %u.\n", itemIndex);
-                return false;
-            }
-
-            m_index_entries.push_back(indexEntry);
+            printf("Unexpected eof when trying to load index entry %u.\n", static_cast<unsigned>(m_stream->gcount() / sizeof(IPakIndexEntry)));
+            return false;
         }
 
         std::ranges::sort(m_index_entries,
@@ -141,13 +149,13 @@ class IPak::Impl : public ObjContainerReferenceable
     }
 
 public:
-    Impl(std::string path, std::unique_ptr<std::istream> stream)
+    Impl(std::string path, std::unique_ptr<std::istream> stream, const std::string& diskPath)
         : m_path(std::move(path)),
           m_stream(std::move(stream)),
           m_initialized(false),
           m_index_section(nullptr),
           m_data_section(nullptr),
-          m_stream_manager(*m_stream)
+          m_stream_manager(*m_stream, diskPath)
     {
     }
 
@@ -176,20 +184,18 @@ public:
         wantedKey.nameHash = nameHash;
         wantedKey.dataHash = dataHash;
 
-        for (auto& entry : m_index_entries)
-        {
-            if (entry.key.combinedKey == wantedKey.combinedKey)
-            {
-                return m_stream_manager.OpenStream(static_cast<int64_t>(m_data_section->offset) + entry.offset, entry.size);
-            }
-            else if (entry.key.combinedKey > wantedKey.combinedKey)
-            {
-                // The index entries are sorted so if the current entry is higher than the wanted entry we can cancel here
-                return nullptr;
-            }
-        }
+        const auto entry = std::ranges::lower_bound(m_index_entries,
+                                                    wantedKey.combinedKey,
+                                                    std::less(),
+                                                    [](const IPakIndexEntry& indexEntry)
+                                                    {
+                                                        return indexEntry.key.combinedKey;
+                                                    });
+
+        if (entry == m_index_entries.end() || entry->key.combinedKey != wantedKey.combinedKey)
+            return nullptr;
 
-        return nullptr;
+        return m_stream_manager.OpenStream(static_cast<int64_t>(m_data_section->offset) + entry->offset, entry->size);
     }
 
     static Hash HashString(const std::string& str)
@@ -204,8 +210,13 @@ public:
 };
 
 IPak::IPak(std::string path, std::unique_ptr<std::istream> stream)
+    : IPak(std::move(path), std::move(stream), std::string())
+{
+}
+
+IPak::IPak(std::string path, std::unique_ptr<std::istream> stream, const std::string& diskPath)
 {
-    m_impl = new Impl(std::move(path), std::move(stream));
+    m_impl = new Impl(std::move(path), std::move(stream), diskPath);
 }
 
 IPak::~IPak()
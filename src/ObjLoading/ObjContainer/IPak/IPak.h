@@ -19,6 +19,13 @@ public:
     static ObjContainerRepository<IPak, Zone> Repository;
 
     IPak(std::string path, std::unique_ptr<std::istream> stream);
+
+    /**
+     * \param path The path of the ipak.
+     * \param stream The stream to read the ipak from.
+     * \param diskPath The path of the ipak file on disk if it is available. Allows reading entries concurrently from a memory mapping of the file.
+     */
+    IPak(std::string path, std::unique_ptr<std::istream> stream, const std::string& diskPath);
     ~IPak() override;
 
     std::string GetName() override;
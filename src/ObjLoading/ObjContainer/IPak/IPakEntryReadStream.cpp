@@ -8,11 +8,10 @@
 
 using namespace ipak_consts;
 
-IPakEntryReadStream::IPakEntryReadStream(
-    std::istream& stream, IPakStreamManagerActions* streamManagerActions, uint8_t* chunkBuffer, const int64_t startOffset, const size_t entrySize)
+IPakEntryReadStream::IPakEntryReadStream(IPakStreamManagerActions* streamManagerActions, uint8_t* chunkBuffer, const int64_t startOffset, const size_t entrySize)
     : m_chunk_buffer(chunkBuffer),
-      m_stream(stream),
       m_stream_manager_actions(streamManagerActions),
+      m_open(true),
       m_file_offset(0),
       m_file_head(0),
       m_entry_size(entrySize),
@@ -38,13 +37,7 @@ IPakEntryReadStream::~IPakEntryReadStream()
 
 size_t IPakEntryReadStream::ReadChunks(uint8_t* buffer, const int64_t startPos, const size_t chunkCount) const
 {
-    m_stream_manager_actions->StartReading();
-
-    m_stream.seekg(startPos);
-    m_stream.read(reinterpret_cast<char*>(buffer), static_cast<std::streamsize>(chunkCount) * IPAK_CHUNK_SIZE);
-    const auto readSize = static_cast<size_t>(m_stream.gcount());
-
-    m_stream_manager_actions->StopReading();
+    const auto readSize = m_stream_manager_actions->ReadData(buffer, startPos, chunkCount * IPAK_CHUNK_SIZE);
 
     return readSize / IPAK_CHUNK_SIZE;
 }
@@ -263,14 +256,15 @@ bool IPakEntryReadStream::AdvanceStream()
 
 bool IPakEntryReadStream::is_open() const
 {
-    return !m_stream.eof();
+    return m_open;
 }
 
 bool IPakEntryReadStream::close()
 {
-    if (is_open())
+    if (m_open)
     {
         m_stream_manager_actions->CloseStream(this);
+        m_open = false;
     }
 
     return true;
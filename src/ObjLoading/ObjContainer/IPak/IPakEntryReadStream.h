@@ -4,16 +4,14 @@
 #include "ObjContainer/IPak/IPakTypes.h"
 #include "Utils/ObjStream.h"
 
-#include <istream>
-
 class IPakEntryReadStream final : public objbuf
 {
     static constexpr size_t IPAK_DECOMPRESS_BUFFER_SIZE = 0x8000;
 
     uint8_t* m_chunk_buffer;
 
-    std::istream& m_stream;
     IPakStreamManagerActions* m_stream_manager_actions;
+    bool m_open;
 
     int64_t m_file_offset;
     int64_t m_file_head;
@@ -96,7 +94,7 @@ class IPakEntryReadStream final : public objbuf
     bool AdvanceStream();
 
 public:
-    IPakEntryReadStream(std::istream& stream, IPakStreamManagerActions* streamManagerActions, uint8_t* chunkBuffer, int64_t startOffset, size_t entrySize);
+    IPakEntryReadStream(IPakStreamManagerActions* streamManagerActions, uint8_t* chunkBuffer, int64_t startOffset, size_t entrySize);
     ~IPakEntryReadStream() override;
 
     _NODISCARD bool is_open() const override;
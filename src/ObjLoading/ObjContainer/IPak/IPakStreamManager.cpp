@@ -2,8 +2,10 @@
 
 #include "IPakEntryReadStream.h"
 #include "ObjContainer/IPak/IPakTypes.h"
+#include "Utils/MemoryMappedFile.h"
 
 #include <algorithm>
+#include <cstring>
 #include <vector>
 
 using namespace ipak_consts;
@@ -34,6 +36,9 @@ class IPakStreamManager::Impl final : public IPakStreamManagerActions
 
     std::istream& m_stream;
 
+    // Entries are read from the mapping without locking when the ipak could be mapped.
+    // Otherwise reads seek on the shared stream and need to be serialized.
+    MemoryMappedFile m_mapped_file;
     std::mutex m_read_mutex;
     std::mutex m_stream_mutex;
 
@@ -41,9 +46,12 @@ class IPakStreamManager::Impl final : public IPakStreamManagerActions
     std::vector<ChunkBuffer*> m_chunk_buffers;
 
 public:
-    explicit Impl(std::istream& stream)
+    Impl(std::istream& stream, const std::string& diskPath)
         : m_stream(stream)
     {
+        if (!diskPath.empty())
+            m_mapped_file.Open(diskPath);
+
         m_chunk_buffers.push_back(new ChunkBuffer());
     }
 
@@ -85,7 +93,7 @@ public:
         else
             reservedChunkBuffer = *freeChunkBuffer;
 
-        auto ipakEntryStream = std::make_unique<IPakEntryReadStream>(m_stream, this, reservedChunkBuffer->m_buffer, startPosition, length);
+        auto ipakEntryStream = std::make_unique<IPakEntryReadStream>(this, reservedChunkBuffer->m_buffer, startPosition, length);
 
         reservedChunkBuffer->m_using_stream = ipakEntryStream.get();
 
@@ -96,14 +104,26 @@ public:
         return std::make_unique<iobjstream>(std::move(ipakEntryStream));
     }
 
-    void StartReading() override
+    size_t ReadData(void* buffer, const int64_t startPos, const size_t length) override
     {
-        m_read_mutex.lock();
-    }
+        if (m_mapped_file.IsOpen())
+        {
+            if (startPos < 0 || static_cast<uint64_t>(startPos) >= m_mapped_file.Size())
+                return 0;
 
-    void StopReading() override
-    {
-        m_read_mutex.unlock();
+            const auto readSize = std::min(length, m_mapped_file.Size() - static_cast<size_t>(startPos));
+            memcpy(buffer, &m_mapped_file.Data()[startPos], readSize);
+
+            return readSize;
+        }
+
+        std::lock_guard lock(m_read_mutex);
+
+        m_stream.clear();
+        m_stream.seekg(startPos);
+        m_stream.read(static_cast<char*>(buffer), static_cast<std::streamsize>(length));
+
+        return static_cast<size_t>(m_stream.gcount());
     }
 
     void CloseStream(objbuf* stream) override
@@ -139,8 +159,8 @@ public:
     }
 };
 
-IPakStreamManager::IPakStreamManager(std::istream& stream)
-    : m_impl(new Impl(stream))
+IPakStreamManager::IPakStreamManager(std::istream& stream, const std::string& diskPath)
+    : m_impl(new Impl(stream, diskPath))
 {
 }
 
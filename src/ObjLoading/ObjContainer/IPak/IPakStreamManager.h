@@ -6,12 +6,19 @@
 #include <cstdint>
 #include <istream>
 #include <mutex>
+#include <string>
 
 class IPakStreamManagerActions
 {
 public:
-    virtual void StartReading() = 0;
-    virtual void StopReading() = 0;
+    /**
+     * \brief Reads data of the ipak at the specified position. Can be called by multiple streams at once.
+     * \param buffer The buffer to read the data into.
+     * \param startPos The position in the ipak to read from.
+     * \param length The amount of bytes to read.
+     * \return The amount of bytes that were read.
+     */
+    virtual size_t ReadData(void* buffer, int64_t startPos, size_t length) = 0;
 
     virtual void CloseStream(objbuf* stream) = 0;
 };
@@ -22,7 +29,11 @@ class IPakStreamManager
     Impl* m_impl;
 
 public:
-    explicit IPakStreamManager(std::istream& stream);
+    /**
+     * \param stream The stream of the ipak which is used when the ipak cannot be memory mapped.
+     * \param diskPath The path of the ipak on disk to memory map. Can be empty.
+     */
+    IPakStreamManager(std::istream& stream, const std::string& diskPath);
     IPakStreamManager(const IPakStreamManager& other) = delete;
     IPakStreamManager(IPakStreamManager&& other) noexcept = delete;
     ~IPakStreamManager();
@@ -3,12 +3,18 @@
 #include "ObjLoading.h"
 #include "Utils/FileToZlibWrapper.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <ranges>
 #include <unzip.h>
+#include <zlib.h>
 
 namespace fs = std::filesystem;
 
@@ -22,26 +28,121 @@ public:
     public:
         virtual ~IParent() = default;
 
-        virtual void OnIWDFileClose() = 0;
+        /**
+         * \brief Reads raw data of the IWD archive. Can be called by multiple files at once.
+         * \param offset The offset in the archive to read from.
+         * \param buffer The buffer to read into.
+         * \param length The amount of bytes to read.
+         * \return The amount of bytes that were read.
+         */
+        virtual size_t ReadArchiveData(int64_t offset, void* buffer, size_t length) = 0;
     };
 
+    static constexpr size_t BUFFER_SIZE = 0x10000;
+
 private:
     IParent* m_parent;
     bool m_open;
     int64_t m_size;
-    unzFile m_container;
-    bool m_peeked;
-    int_type m_peek_symbol;
+    int64_t m_data_offset;
+    int64_t m_compressed_size;
+    bool m_compressed;
+
+    // Every file has its own inflate state so files of the same IWD can be read at the same time
+    z_stream m_inflate_stream;
+    bool m_inflate_initialized;
+    std::unique_ptr<char[]> m_input_buffer;
+    int64_t m_compressed_offset;
+
+    // Uncompressed data that was read ahead and is accessed via the get area
+    std::unique_ptr<char[]> m_buffer;
+
+    // Uncompressed position of the next byte that is read from the archive
+    int64_t m_read_pos;
+
+    size_t ReadStored(char* buffer, const size_t length)
+    {
+        const auto readSize = m_parent->ReadArchiveData(m_data_offset + m_read_pos, buffer, length);
+        m_read_pos += static_cast<int64_t>(readSize);
+
+        return readSize;
+    }
+
+    size_t ReadCompressed(char* buffer, const size_t length)
+    {
+        m_inflate_stream.next_out = reinterpret_cast<Bytef*>(buffer);
+        m_inflate_stream.avail_out = static_cast<uInt>(std::min<size_t>(length, std::numeric_limits<uInt>::max()));
+        const auto requestedSize = m_inflate_stream.avail_out;
+
+        while (m_inflate_stream.avail_out > 0)
+        {
+            if (m_inflate_stream.avail_in == 0)
+            {
+                const auto sizeToRead = static_cast<size_t>(std::min<int64_t>(BUFFER_SIZE, m_compressed_size - m_compressed_offset));
+                const auto readSize = sizeToRead > 0 ? m_parent->ReadArchiveData(m_data_offset + m_compressed_offset, m_input_buffer.get(), sizeToRead) : 0u;
+                if (readSize == 0)
+                    break;
+
+                m_compressed_offset += static_cast<int64_t>(readSize);
+                m_inflate_stream.next_in = reinterpret_cast<Bytef*>(m_input_buffer.get());
+                m_inflate_stream.avail_in = static_cast<uInt>(readSize);
+            }
+
+            if (inflate(&m_inflate_stream, Z_NO_FLUSH) != Z_OK)
+                break;
+        }
+
+        const auto readSize = static_cast<size_t>(requestedSize - m_inflate_stream.avail_out);
+        m_read_pos += static_cast<int64_t>(readSize);
+
+        return readSize;
+    }
+
+    size_t Read(char* buffer, const size_t length)
+    {
+        const auto sizeToRead = static_cast<size_t>(std::min<int64_t>(static_cast<int64_t>(length), m_size - m_read_pos));
+        if (sizeToRead == 0)
+            return 0;
+
+        return m_compressed ? ReadCompressed(buffer, sizeToRead) : ReadStored(buffer, sizeToRead);
+    }
+
+    void RestartCompressed()
+    {
+        inflateReset(&m_inflate_stream);
+        m_inflate_stream.next_in = Z_NULL;
+        m_inflate_stream.avail_in = 0;
+        m_compressed_offset = 0;
+        m_read_pos = 0;
+    }
+
+    _NODISCARD int64_t CurrentPos() const
+    {
+        return m_read_pos - static_cast<int64_t>(egptr() - gptr());
+    }
 
 public:
-    IWDFile(IParent* parent, const unzFile container, const int64_t size)
+    IWDFile(IParent* parent, const int64_t size, const int64_t dataOffset, const int64_t compressedSize, const bool compressed)
         : m_parent(parent),
           m_open(true),
           m_size(size),
-          m_container(container),
-          m_peeked(false),
-          m_peek_symbol(0)
+          m_data_offset(dataOffset),
+          m_compressed_size(compressedSize),
+          m_compressed(compressed),
+          m_inflate_stream{},
+          m_inflate_initialized(false),
+          m_compressed_offset(0),
+          m_buffer(std::make_unique<char[]>(BUFFER_SIZE)),
+          m_read_pos(0)
     {
+        if (m_compressed)
+        {
+            // Entries of zip archives are raw deflate streams without zlib header
+            m_inflate_initialized = inflateInit2(&m_inflate_stream, -MAX_WBITS) == Z_OK;
+            m_input_buffer = std::make_unique<char[]>(BUFFER_SIZE);
+        }
+
+        setg(m_buffer.get(), m_buffer.get(), m_buffer.get());
     }
 
     ~IWDFile() override
@@ -50,55 +151,73 @@ public:
         {
             close();
         }
+
+        if (m_inflate_initialized)
+            inflateEnd(&m_inflate_stream);
+    }
+
+    IWDFile(const IWDFile& other) = delete;
+    IWDFile(IWDFile&& other) noexcept = delete;
+    IWDFile& operator=(const IWDFile& other) = delete;
+    IWDFile& operator=(IWDFile&& other) noexcept = delete;
+
+    _NODISCARD bool IsValid() const
+    {
+        return !m_compressed || m_inflate_initialized;
     }
 
 protected:
     int_type underflow() override
     {
-        if (m_peeked)
-            return m_peek_symbol;
+        if (gptr() < egptr())
+            return traits_type::to_int_type(*gptr());
 
-        const auto result = unzReadCurrentFile(m_container, &m_peek_symbol, 1u);
+        const auto readSize = Read(m_buffer.get(), BUFFER_SIZE);
+        setg(m_buffer.get(), m_buffer.get(), m_buffer.get() + readSize);
 
-        if (result >= 0)
-        {
-            m_peeked = true;
-            return static_cast<int_type>(m_peek_symbol);
-        }
+        if (readSize == 0)
+            return EOF;
 
-        return EOF;
+        return traits_type::to_int_type(*gptr());
     }
 
-    int_type uflow() override
+    std::streamsize xsgetn(char* ptr, const std::streamsize count) override
     {
-        if (m_peeked)
+        std::streamsize loadedSize = 0;
+        while (loadedSize < count)
         {
-            m_peeked = false;
-            return m_peek_symbol;
-        }
+            if (gptr() == egptr())
+            {
+                // Large reads skip the buffer and are read into the target directly
+                if (static_cast<size_t>(count - loadedSize) >= BUFFER_SIZE)
+                {
+                    const auto readSize = Read(&ptr[loadedSize], static_cast<size_t>(count - loadedSize));
 
-        const auto result = unzReadCurrentFile(m_container, &m_peek_symbol, 1u);
-        return result >= 0 ? static_cast<int_type>(m_peek_symbol) : EOF;
-    }
+                    // The buffered data does not end at the read position anymore
+                    setg(m_buffer.get(), m_buffer.get(), m_buffer.get());
 
-    std::streamsize xsgetn(char* ptr, std::streamsize count) override
-    {
-        if (m_peeked && count >= 1)
-        {
-            *ptr = static_cast<char>(m_peek_symbol);
-            ptr++;
-            count--;
-        }
+                    if (readSize == 0)
+                        break;
 
-        const auto result = unzReadCurrentFile(m_container, ptr, static_cast<unsigned>(count));
+                    loadedSize += static_cast<std::streamsize>(readSize);
+                    continue;
+                }
 
-        return result >= 0 ? static_cast<std::streamsize>(result) : 0;
+                if (underflow() == EOF)
+                    break;
+            }
+
+            const auto sizeToCopy = std::min(count - loadedSize, static_cast<std::streamsize>(egptr() - gptr()));
+            memcpy(&ptr[loadedSize], gptr(), static_cast<size_t>(sizeToCopy));
+            gbump(static_cast<int>(sizeToCopy));
+            loadedSize += sizeToCopy;
+        }
+
+        return loadedSize;
     }
 
     pos_type seekoff(const off_type off, const std::ios_base::seekdir dir, const std::ios_base::openmode mode) override
     {
-        const auto currentPos = unztell64(m_container);
-
         pos_type targetPos;
         if (dir == std::ios_base::beg)
         {
@@ -106,11 +225,11 @@ protected:
         }
         else if (dir == std::ios_base::cur)
         {
-            targetPos = currentPos + off;
+            targetPos = CurrentPos() + off;
         }
         else
         {
-            targetPos = m_size - off;
+            targetPos = m_size + off;
         }
 
         return seekpos(targetPos, mode);
@@ -118,29 +237,38 @@ protected:
 
     pos_type seekpos(const pos_type pos, const std::ios_base::openmode mode) override
     {
-        const auto currentPos = unztell64(m_container);
+        const auto targetPos = static_cast<int64_t>(pos);
+        if (targetPos < 0 || targetPos > m_size)
+            return std::streampos(-1);
 
-        if (static_cast<pos_type>(currentPos) < pos)
+        // Seeking inside of the buffered data
+        const auto bufferStartPos = m_read_pos - static_cast<int64_t>(egptr() - eback());
+        if (targetPos >= bufferStartPos && targetPos <= m_read_pos)
         {
-            auto skipAmount = pos - static_cast<pos_type>(currentPos);
-            while (skipAmount > 0)
-            {
-                char temp[1024];
-                const auto toRead = skipAmount > sizeof(temp) ? sizeof(temp) : static_cast<size_t>(skipAmount);
-                unzReadCurrentFile(m_container, temp, toRead);
-                skipAmount -= toRead;
-            }
+            setg(eback(), eback() + (targetPos - bufferStartPos), egptr());
+            return pos;
+        }
 
+        setg(m_buffer.get(), m_buffer.get(), m_buffer.get());
+
+        if (!m_compressed)
+        {
+            m_read_pos = targetPos;
             return pos;
         }
 
-        if (currentPos == pos)
+        // Compressed data can only be read forwards so seeking backwards restarts inflating
+        if (targetPos < m_read_pos)
+            RestartCompressed();
+
+        while (m_read_pos < targetPos)
         {
-            // This is fine
-            return currentPos;
+            const auto sizeToSkip = static_cast<size_t>(std::min<int64_t>(BUFFER_SIZE, targetPos - m_read_pos));
+            if (Read(m_buffer.get(), sizeToSkip) == 0)
+                return std::streampos(-1);
         }
 
-        return std::streampos(-1);
+        return pos;
     }
 
 public:
@@ -151,11 +279,8 @@ public:
 
     bool close() override
     {
-        unzCloseCurrentFile(m_container);
         m_open = false;
 
-        m_parent->OnIWDFileClose();
-
         return true;
     }
 };
@@ -166,23 +291,44 @@ class IWD::Impl : public ISearchPath, public IObjContainer, public IWDFile::IPar
     {
     public:
         int64_t m_size{};
+        int64_t m_compressed_size{};
+        unsigned long m_compression_method{};
+        bool m_encrypted{};
         unz_file_pos m_file_pos{};
+
+        // Offset of the entry data in the archive. Resolved when the entry is opened for the first time.
+        int64_t m_data_offset = -1;
     };
 
     std::string m_path;
     std::unique_ptr<std::istream> m_stream;
     unzFile m_unz_file;
 
-    IWDFile* m_last_file;
+    // Guards the archive stream and the unzip handle which are shared by all open files
+    std::mutex m_mutex;
 
     std::map<std::string, IWDEntry> m_entry_map;
 
+    bool ResolveDataOffset(IWDEntry& entry) const
+    {
+        if (entry.m_data_offset >= 0)
+            return true;
+
+        auto pos = entry.m_file_pos;
+        if (unzGoToFilePos(m_unz_file, &pos) != UNZ_OK || unzOpenCurrentFile(m_unz_file) != UNZ_OK)
+            return false;
+
+        entry.m_data_offset = static_cast<int64_t>(unzGetCurrentFileZStreamPos64(m_unz_file));
+        unzCloseCurrentFile(m_unz_file);
+
+        return true;
+    }
+
 public:
     Impl(std::string path, std::unique_ptr<std::istream> stream)
         : m_path(std::move(path)),
           m_stream(std::move(stream)),
-          m_unz_file(nullptr),
-          m_last_file(nullptr)
+          m_unz_file(nullptr)
     {
     }
 
@@ -196,9 +342,9 @@ public:
     }
 
     Impl(const Impl& other) = delete;
-    Impl(Impl&& other) noexcept = default;
+    Impl(Impl&& other) noexcept = delete;
     Impl& operator=(const Impl& other) = delete;
-    Impl& operator=(Impl&& other) noexcept = default;
+    Impl& operator=(Impl&& other) noexcept = delete;
 
     bool Initialize()
     {
@@ -224,7 +370,10 @@ public:
             if (path.has_filename())
             {
                 IWDEntry entry;
-                entry.m_size = info.uncompressed_size;
+                entry.m_size = static_cast<int64_t>(info.uncompressed_size);
+                entry.m_compressed_size = static_cast<int64_t>(info.compressed_size);
+                entry.m_compression_method = info.compression_method;
+                entry.m_encrypted = (info.flag & 1) != 0;
                 unzGetFilePos(m_unz_file, &entry.m_file_pos);
                 m_entry_map.emplace(std::move(fileName), entry);
             }
@@ -240,6 +389,17 @@ public:
         return true;
     }
 
+    size_t ReadArchiveData(const int64_t offset, void* buffer, const size_t length) override
+    {
+        std::lock_guard lock(m_mutex);
+
+        m_stream->clear();
+        m_stream->seekg(offset, std::ios::beg);
+        m_stream->read(static_cast<char*>(buffer), static_cast<std::streamsize>(length));
+
+        return static_cast<size_t>(m_stream->gcount());
+    }
+
     SearchPathOpenFile Open(const std::string& fileName) override
     {
         if (m_unz_file == nullptr)
@@ -252,27 +412,30 @@ public:
 
         const auto iwdEntry = m_entry_map.find(iwdFilename);
 
-        if (iwdEntry != m_entry_map.end())
+        if (iwdEntry == m_entry_map.end())
+            return SearchPathOpenFile();
+
+        auto& entry = iwdEntry->second;
+        if (entry.m_encrypted || (entry.m_compression_method != 0 && entry.m_compression_method != Z_DEFLATED))
         {
-            if (m_last_file != nullptr)
-            {
-                throw std::runtime_error("Trying to open new IWD file while last one was not yet closed.");
-            }
+            printf("Unsupported compression of file \"%s\" in IWD \"%s\"\n", iwdFilename.c_str(), m_path.c_str());
+            return SearchPathOpenFile();
+        }
 
-            auto pos = iwdEntry->second.m_file_pos;
-            unzGoToFilePos(m_unz_file, &pos);
+        int64_t dataOffset;
+        {
+            std::lock_guard lock(m_mutex);
+            if (!ResolveDataOffset(entry))
+                return SearchPathOpenFile();
 
-            if (unzOpenCurrentFile(m_unz_file) == UNZ_OK)
-            {
-                auto result = std::make_unique<IWDFile>(this, m_unz_file, iwdEntry->second.m_size);
-                m_last_file = result.get();
-                return SearchPathOpenFile(std::make_unique<iobjstream>(std::move(result)), iwdEntry->second.m_size);
-            }
+            dataOffset = entry.m_data_offset;
+        }
 
+        auto result = std::make_unique<IWDFile>(this, entry.m_size, dataOffset, entry.m_compressed_size, entry.m_compression_method == Z_DEFLATED);
+        if (!result->IsValid())
             return SearchPathOpenFile();
-        }
 
-        return SearchPathOpenFile();
+        return SearchPathOpenFile(std::make_unique<iobjstream>(std::move(result)), entry.m_size);
     }
 
     std::string GetPath() override
@@ -306,9 +469,12 @@ public:
         }
     }
 
-    void OnIWDFileClose() override
+    bool ListIndexedFiles(const std::function<void(const std::string&)>& callback) const
     {
-        m_last_file = nullptr;
+        for (const auto& entryName : m_entry_map | std::views::keys)
+            callback(entryName);
+
+        return true;
     }
 };
 
@@ -361,3 +527,8 @@ void IWD::Find(const SearchPathSearchOptions& options, const std::function<void(
 {
     return m_impl->Find(options, callback);
 }
+
+bool IWD::ListIndexedFiles(const std::function<void(const std::string&)>& callback)
+{
+    return m_impl->ListIndexedFiles(callback);
+}
@@ -33,4 +33,5 @@ public:
     std::string GetPath() override;
     std::string GetName() override;
     void Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback) override;
+    bool ListIndexedFiles(const std::function<void(const std::string&)>& callback) override;
 };
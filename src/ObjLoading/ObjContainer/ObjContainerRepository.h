@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
@@ -30,17 +31,20 @@ template<typename ContainerType, typename ReferencerType> class ObjContainerRepo
     };
 
     std::vector<ObjContainerEntry> m_containers;
+    std::mutex m_mutex;
 
 public:
     ObjContainerRepository() = default;
     ~ObjContainerRepository() = default;
     ObjContainerRepository(const ObjContainerRepository& other) = delete;
-    ObjContainerRepository(ObjContainerRepository&& other) noexcept = default;
+    ObjContainerRepository(ObjContainerRepository&& other) noexcept = delete;
     ObjContainerRepository& operator=(const ObjContainerRepository& other) = delete;
-    ObjContainerRepository& operator=(ObjContainerRepository&& other) noexcept = default;
+    ObjContainerRepository& operator=(ObjContainerRepository&& other) noexcept = delete;
 
     void AddContainer(std::unique_ptr<ContainerType> container, ReferencerType* referencer)
     {
+        std::lock_guard lock(m_mutex);
+
         ObjContainerEntry entry(std::move(container));
         entry.m_references.insert(referencer);
         m_containers.emplace_back(std::move(entry));
@@ -48,6 +52,8 @@ public:
 
     bool AddContainerReference(ContainerType* container, ReferencerType* referencer)
     {
+        std::lock_guard lock(m_mutex);
+
         auto firstEntry = std::find_if(m_containers.begin(),
                                        m_containers.end(),
                                        [container](const ObjContainerEntry& entry)
@@ -66,6 +72,8 @@ public:
 
     void RemoveContainerReferences(ReferencerType* referencer)
     {
+        std::lock_guard lock(m_mutex);
+
         for (auto iEntry = m_containers.begin(); iEntry != m_containers.end();)
         {
             auto foundReference = iEntry->m_references.find(referencer);
@@ -88,6 +96,8 @@ public:
 
     ContainerType* GetContainerByName(const std::string& name)
     {
+        std::lock_guard lock(m_mutex);
+
         auto foundEntry = std::find_if(m_containers.begin(),
                                        m_containers.end(),
                                        [name](ObjContainerEntry& entry)
@@ -103,6 +113,33 @@ public:
         return nullptr;
     }
 
+    /**
+     * \brief Returns all containers that are referenced by any of the specified referencers in the order they were added.
+     * Unlike iterating the repository this is safe while other threads add or remove containers.
+     * \param referencers The referencers to get the containers of.
+     * \return The containers referenced by the referencers.
+     */
+    std::vector<ContainerType*> GetContainersReferencedBy(const std::vector<ReferencerType*>& referencers)
+    {
+        std::lock_guard lock(m_mutex);
+
+        std::vector<ContainerType*> result;
+        for (const auto& entry : m_containers)
+        {
+            const auto isReferenced = std::any_of(referencers.begin(),
+                                                  referencers.end(),
+                                                  [&entry](ReferencerType* referencer)
+                                                  {
+                                                      return entry.m_references.find(referencer) != entry.m_references.end();
+                                                  });
+
+            if (isReferenced)
+                result.emplace_back(entry.m_container.get());
+        }
+
+        return result;
+    }
+
     TransformIterator<typename std::vector<ObjContainerEntry>::iterator, ObjContainerEntry&, ContainerType*> begin()
     {
         return TransformIterator<typename std::vector<ObjContainerEntry>::iterator, ObjContainerEntry&, ContainerType*>(m_containers.begin(),
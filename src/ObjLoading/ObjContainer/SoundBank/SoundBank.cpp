@@ -5,6 +5,7 @@
 
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <vector>
 
@@ -12,7 +13,10 @@ ObjContainerRepository<SoundBank, Zone> SoundBank::Repository;
 
 class SoundBankInputBuffer final : public objbuf
 {
+    // The stream is shared between all entries of the sound bank that are read, potentially from multiple threads,
+    // so every read positions the stream itself while holding the lock
     std::istream& m_stream;
+    std::mutex& m_stream_mutex;
     int64_t m_base_offset;
     size_t m_size;
     size_t m_offset;
@@ -29,6 +33,8 @@ protected:
         if (m_offset >= m_size)
             return EOF;
 
+        std::lock_guard lock(m_stream_mutex);
+        m_stream.seekg(m_base_offset + m_offset);
         return m_stream.peek();
     }
 
@@ -37,6 +43,8 @@ protected:
         if (m_offset >= m_size)
             return EOF;
 
+        std::lock_guard lock(m_stream_mutex);
+        m_stream.seekg(m_base_offset + m_offset);
         m_offset++;
         return m_stream.get();
     }
@@ -48,6 +56,8 @@ protected:
 
         if (count > 0)
         {
+            std::lock_guard lock(m_stream_mutex);
+            m_stream.seekg(m_base_offset + m_offset);
             m_stream.read(ptr, count);
 
             const auto readSize = m_stream.gcount();
@@ -81,14 +91,14 @@ protected:
         if (pos < 0 || pos >= m_size)
             return pos_type(-1);
 
-        m_stream.seekg(m_base_offset + pos);
         m_offset = static_cast<size_t>(pos);
         return pos;
     }
 
 public:
-    SoundBankInputBuffer(std::istream& stream, const int64_t baseOffset, const size_t size)
+    SoundBankInputBuffer(std::istream& stream, std::mutex& streamMutex, const int64_t baseOffset, const size_t size)
         : m_stream(stream),
+          m_stream_mutex(streamMutex),
           m_base_offset(baseOffset),
           m_size(size),
           m_offset(0),
@@ -303,9 +313,9 @@ SoundBankEntryInputStream SoundBank::GetEntryStream(const unsigned id) const
     {
         const auto& entry = m_entries[foundEntry->second];
 
-        m_stream->seekg(entry.offset);
+        auto buffer = std::make_unique<SoundBankInputBuffer>(*m_stream, m_stream_mutex, entry.offset, entry.size);
 
-        return SoundBankEntryInputStream(std::make_unique<iobjstream>(std::make_unique<SoundBankInputBuffer>(*m_stream, entry.offset, entry.size)), entry);
+        return SoundBankEntryInputStream(std::make_unique<iobjstream>(std::move(buffer)), entry);
     }
 
     return SoundBankEntryInputStream();
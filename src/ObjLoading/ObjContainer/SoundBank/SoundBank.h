@@ -10,6 +10,7 @@
 #include "Zone/Zone.h"
 
 #include <istream>
+#include <mutex>
 
 class SoundBankEntryInputStream
 {
@@ -30,6 +31,7 @@ class SoundBank final : public ObjContainerReferenceable
 
     std::string m_file_name;
     std::unique_ptr<std::istream> m_stream;
+    mutable std::mutex m_stream_mutex;
     int64_t m_file_size;
 
     bool m_initialized;
@@ -51,9 +53,9 @@ public:
     SoundBank(std::string fileName, std::unique_ptr<std::istream> stream, int64_t fileSize);
     ~SoundBank() override = default;
     SoundBank(const SoundBank& other) = delete;
-    SoundBank(SoundBank&& other) noexcept = default;
+    SoundBank(SoundBank&& other) noexcept = delete;
     SoundBank& operator=(const SoundBank& other) = delete;
-    SoundBank& operator=(SoundBank&& other) noexcept = default;
+    SoundBank& operator=(SoundBank&& other) noexcept = delete;
 
     std::string GetName() override;
 
@@ -2,12 +2,15 @@
 
 #include "Crypto.h"
 #include "ObjContainer/SoundBank/SoundBankTypes.h"
+#include "ObjLoading.h"
 #include "Sound/FlacDecoder.h"
 #include "Sound/WavTypes.h"
 #include "Utils/FileUtils.h"
+#include "Utils/OrderedReadAhead.h"
+#include "Utils/ThreadPool.h"
 
+#include <algorithm>
 #include <cstring>
-#include <filesystem>
 #include <iostream>
 #include <unordered_map>
 
@@ -32,18 +35,54 @@ class SoundBankWriterImpl : public SoundBankWriter
 
     inline static const std::string PAD_DATA = std::string(16, '\x00');
 
+    // Upper bound for the data of sounds that are read from the search path but not written yet
+    static constexpr size_t SOUND_READ_AHEAD_MAX_DATA_SIZE = 256u * 1024u * 1024u;
+
+    class PendingSound
+    {
+    public:
+        enum class Type : uint8_t
+        {
+            NOT_FOUND,
+            WAV,
+            FLAC,
+            INVALID_FLAC
+        };
+
+        SearchPathOpenFile m_file;
+        Type m_type = Type::NOT_FOUND;
+        WavHeader m_wav_header{};
+        flac::FlacMetaData m_flac_meta_data{};
+        std::unique_ptr<char[]> m_data;
+        size_t m_size = 0u;
+        SoundAssetBankChecksum m_checksum{};
+    };
+
 public:
-    explicit SoundBankWriterImpl(std::string fileName, std::ostream& stream, ISearchPath* assetSearchPath)
+    SoundBankWriterImpl(std::string fileName, std::ostream& stream, ISearchPath* assetSearchPath, ThreadPool* threadPool)
         : m_file_name(std::move(fileName)),
           m_stream(stream),
           m_asset_search_path(assetSearchPath),
           m_current_offset(0),
           m_total_size(0),
           m_entry_section_offset(0),
-          m_checksum_section_offset(0)
+          m_checksum_section_offset(0),
+          m_thread_pool(threadPool)
     {
+        if (m_thread_pool == nullptr)
+        {
+            m_owned_thread_pool = std::make_unique<ThreadPool>(ThreadPool::DefaultThreadCount());
+            m_thread_pool = m_owned_thread_pool.get();
+        }
     }
 
+    ~SoundBankWriterImpl() override = default;
+
+    SoundBankWriterImpl(const SoundBankWriterImpl& other) = delete;
+    SoundBankWriterImpl(SoundBankWriterImpl&& other) noexcept = delete;
+    SoundBankWriterImpl& operator=(const SoundBankWriterImpl& other) = delete;
+    SoundBankWriterImpl& operator=(SoundBankWriterImpl&& other) noexcept = delete;
+
     void AddSound(const std::string& soundFilePath, unsigned int soundId, bool looping, bool streamed) override
     {
         auto itr = std::ranges::find_if(this->m_sounds,
@@ -118,104 +157,144 @@ public:
         Write(&header, sizeof(header));
     }
 
-    bool WriteEntries()
+    static size_t OpenSoundFromSearchPath(ISearchPath* searchPath, const std::string& soundFilePath, PendingSound& sound)
     {
-        GoTo(DATA_OFFSET);
+        // try to find a wav file for the sound path
+        sound.m_file = searchPath->Open(soundFilePath + ".wav");
+        if (sound.m_file.IsOpen())
+        {
+            sound.m_type = PendingSound::Type::WAV;
+        }
+        else
+        {
+            // if there is no wav file, try flac file
+            sound.m_file = searchPath->Open(soundFilePath + ".flac");
+            if (!sound.m_file.IsOpen())
+                return 0u;
+
+            sound.m_type = PendingSound::Type::FLAC;
+        }
+
+        return static_cast<size_t>(sound.m_file.m_length);
+    }
 
-        for (auto& sound : m_sounds)
+    static void ReadSound(PendingSound& sound)
+    {
+        if (!sound.m_file.IsOpen())
+            return;
+
+        const auto file = std::move(sound.m_file);
+        if (sound.m_type == PendingSound::Type::WAV)
         {
-            const auto& soundFilePath = sound.m_file_path;
-            const auto soundId = sound.m_sound_id;
+            file.m_stream->read(reinterpret_cast<char*>(&sound.m_wav_header), sizeof(WavHeader));
 
-            size_t soundSize;
-            std::unique_ptr<char[]> soundData;
+            sound.m_size = static_cast<size_t>(file.m_length - sizeof(WavHeader));
+            sound.m_data = std::make_unique<char[]>(sound.m_size);
+            file.m_stream->read(sound.m_data.get(), sound.m_size);
+        }
+        else
+        {
+            sound.m_size = static_cast<size_t>(file.m_length);
+            sound.m_data = std::make_unique<char[]>(sound.m_size);
+            file.m_stream->read(sound.m_data.get(), sound.m_size);
 
-            // try to find a wav file for the sound path
-            const auto wavFile = m_asset_search_path->Open(soundFilePath + ".wav");
-            if (wavFile.IsOpen())
+            if (!flac::GetFlacMetaData(sound.m_data.get(), sound.m_size, sound.m_flac_meta_data))
             {
-                WavHeader header{};
-                wavFile.m_stream->read(reinterpret_cast<char*>(&header), sizeof(WavHeader));
+                sound.m_type = PendingSound::Type::INVALID_FLAC;
+                return;
+            }
+        }
 
-                soundSize = static_cast<size_t>(wavFile.m_length - sizeof(WavHeader));
-                const auto frameCount = soundSize / (header.formatChunk.nChannels * (header.formatChunk.wBitsPerSample / 8));
+        // calculate checksum
+        const auto md5Crypt = Crypto::CreateMD5();
+        md5Crypt->Process(sound.m_data.get(), sound.m_size);
+        md5Crypt->Finish(sound.m_checksum.checksumBytes);
+    }
+
+    bool WriteEntries()
+    {
+        GoTo(DATA_OFFSET);
+
+        // Sounds are read, hashed and have their metadata parsed ahead of time on the thread pool while they are written in order
+        OrderedReadAhead<PendingSound> readAhead(
+            *m_thread_pool,
+            m_sounds.size(),
+            m_thread_pool->GetThreadCount() * 2u,
+            SOUND_READ_AHEAD_MAX_DATA_SIZE,
+            [this](const size_t index, PendingSound& sound)
+            {
+                return OpenSoundFromSearchPath(m_asset_search_path, m_sounds[index].m_file_path, sound);
+            },
+            ReadSound);
+
+        for (auto& soundInfo : m_sounds)
+        {
+            const auto& soundFilePath = soundInfo.m_file_path;
+            const auto sound = readAhead.Next();
+
+            switch (sound->m_type)
+            {
+            case PendingSound::Type::WAV:
+            {
+                const auto& header = sound->m_wav_header;
+                const auto frameCount = sound->m_size / (header.formatChunk.nChannels * (header.formatChunk.wBitsPerSample / 8));
                 const auto frameRateIndex = INDEX_FOR_FRAMERATE[header.formatChunk.nSamplesPerSec];
 
                 SoundAssetBankEntry entry{
-                    soundId,
-                    soundSize,
+                    soundInfo.m_sound_id,
+                    sound->m_size,
                     static_cast<size_t>(m_current_offset),
                     frameCount,
                     frameRateIndex,
                     static_cast<unsigned char>(header.formatChunk.nChannels),
-                    sound.m_looping,
+                    soundInfo.m_looping,
                     0,
                 };
 
                 m_entries.push_back(entry);
-
-                soundData = std::make_unique<char[]>(soundSize);
-                wavFile.m_stream->read(soundData.get(), soundSize);
+                break;
             }
-            else
+
+            case PendingSound::Type::FLAC:
             {
-                // if there is no wav file, try flac file
-                const auto flacFile = m_asset_search_path->Open(soundFilePath + ".flac");
-                if (flacFile.IsOpen())
-                {
-                    soundSize = static_cast<size_t>(flacFile.m_length);
-
-                    soundData = std::make_unique<char[]>(soundSize);
-                    flacFile.m_stream->read(soundData.get(), soundSize);
-
-                    flac::FlacMetaData metaData;
-                    if (flac::GetFlacMetaData(soundData.get(), soundSize, metaData))
-                    {
-                        const auto frameRateIndex = INDEX_FOR_FRAMERATE[metaData.m_sample_rate];
-                        SoundAssetBankEntry entry{
-                            soundId,
-                            soundSize,
-                            static_cast<size_t>(m_current_offset),
-                            static_cast<unsigned>(metaData.m_total_samples),
-                            frameRateIndex,
-                            metaData.m_number_of_channels,
-                            sound.m_looping,
-                            8,
-                        };
-
-                        m_entries.push_back(entry);
-                    }
-                    else
-                    {
-                        std::cerr << "Unable to decode .flac file for sound " << soundFilePath << "\n";
-                        return false;
-                    }
-                }
-                else
-                {
-                    std::cerr << "Unable to find a compatible file for sound " << soundFilePath << "\n";
-                    return false;
-                }
+                const auto& metaData = sound->m_flac_meta_data;
+                const auto frameRateIndex = INDEX_FOR_FRAMERATE[metaData.m_sample_rate];
+
+                SoundAssetBankEntry entry{
+                    soundInfo.m_sound_id,
+                    sound->m_size,
+                    static_cast<size_t>(m_current_offset),
+                    static_cast<unsigned>(metaData.m_total_samples),
+                    frameRateIndex,
+                    metaData.m_number_of_channels,
+                    soundInfo.m_looping,
+                    8,
+                };
+
+                m_entries.push_back(entry);
+                break;
+            }
+
+            case PendingSound::Type::INVALID_FLAC:
+                std::cerr << "Unable to decode .flac file for sound " << soundFilePath << "\n";
+                return false;
+
+            default:
+                std::cerr << "Unable to find a compatible file for sound " << soundFilePath << "\n";
+                return false;
             }
 
             const auto lastEntry = m_entries.rbegin();
-            if (!sound.m_streamed && lastEntry->frameRateIndex != 6)
+            if (!soundInfo.m_streamed && lastEntry->frameRateIndex != 6)
             {
                 std::cout << "WARNING: Loaded sound \"" << soundFilePath
                           << "\" should have a framerate of 48000 but doesn't. This sound may not work on all games!\n";
             }
 
-            // calculate checksum
-            SoundAssetBankChecksum checksum{};
-
-            const auto md5Crypt = Crypto::CreateMD5();
-            md5Crypt->Process(soundData.get(), soundSize);
-            md5Crypt->Finish(checksum.checksumBytes);
-
-            m_checksums.push_back(checksum);
+            m_checksums.push_back(sound->m_checksum);
 
             // write data
-            Write(soundData.get(), soundSize);
+            Write(sound->m_data.get(), sound->m_size);
         }
 
         return true;
@@ -313,11 +392,12 @@ private:
     int64_t m_total_size;
     int64_t m_entry_section_offset;
     int64_t m_checksum_section_offset;
-};
 
-std::filesystem::path SoundBankWriter::OutputPath;
+    ThreadPool* m_thread_pool;
+    std::unique_ptr<ThreadPool> m_owned_thread_pool;
+};
 
 std::unique_ptr<SoundBankWriter> SoundBankWriter::Create(const std::string& fileName, std::ostream& stream, ISearchPath* assetSearchPath)
 {
-    return std::make_unique<SoundBankWriterImpl>(fileName, stream, assetSearchPath);
+    return std::make_unique<SoundBankWriterImpl>(fileName, stream, assetSearchPath, ObjLoading::Configuration.SoundBankThreadPool);
 }
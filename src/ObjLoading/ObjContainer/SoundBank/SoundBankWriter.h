@@ -20,6 +20,4 @@ public:
     virtual bool Write(size_t& dataSize) = 0;
 
     static std::unique_ptr<SoundBankWriter> Create(const std::string& fileName, std::ostream& stream, ISearchPath* assetSearchPath);
-
-    static std::filesystem::path OutputPath;
 };
@@ -94,6 +94,18 @@ SearchPaths ObjLoading::GetIWDSearchPaths()
     return iwdPaths;
 }
 
+void ObjLoading::PrepareAssetForZone(AssetLoadingContext* context, const asset_type_t assetType, const std::string& assetName)
+{
+    for (const auto* loader : OBJ_LOADERS)
+    {
+        if (loader->SupportsZone(context->m_zone))
+        {
+            loader->PrepareAssetForZone(context, assetType, assetName);
+            return;
+        }
+    }
+}
+
 bool ObjLoading::LoadAssetForZone(AssetLoadingContext* context, const asset_type_t assetType, const std::string& assetName)
 {
     for (const auto* loader : OBJ_LOADERS)
@@ -1,8 +1,10 @@
 #pragma once
 
 #include "AssetLoading/AssetLoadingContext.h"
+#include "Image/IwiFileCache.h"
 #include "SearchPath/ISearchPath.h"
 #include "SearchPath/SearchPaths.h"
+#include "Utils/ThreadPool.h"
 #include "Zone/Zone.h"
 
 class ObjLoading
@@ -14,6 +16,16 @@ public:
         bool Verbose = false;
         bool MenuPermissiveParsing = false;
         bool MenuNoOptimization = false;
+
+        /**
+         * \brief The thread pool that sound bank writers read their sounds ahead of time on. If not set, every sound bank writer creates its own one.
+         */
+        ThreadPool* SoundBankThreadPool = nullptr;
+
+        /**
+         * \brief The cache that iwi files are probed and hashed through. If not set, iwi files are probed and hashed every time they are used.
+         */
+        IwiFileCache* ImageFileCache = nullptr;
     } Configuration;
 
     /**
@@ -54,6 +66,14 @@ public:
      */
     static void LoadObjDataForZone(ISearchPath* searchPath, Zone* zone);
 
+    /**
+     * \brief Starts reading and parsing the raw files of an asset on the thread pool of the context ahead of loading it with \c LoadAssetForZone.
+     * \param context The context of the zone the asset is loaded for.
+     * \param assetType The type of the asset.
+     * \param assetName The name of the asset.
+     */
+    static void PrepareAssetForZone(AssetLoadingContext* context, asset_type_t assetType, const std::string& assetName);
+
     static bool LoadAssetForZone(AssetLoadingContext* context, asset_type_t assetType, const std::string& assetName);
     static void FinalizeAssetsForZone(AssetLoadingContext* context);
 };
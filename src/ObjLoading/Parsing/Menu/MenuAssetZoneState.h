@@ -3,6 +3,7 @@
 #include "AssetLoading/IZoneAssetLoaderState.h"
 #include "Domain/CommonFunctionDef.h"
 #include "Domain/CommonMenuDef.h"
+#include "Parsing/Impl/PreprocessedIncludeCache.h"
 
 #include <string>
 
@@ -18,6 +19,8 @@ namespace menu
 
         std::map<std::string, std::vector<std::string>> m_menus_to_load_by_menu;
 
+        PreprocessedIncludeCache m_include_cache;
+
         MenuAssetZoneState() = default;
 
         void AddFunction(std::unique_ptr<CommonFunctionDef> function);
@@ -57,6 +57,9 @@ void MenuFileParser::CreateSequenceCollections()
 
     EventHandlerSetScopeSequences eventHandlerSetScopeSequences(m_all_tests, m_event_handler_set_scope_tests);
     eventHandlerSetScopeSequences.AddSequences(featureLevel, permissive);
+
+    // Most sequences start with a property keyword so only try the ones matching the next token
+    EnableSequenceDispatch();
 }
 
 const std::vector<MenuFileParser::sequence_t*>& MenuFileParser::GetTestsForState()
@@ -15,6 +15,8 @@ MenuFileReader::MenuFileReader(std::istream& stream, std::string fileName, const
     : m_feature_level(featureLevel),
       m_file_name(std::move(fileName)),
       m_stream(nullptr),
+      m_defines_proxy(nullptr),
+      m_include_cache(nullptr),
       m_zone_state(nullptr),
       m_permissive_mode(false)
 {
@@ -27,6 +29,8 @@ MenuFileReader::MenuFileReader(std::istream& stream, std::string fileName, const
     : m_feature_level(featureLevel),
       m_file_name(std::move(fileName)),
       m_stream(nullptr),
+      m_defines_proxy(nullptr),
+      m_include_cache(nullptr),
       m_zone_state(nullptr),
       m_permissive_mode(false)
 {
@@ -38,7 +42,19 @@ MenuFileReader::MenuFileReader(std::istream& stream, std::string fileName, const
 bool MenuFileReader::OpenBaseStream(std::istream& stream, include_callback_t includeCallback)
 {
     if (includeCallback)
-        m_open_streams.emplace_back(std::make_unique<ParserMultiInputStream>(stream, m_file_name, std::move(includeCallback)));
+    {
+        m_open_streams.emplace_back(std::make_unique<ParserMultiInputStream>(
+            stream,
+            m_file_name,
+            [this, includeCallback = std::move(includeCallback)](const std::string& filename, const std::string& sourceFile) -> std::unique_ptr<std::istream>
+            {
+                auto includedStream = includeCallback(filename, sourceFile);
+                if (!includedStream || !m_include_cache || !m_defines_proxy)
+                    return includedStream;
+
+                return m_include_cache->OpenInclude(*includedStream, *m_defines_proxy);
+            }));
+    }
     else
         m_open_streams.emplace_back(std::make_unique<ParserSingleInputStream>(stream, m_file_name));
 
@@ -63,6 +79,7 @@ void MenuFileReader::SetupDefinesProxy()
         break;
     }
 
+    m_defines_proxy = defines.get();
     m_open_streams.emplace_back(std::move(defines));
 }
 
@@ -114,6 +131,11 @@ std::unique_ptr<ParsingResult> MenuFileReader::CreateParsingResult(MenuFileParse
     return result;
 }
 
+void MenuFileReader::SetIncludeCache(PreprocessedIncludeCache* includeCache)
+{
+    m_include_cache = includeCache;
+}
+
 void MenuFileReader::IncludeZoneState(const MenuAssetZoneState* zoneState)
 {
     m_zone_state = zoneState;
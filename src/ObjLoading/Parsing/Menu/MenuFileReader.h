@@ -5,6 +5,8 @@
 #include "MenuAssetZoneState.h"
 #include "MenuFileParserState.h"
 #include "Parsing/IParserLineStream.h"
+#include "Parsing/Impl/DefinesStreamProxy.h"
+#include "Parsing/Impl/PreprocessedIncludeCache.h"
 
 #include <memory>
 #include <string>
@@ -23,6 +25,8 @@ namespace menu
 
         IParserLineStream* m_stream;
         std::vector<std::unique_ptr<IParserLineStream>> m_open_streams;
+        DefinesStreamProxy* m_defines_proxy;
+        PreprocessedIncludeCache* m_include_cache;
 
         const MenuAssetZoneState* m_zone_state;
         bool m_permissive_mode;
@@ -41,6 +45,12 @@ namespace menu
         void IncludeZoneState(const MenuAssetZoneState* zoneState);
         void SetPermissiveMode(bool usePermissiveMode);
 
+        /**
+         * \brief Seeds the preprocessing of included files from snapshots of previous readers instead of processing them again.
+         * \param includeCache The cache to take snapshots from and add new snapshots to.
+         */
+        void SetIncludeCache(PreprocessedIncludeCache* includeCache);
+
         std::unique_ptr<ParsingResult> ReadMenuFile();
     };
 } // namespace menu
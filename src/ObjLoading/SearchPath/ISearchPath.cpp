@@ -15,3 +15,10 @@ SearchPathOpenFile::SearchPathOpenFile(std::unique_ptr<std::istream> stream, con
       m_length(length)
 {
 }
+
+SearchPathOpenFile::SearchPathOpenFile(std::unique_ptr<std::istream> stream, const int64_t length, std::string diskPath)
+    : m_stream(std::move(stream)),
+      m_length(length),
+      m_disk_path(std::move(diskPath))
+{
+}
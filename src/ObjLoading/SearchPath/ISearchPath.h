@@ -7,6 +7,7 @@
 #include <functional>
 #include <istream>
 #include <memory>
+#include <string>
 
 class SearchPathOpenFile
 {
@@ -14,10 +15,16 @@ public:
     std::unique_ptr<std::istream> m_stream;
     int64_t m_length;
 
+    /**
+     * \brief The path of the file on disk if it was opened directly from disk. Empty when it is part of a container.
+     */
+    std::string m_disk_path;
+
     _NODISCARD bool IsOpen() const;
 
     SearchPathOpenFile();
     SearchPathOpenFile(std::unique_ptr<std::istream> stream, int64_t length);
+    SearchPathOpenFile(std::unique_ptr<std::istream> stream, int64_t length, std::string diskPath);
 };
 
 class ISearchPath
@@ -59,4 +66,19 @@ public:
     {
         Find(SearchPathSearchOptions(), callback);
     }
+
+    /**
+     * \brief Lists all files of the search path from an index of its contents without probing the disk.
+     * \param callback The callback to call for each file with its path relative to the search path.
+     * \return \c true if the search path is indexed and listed all of its files, \c false if files can only be found by opening them.
+     */
+    virtual bool ListIndexedFiles(const std::function<void(const std::string&)>& callback)
+    {
+        return false;
+    }
+
+    /**
+     * \brief Discards any index of the contents of the search path so it is rebuilt on the next lookup.
+     */
+    virtual void InvalidateIndex() {}
 };
@@ -1,15 +1,25 @@
 #include "SearchPathFilesystem.h"
 
+#include "SearchPathIndex.h"
 #include "Utils/ObjFileStream.h"
 
 #include <filesystem>
 #include <fstream>
+#include <mutex>
 
 namespace fs = std::filesystem;
 
 SearchPathFilesystem::SearchPathFilesystem(std::string path)
+    : SearchPathFilesystem(std::move(path), false)
+{
+}
+
+SearchPathFilesystem::SearchPathFilesystem(std::string path, const bool useIndex)
+    : m_path(std::move(path)),
+      m_use_index(useIndex),
+      m_index_valid(false),
+      m_index_failed(false)
 {
-    m_path = std::move(path);
 }
 
 std::string SearchPathFilesystem::GetPath()
@@ -17,14 +27,69 @@ std::string SearchPathFilesystem::GetPath()
     return m_path;
 }
 
+void SearchPathFilesystem::BuildIndex()
+{
+    m_index.clear();
+    m_index_failed = false;
+
+    try
+    {
+        const fs::path rootPath(m_path);
+        std::string key;
+
+        for (const auto& entry : fs::recursive_directory_iterator(rootPath, fs::directory_options::follow_directory_symlink))
+        {
+            if (!entry.is_regular_file())
+                continue;
+
+            if (search_path_index::MakeKey(entry.path().lexically_relative(rootPath).string(), key))
+                m_index.emplace(std::move(key));
+        }
+    }
+    catch (fs::filesystem_error& e)
+    {
+        printf("Failed to index search path \"%s\": \"%s\"\n", m_path.c_str(), e.what());
+        m_index.clear();
+        m_index_failed = true;
+    }
+
+    m_index_valid = true;
+}
+
+bool SearchPathFilesystem::EnsureIndexBuilt()
+{
+    {
+        std::shared_lock lock(m_index_mutex);
+        if (m_index_valid)
+            return !m_index_failed;
+    }
+
+    std::unique_lock lock(m_index_mutex);
+    if (!m_index_valid)
+        BuildIndex();
+
+    return !m_index_failed;
+}
+
 SearchPathOpenFile SearchPathFilesystem::Open(const std::string& fileName)
 {
+    if (m_use_index && EnsureIndexBuilt())
+    {
+        std::string key;
+        if (search_path_index::MakeKey(fileName, key))
+        {
+            std::shared_lock lock(m_index_mutex);
+            if (m_index_valid && !m_index.contains(key))
+                return SearchPathOpenFile();
+        }
+    }
+
     const auto filePath = fs::path(m_path).append(fileName);
     std::ifstream file(filePath.string(), std::fstream::in | std::fstream::binary);
 
     if (file.is_open())
     {
-        return SearchPathOpenFile(std::make_unique<std::ifstream>(std::move(file)), static_cast<int64_t>(file_size(filePath)));
+        return SearchPathOpenFile(std::make_unique<std::ifstream>(std::move(file)), static_cast<int64_t>(file_size(filePath)), filePath.string());
     }
 
     return SearchPathOpenFile();
@@ -62,3 +127,25 @@ void SearchPathFilesystem::Find(const SearchPathSearchOptions& options, const st
         printf("Directory Iterator threw error when trying to find files: \"%s\"\n", e.what());
     }
 }
+
+bool SearchPathFilesystem::ListIndexedFiles(const std::function<void(const std::string&)>& callback)
+{
+    if (!m_use_index || !EnsureIndexBuilt())
+        return false;
+
+    std::shared_lock lock(m_index_mutex);
+    if (!m_index_valid || m_index_failed)
+        return false;
+
+    for (const auto& fileName : m_index)
+        callback(fileName);
+
+    return true;
+}
+
+void SearchPathFilesystem::InvalidateIndex()
+{
+    std::unique_lock lock(m_index_mutex);
+    m_index_valid = false;
+    m_index.clear();
+}
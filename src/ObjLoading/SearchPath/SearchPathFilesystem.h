@@ -2,16 +2,37 @@
 
 #include "ISearchPath.h"
 
+#include <shared_mutex>
 #include <string>
+#include <unordered_set>
 
 class SearchPathFilesystem final : public ISearchPath
 {
     std::string m_path;
 
+    bool m_use_index;
+    bool m_index_valid;
+    bool m_index_failed;
+    std::unordered_set<std::string> m_index;
+    std::shared_mutex m_index_mutex;
+
+    void BuildIndex();
+    bool EnsureIndexBuilt();
+
 public:
     explicit SearchPathFilesystem(std::string path);
 
+    /**
+     * \brief Creates a search path for a directory on disk.
+     * \param path The path to the directory.
+     * \param useIndex Whether to build a manifest of all files of the directory once and answer lookups of files that do not exist from it
+     * instead of probing the disk. Files that are added to the directory afterwards are only found after calling \c InvalidateIndex.
+     */
+    SearchPathFilesystem(std::string path, bool useIndex);
+
     SearchPathOpenFile Open(const std::string& fileName) override;
     std::string GetPath() override;
     void Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback) override;
+    bool ListIndexedFiles(const std::function<void(const std::string&)>& callback) override;
+    void InvalidateIndex() override;
 };
@@ -0,0 +1,49 @@
+#include "SearchPathIndex.h"
+
+#include <cctype>
+#include <string_view>
+
+namespace search_path_index
+{
+    bool MakeKey(const std::string& fileName, std::string& key)
+    {
+        key.clear();
+
+        // Absolute paths cannot be part of an index
+        if (fileName.empty() || fileName[0] == '/' || fileName[0] == '\\')
+            return false;
+
+        key.reserve(fileName.size());
+
+        size_t segmentStart = 0;
+        for (const auto c : fileName)
+        {
+            if (c == '/' || c == '\\')
+            {
+                const auto segment = std::string_view(key).substr(segmentStart);
+
+                // Skip empty segments and current directory segments
+                if (segment.empty() || segment == ".")
+                {
+                    key.resize(segmentStart);
+                    continue;
+                }
+
+                if (segment == "..")
+                    return false;
+
+                key.push_back('/');
+                segmentStart = key.size();
+                continue;
+            }
+
+            if (c == ':')
+                return false;
+
+            key.push_back(static_cast<char>(tolower(static_cast<unsigned char>(c))));
+        }
+
+        const auto lastSegment = std::string_view(key).substr(segmentStart);
+        return !lastSegment.empty() && lastSegment != "." && lastSegment != "..";
+    }
+} // namespace search_path_index
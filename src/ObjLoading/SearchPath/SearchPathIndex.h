@@ -0,0 +1,15 @@
+#pragma once
+
+#include <string>
+
+namespace search_path_index
+{
+    /**
+     * \brief Converts a file name relative to a search path to the key it is stored with in search path indices.
+     * Keys are lower case and only use forward slashes so an index lookup never misses a file that opening it directly could find.
+     * \param fileName The file name to convert.
+     * \param key The resulting key.
+     * \return \c true if the file name can be looked up in an index, \c false if it is absolute or contains relative path segments.
+     */
+    bool MakeKey(const std::string& fileName, std::string& key);
+} // namespace search_path_index
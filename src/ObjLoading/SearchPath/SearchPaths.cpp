@@ -1,9 +1,132 @@
 #include "SearchPaths.h"
 
+#include "SearchPathIndex.h"
+
+#include <algorithm>
 #include <filesystem>
+#include <iterator>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+class SearchPaths::Index
+{
+    bool m_valid;
+    std::unordered_map<std::string, std::vector<size_t>> m_files;
+    std::vector<size_t> m_unindexed_search_paths;
+    std::shared_mutex m_mutex;
+
+    void Build(const std::vector<ISearchPath*>& searchPaths)
+    {
+        m_files.clear();
+        m_unindexed_search_paths.clear();
+
+        std::string key;
+        std::vector<std::string> keys;
+        for (auto searchPathIndex = 0u; searchPathIndex < searchPaths.size(); searchPathIndex++)
+        {
+            keys.clear();
+            const auto isIndexed = searchPaths[searchPathIndex]->ListIndexedFiles(
+                [&keys, &key](const std::string& fileName)
+                {
+                    if (search_path_index::MakeKey(fileName, key))
+                        keys.emplace_back(std::move(key));
+                });
+
+            if (!isIndexed)
+            {
+                m_unindexed_search_paths.emplace_back(searchPathIndex);
+                continue;
+            }
+
+            for (auto& fileKey : keys)
+            {
+                auto& searchPathsOfFile = m_files[std::move(fileKey)];
+                if (searchPathsOfFile.empty() || searchPathsOfFile.back() != searchPathIndex)
+                    searchPathsOfFile.emplace_back(searchPathIndex);
+            }
+        }
+
+        m_valid = true;
+    }
+
+public:
+    Index()
+        : m_valid(false)
+    {
+    }
+
+    void Invalidate()
+    {
+        std::unique_lock lock(m_mutex);
+        m_valid = false;
+        m_files.clear();
+        m_unindexed_search_paths.clear();
+    }
+
+    /**
+     * \brief Finds all search paths that may contain a file in the order they should be asked for it.
+     * \return \c false if the file name cannot be looked up in the index and all search paths need to be asked.
+     */
+    bool GetSearchPathsForFile(const std::string& fileName, const std::vector<ISearchPath*>& searchPaths, std::vector<size_t>& result)
+    {
+        std::string key;
+        if (!search_path_index::MakeKey(fileName, key))
+            return false;
+
+        std::shared_lock lock(m_mutex);
+
+        // The index can be invalidated again between building it and taking the shared lock
+        while (!m_valid)
+        {
+            lock.unlock();
+            {
+                std::unique_lock buildLock(m_mutex);
+                if (!m_valid)
+                    Build(searchPaths);
+            }
+            lock.lock();
+        }
+
+        const auto foundFile = m_files.find(key);
+        if (foundFile == m_files.end())
+        {
+            result = m_unindexed_search_paths;
+            return true;
+        }
+
+        // Merge the indexed search paths containing the file with the ones that need to be asked to keep the order of the search paths
+        result.clear();
+        result.reserve(foundFile->second.size() + m_unindexed_search_paths.size());
+        std::ranges::merge(foundFile->second, m_unindexed_search_paths, std::back_inserter(result));
+
+        return true;
+    }
+};
+
+SearchPaths::SearchPaths() = default;
+SearchPaths::~SearchPaths() = default;
+SearchPaths::SearchPaths(SearchPaths&& other) noexcept = default;
+SearchPaths& SearchPaths::operator=(SearchPaths&& other) noexcept = default;
 
 SearchPathOpenFile SearchPaths::Open(const std::string& fileName)
 {
+    std::vector<size_t> searchPathIndices;
+    if (m_index && m_index->GetSearchPathsForFile(fileName, m_search_paths, searchPathIndices))
+    {
+        for (const auto searchPathIndex : searchPathIndices)
+        {
+            auto file = m_search_paths[searchPathIndex]->Open(fileName);
+
+            if (file.IsOpen())
+            {
+                return file;
+            }
+        }
+
+        return SearchPathOpenFile();
+    }
+
     for (auto* searchPathEntry : m_search_paths)
     {
         auto file = searchPathEntry->Open(fileName);
@@ -30,15 +153,62 @@ void SearchPaths::Find(const SearchPathSearchOptions& options, const std::functi
     }
 }
 
+bool SearchPaths::ListIndexedFiles(const std::function<void(const std::string&)>& callback)
+{
+    // Only list anything when all search paths are indexed since files of the others are unknown
+    std::vector<std::string> fileNames;
+    for (auto* searchPathEntry : m_search_paths)
+    {
+        if (!searchPathEntry->ListIndexedFiles(
+                [&fileNames](const std::string& fileName)
+                {
+                    fileNames.emplace_back(fileName);
+                }))
+        {
+            return false;
+        }
+    }
+
+    for (const auto& fileName : fileNames)
+        callback(fileName);
+
+    return true;
+}
+
+void SearchPaths::InvalidateIndex()
+{
+    for (auto* searchPathEntry : m_search_paths)
+    {
+        searchPathEntry->InvalidateIndex();
+    }
+
+    if (m_index)
+        m_index->Invalidate();
+}
+
+void SearchPaths::SetUseIndex(const bool useIndex)
+{
+    if (!useIndex)
+        m_index.reset();
+    else if (!m_index)
+        m_index = std::make_unique<Index>();
+}
+
 void SearchPaths::CommitSearchPath(std::unique_ptr<ISearchPath> searchPath)
 {
     m_search_paths.push_back(searchPath.get());
     m_owned_search_paths.emplace_back(std::move(searchPath));
+
+    if (m_index)
+        m_index->Invalidate();
 }
 
 void SearchPaths::IncludeSearchPath(ISearchPath* searchPath)
 {
     m_search_paths.push_back(searchPath);
+
+    if (m_index)
+        m_index->Invalidate();
 }
 
 void SearchPaths::RemoveSearchPath(ISearchPath* searchPath)
@@ -48,6 +218,10 @@ void SearchPaths::RemoveSearchPath(ISearchPath* searchPath)
         if (*i == searchPath)
         {
             m_search_paths.erase(i);
+
+            if (m_index)
+                m_index->Invalidate();
+
             return;
         }
     }
@@ -2,27 +2,41 @@
 
 #include "ISearchPath.h"
 
+#include <memory>
 #include <vector>
 
 class SearchPaths final : public ISearchPath
 {
+    class Index;
+
     std::vector<ISearchPath*> m_search_paths;
     std::vector<std::unique_ptr<ISearchPath>> m_owned_search_paths;
+    std::unique_ptr<Index> m_index;
 
 public:
     using iterator = std::vector<ISearchPath*>::iterator;
 
-    SearchPaths() = default;
-    ~SearchPaths() override = default;
+    SearchPaths();
+    ~SearchPaths() override;
 
     SearchPathOpenFile Open(const std::string& fileName) override;
     std::string GetPath() override;
     void Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback) override;
+    bool ListIndexedFiles(const std::function<void(const std::string&)>& callback) override;
+    void InvalidateIndex() override;
 
     SearchPaths(const SearchPaths& other) = delete;
-    SearchPaths(SearchPaths&& other) noexcept = default;
+    SearchPaths(SearchPaths&& other) noexcept;
     SearchPaths& operator=(const SearchPaths& other) = delete;
-    SearchPaths& operator=(SearchPaths&& other) noexcept = default;
+    SearchPaths& operator=(SearchPaths&& other) noexcept;
+
+    /**
+     * \brief Looks up files in one combined index of all search paths that can list their contents instead of asking each search path in turn.
+     * Files that are in none of the indexed search paths are only looked up in the search paths that cannot list their contents.
+     * The index is built on the first lookup and rebuilt after search paths were added or removed or \c InvalidateIndex was called.
+     * \param useIndex Whether to use the index.
+     */
+    void SetUseIndex(bool useIndex);
 
     /**
      * \brief Adds a search path that gets deleted upon destruction of the \c SearchPaths object.
@@ -4,7 +4,9 @@
 
 #include <algorithm>
 #include <istream>
+#include <string_view>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 namespace string_table
@@ -29,37 +31,61 @@ namespace string_table
             auto* stringTable = memory.Create<StringTableType>();
             stringTable->name = memory.Dup(assetName.c_str());
 
-            std::vector<std::vector<std::string>> csvLines;
-            std::vector<std::string> currentLine;
+            // Cells are interned into zone memory while tokenizing so rows do not need to be buffered as strings
+            std::vector<const char*> csvCells;
+            std::vector<size_t> csvRowOffsets;
+            std::unordered_map<std::string_view, const char*> internedCells;
+            std::vector<std::string_view> currentRow;
             auto maxCols = 0u;
-            const CsvInputStream csv(stream);
+            CsvInputStream csv(stream);
 
-            while (csv.NextRow(currentLine))
+            while (csv.NextRow(currentRow))
             {
-                if (currentLine.size() > maxCols)
-                    maxCols = currentLine.size();
-                csvLines.emplace_back(std::move(currentLine));
-                currentLine = std::vector<std::string>();
+                if (currentRow.size() > maxCols)
+                    maxCols = currentRow.size();
+
+                csvRowOffsets.emplace_back(csvCells.size());
+                for (const auto& cellValue : currentRow)
+                {
+                    if (cellValue.empty())
+                    {
+                        csvCells.emplace_back("");
+                        continue;
+                    }
+
+                    const auto existingCell = internedCells.find(cellValue);
+                    if (existingCell != internedCells.end())
+                    {
+                        csvCells.emplace_back(existingCell->second);
+                        continue;
+                    }
+
+                    const auto* cellString = memory.Dup(cellValue);
+                    internedCells.emplace(std::string_view(cellString, cellValue.size()), cellString);
+                    csvCells.emplace_back(cellString);
+                }
             }
+            csvRowOffsets.emplace_back(csvCells.size());
 
             stringTable->columnCount = static_cast<int>(maxCols);
-            stringTable->rowCount = static_cast<int>(csvLines.size());
+            stringTable->rowCount = static_cast<int>(csvRowOffsets.size() - 1u);
             const auto cellCount = static_cast<unsigned>(stringTable->rowCount) * static_cast<unsigned>(stringTable->columnCount);
 
             if (cellCount)
             {
                 stringTable->values = memory.Alloc<CellType>(cellCount);
 
-                for (auto row = 0u; row < csvLines.size(); row++)
+                for (auto row = 0u; row < static_cast<unsigned>(stringTable->rowCount); row++)
                 {
-                    const auto& rowValues = csvLines[row];
+                    const auto rowOffset = csvRowOffsets[row];
+                    const auto rowSize = csvRowOffsets[row + 1] - rowOffset;
                     for (auto col = 0u; col < maxCols; col++)
                     {
                         auto& cell = stringTable->values[row * maxCols + col];
-                        if (col >= rowValues.size() || rowValues[col].empty())
+                        if (col >= rowSize)
                             SetCellContent(cell, "");
                         else
-                            SetCellContent(cell, memory.Dup(rowValues[col].c_str()));
+                            SetCellContent(cell, csvCells[rowOffset + col]);
                     }
                 }
             }
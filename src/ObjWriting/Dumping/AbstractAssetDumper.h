@@ -1,5 +1,6 @@
 #pragma once
 
+#include "DumpingTaskGroup.h"
 #include "IAssetDumper.h"
 
 template<class T> class AbstractAssetDumper : public IAssetDumper<T>
@@ -15,6 +16,8 @@ protected:
 public:
     void DumpPool(AssetDumpingContext& context, AssetPool<T>* pool) override
     {
+        DumpingTaskGroup assetTasks(context);
+
         for (auto assetInfo : *pool)
         {
             if (assetInfo->m_name[0] == ',' || !ShouldDump(assetInfo))
@@ -22,7 +25,13 @@ public:
                 continue;
             }
 
-            DumpAsset(context, assetInfo);
+            assetTasks.Run(
+                [this, &context, assetInfo]
+                {
+                    DumpAsset(context, assetInfo);
+                });
         }
+
+        assetTasks.Wait();
     }
 };
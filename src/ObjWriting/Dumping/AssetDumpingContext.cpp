@@ -4,7 +4,8 @@
 #include <fstream>
 
 AssetDumpingContext::AssetDumpingContext()
-    : m_zone(nullptr)
+    : m_zone(nullptr),
+      m_thread_pool(nullptr)
 {
 }
 
@@ -27,3 +28,13 @@ std::unique_ptr<std::ostream> AssetDumpingContext::OpenAssetFile(const std::stri
 
     return std::move(file);
 }
+
+bool AssetDumpingContext::ShouldHandleAssetType(const asset_type_t assetType) const
+{
+    if (assetType < 0)
+        return false;
+    if (static_cast<size_t>(assetType) >= m_asset_types_to_handle.size())
+        return true;
+
+    return m_asset_types_to_handle[assetType];
+}
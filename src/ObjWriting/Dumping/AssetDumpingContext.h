@@ -3,31 +3,53 @@
 #include "IZoneAssetDumperState.h"
 #include "Obj/Gdt/GdtStream.h"
 #include "Utils/ClassUtils.h"
+#include "Utils/ThreadPool.h"
 #include "Zone/Zone.h"
 
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <typeindex>
+#include <vector>
 
 class AssetDumpingContext
 {
     std::unordered_map<std::type_index, std::unique_ptr<IZoneAssetDumperState>> m_zone_asset_dumper_states;
+    std::mutex m_zone_asset_dumper_states_mutex;
 
 public:
     Zone* m_zone;
     std::string m_base_path;
     std::unique_ptr<GdtOutputStream> m_gdt;
 
+    /**
+     * \brief Zones that references of the dumped zone to assets of other zones are resolved against, in load order.
+     */
+    std::vector<Zone*> m_dependency_zones;
+
+    /**
+     * \brief Whether each asset type should be dumped. Asset types outside of the bitfield are always dumped.
+     */
+    std::vector<bool> m_asset_types_to_handle;
+
+    /**
+     * \brief Threads to dump asset pools and assets on concurrently. Everything is dumped on the calling thread when \c nullptr.
+     * Zone asset dumper states and the gdt can then be accessed from multiple threads at once.
+     */
+    ThreadPool* m_thread_pool;
+
     AssetDumpingContext();
 
     _NODISCARD std::unique_ptr<std::ostream> OpenAssetFile(const std::string& fileName) const;
+    _NODISCARD bool ShouldHandleAssetType(asset_type_t assetType) const;
 
     template<typename T> T* GetZoneAssetDumperState()
     {
         static_assert(std::is_base_of_v<IZoneAssetDumperState, T>, "T must inherit IZoneAssetDumperState");
         // T must also have a public default constructor
 
+        std::lock_guard lock(m_zone_asset_dumper_states_mutex);
         const auto foundEntry = m_zone_asset_dumper_states.find(typeid(T));
         if (foundEntry != m_zone_asset_dumper_states.end())
             return dynamic_cast<T*>(foundEntry->second.get());
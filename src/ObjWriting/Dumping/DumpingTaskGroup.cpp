@@ -0,0 +1,29 @@
+#include "DumpingTaskGroup.h"
+
+DumpingTaskGroup::DumpingTaskGroup(AssetDumpingContext& context)
+    : m_context(context),
+      m_tasks(context.m_thread_pool)
+{
+}
+
+void DumpingTaskGroup::Run(std::function<void()> task)
+{
+    auto& gdtEntries = m_gdt_entries.emplace_back(m_context.m_gdt.get());
+
+    m_tasks.Run(
+        [&gdtEntries, task = std::move(task)]
+        {
+            gdtEntries.Capture(task);
+        });
+}
+
+void DumpingTaskGroup::Wait()
+{
+    m_tasks.Wait();
+
+    // Entries are written where they would have been written when dumping on a single thread,
+    // which is the buffer of the enclosing group if this group is nested in one
+    for (auto& gdtEntries : m_gdt_entries)
+        gdtEntries.Flush();
+    m_gdt_entries.clear();
+}
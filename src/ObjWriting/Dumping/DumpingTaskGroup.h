@@ -0,0 +1,37 @@
+#pragma once
+
+#include "AssetDumpingContext.h"
+#include "Obj/Gdt/GdtStream.h"
+#include "Utils/TaskGroup.h"
+
+#include <deque>
+#include <functional>
+
+/**
+ * \brief A group of dumping tasks that writes the gdt entries of its tasks in the order the tasks were started in once they are done.
+ * This keeps the gdt of a zone the same regardless of the amount of threads it is dumped with.
+ */
+class DumpingTaskGroup
+{
+    AssetDumpingContext& m_context;
+    std::deque<GdtOutputStream::EntryBuffer> m_gdt_entries;
+
+    // Declared last so that running tasks are done before the buffers they write to go away
+    TaskGroup m_tasks;
+
+public:
+    explicit DumpingTaskGroup(AssetDumpingContext& context);
+    ~DumpingTaskGroup() = default;
+    DumpingTaskGroup(const DumpingTaskGroup& other) = delete;
+    DumpingTaskGroup(DumpingTaskGroup&& other) noexcept = delete;
+    DumpingTaskGroup& operator=(const DumpingTaskGroup& other) = delete;
+    DumpingTaskGroup& operator=(DumpingTaskGroup&& other) noexcept = delete;
+
+    void Run(std::function<void()> task);
+
+    /**
+     * \brief Blocks until all tasks of the group are done and writes their gdt entries.
+     * Rethrows the first exception that was thrown by a task of the group.
+     */
+    void Wait();
+};
@@ -4,7 +4,6 @@
 #include "Game/IW4/GameAssetPoolIW4.h"
 #include "Game/IW4/Menu/MenuDumperIW4.h"
 #include "Menu/AbstractMenuDumper.h"
-#include "ObjWriting.h"
 
 #include <filesystem>
 #include <string>
@@ -31,14 +30,6 @@ void AssetDumperMenuDef::DumpAsset(AssetDumpingContext& context, XAssetInfo<menu
     const auto* menu = asset->Asset();
     auto* zoneState = context.GetZoneAssetDumperState<menu::MenuDumpingZoneState>();
 
-    if (!ObjWriting::ShouldHandleAssetType(ASSET_TYPE_MENULIST))
-    {
-        // Make sure menu paths based on menu lists are created
-        const auto* gameAssetPool = dynamic_cast<GameAssetPoolIW4*>(asset->m_zone->m_pools.get());
-        for (auto* menuListAsset : *gameAssetPool->m_menu_list)
-            AssetDumperMenuList::CreateDumpingStateForMenuList(zoneState, menuListAsset->Asset());
-    }
-
     const auto menuFilePath = GetPathForMenu(zoneState, asset);
     const auto assetFile = context.OpenAssetFile(menuFilePath);
 
@@ -51,3 +42,17 @@ void AssetDumperMenuDef::DumpAsset(AssetDumpingContext& context, XAssetInfo<menu
     menuDumper.WriteMenu(menu);
     menuDumper.End();
 }
+
+void AssetDumperMenuDef::DumpPool(AssetDumpingContext& context, AssetPool<menuDef_t>* pool)
+{
+    if (!context.ShouldHandleAssetType(ASSET_TYPE_MENULIST))
+    {
+        // Make sure menu paths based on menu lists are created before menus are dumped
+        auto* zoneState = context.GetZoneAssetDumperState<menu::MenuDumpingZoneState>();
+        const auto* gameAssetPool = dynamic_cast<GameAssetPoolIW4*>(context.m_zone->m_pools.get());
+        for (auto* menuListAsset : *gameAssetPool->m_menu_list)
+            AssetDumperMenuList::CreateDumpingStateForMenuList(zoneState, menuListAsset->Asset());
+    }
+
+    AbstractAssetDumper<menuDef_t>::DumpPool(context, pool);
+}
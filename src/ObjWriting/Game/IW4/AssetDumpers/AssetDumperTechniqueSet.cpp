@@ -1,12 +1,13 @@
 #include "AssetDumperTechniqueSet.h"
 
 #include "Dumping/AbstractTextDumper.h"
+#include "Game/IW4/GameAssetPoolIW4.h"
 #include "Game/IW4/TechsetConstantsIW4.h"
-#include "Pool/GlobalAssetPool.h"
 #include "Shader/D3D9ShaderAnalyser.h"
 
 #include <algorithm>
 #include <cassert>
+#include <mutex>
 #include <sstream>
 #include <type_traits>
 
@@ -16,11 +17,13 @@ namespace IW4
 {
     class TechniqueDumpingZoneState final : public IZoneAssetDumperState
     {
+        std::mutex m_mutex;
         std::set<const MaterialTechnique*> m_dumped_techniques;
 
     public:
         bool ShouldDumpTechnique(const MaterialTechnique* technique)
         {
+            std::lock_guard lock(m_mutex);
             if (m_dumped_techniques.find(technique) != m_dumped_techniques.end())
                 return false;
 
@@ -31,6 +34,33 @@ namespace IW4
 
     class TechniqueFileWriter : public AbstractTextDumper
     {
+        const Zone* m_zone;
+        const std::vector<Zone*>& m_dependency_zones;
+
+        template<typename T>
+        _NODISCARD static XAssetInfo<T>* FindAssetInZone(const Zone* zone, std::unique_ptr<AssetPool<T>> GameAssetPoolIW4::*pool, const std::string& name)
+        {
+            const auto* assetPools = dynamic_cast<const GameAssetPoolIW4*>(zone->m_pools.get());
+            if (assetPools == nullptr || !(assetPools->*pool))
+                return nullptr;
+
+            return (assetPools->*pool)->GetAsset(name);
+        }
+
+        template<typename T>
+        _NODISCARD XAssetInfo<T>* FindAssetInZones(std::unique_ptr<AssetPool<T>> GameAssetPoolIW4::*pool, const std::string& name) const
+        {
+            // Only consider the zone itself and zones it can depend on to not be affected by zones that are dumped concurrently
+            for (const auto* zone : m_dependency_zones)
+            {
+                auto* asset = FindAssetInZone(zone, pool, name);
+                if (asset != nullptr)
+                    return asset;
+            }
+
+            return FindAssetInZone(m_zone, pool, name);
+        }
+
         void DumpStateMap() const
         {
             Indent();
@@ -258,7 +288,7 @@ namespace IW4
 
             if (vertexShader->name[0] == ',')
             {
-                const auto loadedVertexShaderFromOtherZone = GlobalAssetPool<MaterialVertexShader>::GetAssetByName(&vertexShader->name[1]);
+                const auto loadedVertexShaderFromOtherZone = FindAssetInZones(&GameAssetPoolIW4::m_material_vertex_shader, &vertexShader->name[1]);
 
                 if (loadedVertexShaderFromOtherZone == nullptr)
                 {
@@ -313,7 +343,7 @@ namespace IW4
 
             if (pixelShader->name[0] == ',')
             {
-                const auto loadedPixelShaderFromOtherZone = GlobalAssetPool<MaterialPixelShader>::GetAssetByName(&pixelShader->name[1]);
+                const auto loadedPixelShaderFromOtherZone = FindAssetInZones(&GameAssetPoolIW4::m_material_pixel_shader, &pixelShader->name[1]);
 
                 if (loadedPixelShaderFromOtherZone == nullptr)
                 {
@@ -385,7 +415,7 @@ namespace IW4
 
             if (vertexDecl->name && vertexDecl->name[0] == ',')
             {
-                const auto loadedVertexDeclFromOtherZone = GlobalAssetPool<MaterialVertexDeclaration>::GetAssetByName(&vertexDecl->name[1]);
+                const auto loadedVertexDeclFromOtherZone = FindAssetInZones(&GameAssetPoolIW4::m_material_vertex_decl, &vertexDecl->name[1]);
 
                 if (loadedVertexDeclFromOtherZone == nullptr)
                 {
@@ -442,8 +472,10 @@ namespace IW4
         }
 
     public:
-        explicit TechniqueFileWriter(std::ostream& stream)
-            : AbstractTextDumper(stream)
+        TechniqueFileWriter(std::ostream& stream, const Zone* zone, const std::vector<Zone*>& dependencyZones)
+            : AbstractTextDumper(stream),
+              m_zone(zone),
+              m_dependency_zones(dependencyZones)
         {
         }
 
@@ -569,7 +601,7 @@ void AssetDumperTechniqueSet::DumpAsset(AssetDumpingContext& context, XAssetInfo
             const auto techniqueFile = context.OpenAssetFile(GetTechniqueFileName(technique));
             if (techniqueFile)
             {
-                TechniqueFileWriter writer(*techniqueFile);
+                TechniqueFileWriter writer(*techniqueFile, context.m_zone, context.m_dependency_zones);
                 writer.DumpTechnique(technique);
             }
         }
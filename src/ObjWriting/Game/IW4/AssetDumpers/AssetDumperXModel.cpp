@@ -3,17 +3,18 @@
 #include "Game/IW4/CommonIW4.h"
 #include "ObjWriting.h"
 #include "Utils/DistinctMapper.h"
-#include "Utils/HalfFloat.h"
 #include "Utils/QuatInt16.h"
 #include "XModel/Export/XModelExportWriter.h"
 #include "XModel/Gltf/GltfBinOutput.h"
 #include "XModel/Gltf/GltfTextOutput.h"
 #include "XModel/Gltf/GltfWriter.h"
 #include "XModel/Obj/ObjWriter.h"
+#include "XModel/XModelVertexDecoder.h"
 #include "XModel/XModelWriter.h"
 
 #include <cassert>
 #include <format>
+#include <type_traits>
 
 using namespace IW4;
 
@@ -198,76 +199,22 @@ namespace
         }
     }
 
-    void AddXModelVertices(XModelCommon& out, const XModelSurfs* modelSurfs)
+    void AddXModelVertices(XModelVertexDecoder& vertexDecoder, const XModelSurfs* modelSurfs)
     {
         for (auto surfIndex = 0u; surfIndex < modelSurfs->numsurfs; surfIndex++)
         {
             const auto& surface = modelSurfs->surfs[surfIndex];
 
-            for (auto vertexIndex = 0u; vertexIndex < surface.vertCount; vertexIndex++)
-            {
-                const auto& v = surface.verts0[vertexIndex];
-                vec2_t uv;
-                vec3_t normalVec;
-                vec4_t color;
-
-                Common::Vec2UnpackTexCoords(v.texCoord, &uv);
-                Common::Vec3UnpackUnitVec(v.normal, &normalVec);
-                Common::Vec4UnpackGfxColor(v.color, &color);
-
-                XModelVertex vertex{};
-                vertex.coordinates[0] = v.xyz[0];
-                vertex.coordinates[1] = v.xyz[1];
-                vertex.coordinates[2] = v.xyz[2];
-                vertex.normal[0] = normalVec[0];
-                vertex.normal[1] = normalVec[1];
-                vertex.normal[2] = normalVec[2];
-                vertex.color[0] = color[0];
-                vertex.color[1] = color[1];
-                vertex.color[2] = color[2];
-                vertex.color[3] = color[3];
-                vertex.uv[0] = uv[0];
-                vertex.uv[1] = uv[1];
-
-                out.m_vertices.emplace_back(vertex);
-            }
-        }
-    }
+            if (surface.vertCount == 0u)
+                continue;
 
-    void AllocateXModelBoneWeights(const XModelSurfs* modelSurfs, XModelVertexBoneWeightCollection& weightCollection)
-    {
-        auto totalWeightCount = 0u;
-        for (auto surfIndex = 0u; surfIndex < modelSurfs->numsurfs; surfIndex++)
-        {
-            const auto& surface = modelSurfs->surfs[surfIndex];
-
-            if (surface.vertList)
-            {
-                totalWeightCount += surface.vertListCount;
-            }
-
-            if (surface.vertInfo.vertsBlend)
-            {
-                totalWeightCount += surface.vertInfo.vertCount[0] * 1;
-                totalWeightCount += surface.vertInfo.vertCount[1] * 2;
-                totalWeightCount += surface.vertInfo.vertCount[2] * 3;
-                totalWeightCount += surface.vertInfo.vertCount[3] * 4;
-            }
+            const auto& v = surface.verts0[0];
+            vertexDecoder.AddVertices(v.xyz, &v.normal.packed, &v.color.packed, &v.texCoord.packed, surface.vertCount, sizeof(GfxPackedVertex));
         }
-
-        weightCollection.weights.resize(totalWeightCount);
-    }
-
-    float BoneWeight16(const uint16_t value)
-    {
-        return static_cast<float>(value) / static_cast<float>(std::numeric_limits<uint16_t>::max());
     }
 
-    void AddXModelVertexBoneWeights(XModelCommon& out, const XModelSurfs* modelSurfs)
+    void AddXModelVertexBoneWeights(XModelVertexDecoder& vertexDecoder, const XModelSurfs* modelSurfs)
     {
-        auto& weightCollection = out.m_bone_weight_data;
-        size_t weightOffset = 0u;
-
         for (auto surfIndex = 0u; surfIndex < modelSurfs->numsurfs; surfIndex++)
         {
             const auto& surface = modelSurfs->surfs[surfIndex];
@@ -278,101 +225,29 @@ namespace
                 for (auto vertListIndex = 0u; vertListIndex < surface.vertListCount; vertListIndex++)
                 {
                     const auto& vertList = surface.vertList[vertListIndex];
-                    const auto* boneWeightOffset = &weightCollection.weights[weightOffset];
-
-                    weightCollection.weights[weightOffset++] = XModelBoneWeight{static_cast<int>(vertList.boneOffset / sizeof(DObjSkelMat)), 1.0f};
-
-                    for (auto vertListVertexOffset = 0u; vertListVertexOffset < vertList.vertCount; vertListVertexOffset++)
-                    {
-                        out.m_vertex_bone_weights.emplace_back(boneWeightOffset, 1);
-                    }
+                    vertexDecoder.AddRigidVertexBoneWeights(static_cast<int>(vertList.boneOffset / sizeof(DObjSkelMat)), vertList.vertCount);
                     handledVertices += vertList.vertCount;
                 }
             }
 
-            auto vertsBlendOffset = 0u;
             if (surface.vertInfo.vertsBlend)
             {
-                // 1 bone weight
-                for (auto vertIndex = 0; vertIndex < surface.vertInfo.vertCount[0]; vertIndex++)
+                // Blended vertices are sorted by the amount of bones that influence them
+                const auto* vertsBlend = surface.vertInfo.vertsBlend;
+                for (auto boneCount = 1u; boneCount <= std::extent_v<decltype(surface.vertInfo.vertCount)>; boneCount++)
                 {
-                    const auto* boneWeightOffset = &weightCollection.weights[weightOffset];
-                    const auto boneIndex0 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 0] / sizeof(DObjSkelMat));
-                    weightCollection.weights[weightOffset++] = XModelBoneWeight{boneIndex0, 1.0f};
-
-                    vertsBlendOffset += 1;
-
-                    out.m_vertex_bone_weights.emplace_back(boneWeightOffset, 1);
-                }
-
-                // 2 bone weights
-                for (auto vertIndex = 0; vertIndex < surface.vertInfo.vertCount[1]; vertIndex++)
-                {
-                    const auto* boneWeightOffset = &weightCollection.weights[weightOffset];
-                    const auto boneIndex0 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 0] / sizeof(DObjSkelMat));
-                    const auto boneIndex1 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 1] / sizeof(DObjSkelMat));
-                    const auto boneWeight1 = BoneWeight16(surface.vertInfo.vertsBlend[vertsBlendOffset + 2]);
-                    const auto boneWeight0 = 1.0f - boneWeight1;
-
-                    weightCollection.weights[weightOffset++] = XModelBoneWeight{boneIndex0, boneWeight0};
-                    weightCollection.weights[weightOffset++] = XModelBoneWeight{boneIndex1, boneWeight1};
-
-                    vertsBlendOffset += 3;
+                    const auto vertexCount = surface.vertInfo.vertCount[boneCount - 1u];
+                    if (vertexCount <= 0)
+                        continue;
 
-                    out.m_vertex_bone_weights.emplace_back(boneWeightOffset, 2);
+                    vertexDecoder.AddBlendedVertexBoneWeights(vertsBlend, vertexCount, boneCount, sizeof(DObjSkelMat));
+                    vertsBlend += vertexCount * (boneCount * 2u - 1u);
+                    handledVertices += vertexCount;
                 }
-
-                // 3 bone weights
-                for (auto vertIndex = 0; vertIndex < surface.vertInfo.vertCount[2]; vertIndex++)
-                {
-                    const auto* boneWeightOffset = &weightCollection.weights[weightOffset];
-                    const auto boneIndex0 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 0] / sizeof(DObjSkelMat));
-                    const auto boneIndex1 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 1] / sizeof(DObjSkelMat));
-                    const auto boneWeight1 = BoneWeight16(surface.vertInfo.vertsBlend[vertsBlendOffset + 2]);
-                    const auto boneIndex2 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 3] / sizeof(DObjSkelMat));
-                    const auto boneWeight2 = BoneWeight16(surface.vertInfo.vertsBlend[vertsBlendOffset + 4]);
-                    const auto boneWeight0 = 1.0f - boneWeight1 - boneWeight2;
-
-                    weightCollection.weights[weightOffset++] = XModelBoneWeight{boneIndex0, boneWeight0};
-                    weightCollection.weights[weightOffset++] = XModelBoneWeight{boneIndex1, boneWeight1};
-                    weightCollection.weights[weightOffset++] = XModelBoneWeight{boneIndex2, boneWeight2};
-
-                    vertsBlendOffset += 5;
-
-                    out.m_vertex_bone_weights.emplace_back(boneWeightOffset, 3);
-                }
-
-                // 4 bone weights
-                for (auto vertIndex = 0; vertIndex < surface.vertInfo.vertCount[3]; vertIndex++)
-                {
-                    const auto* boneWeightOffset = &weightCollection.weights[weightOffset];
-                    const auto boneIndex0 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 0] / sizeof(DObjSkelMat));
-                    const auto boneIndex1 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 1] / sizeof(DObjSkelMat));
-                    const auto boneWeight1 = BoneWeight16(surface.vertInfo.vertsBlend[vertsBlendOffset + 2]);
-                    const auto boneIndex2 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 3] / sizeof(DObjSkelMat));
-                    const auto boneWeight2 = BoneWeight16(surface.vertInfo.vertsBlend[vertsBlendOffset + 4]);
-                    const auto boneIndex3 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 5] / sizeof(DObjSkelMat));
-                    const auto boneWeight3 = BoneWeight16(surface.vertInfo.vertsBlend[vertsBlendOffset + 6]);
-                    const auto boneWeight0 = 1.0f - boneWeight1 - boneWeight2 - boneWeight3;
-
-                    weightCollection.weights[weightOffset++] = XModelBoneWeight{boneIndex0, boneWeight0};
-                    weightCollection.weights[weightOffset++] = XModelBoneWeight{boneIndex1, boneWeight1};
-                    weightCollection.weights[weightOffset++] = XModelBoneWeight{boneIndex2, boneWeight2};
-                    weightCollection.weights[weightOffset++] = XModelBoneWeight{boneIndex3, boneWeight3};
-
-                    vertsBlendOffset += 7;
-
-                    out.m_vertex_bone_weights.emplace_back(boneWeightOffset, 4);
-                }
-
-                handledVertices +=
-                    surface.vertInfo.vertCount[0] + surface.vertInfo.vertCount[1] + surface.vertInfo.vertCount[2] + surface.vertInfo.vertCount[3];
             }
 
-            for (; handledVertices < surface.vertCount; handledVertices++)
-            {
-                out.m_vertex_bone_weights.emplace_back(nullptr, 0);
-            }
+            if (handledVertices < surface.vertCount)
+                vertexDecoder.AddVerticesWithoutBoneWeights(surface.vertCount - handledVertices);
         }
     }
 
@@ -397,19 +272,26 @@ namespace
         }
     }
 
-    void PopulateXModelWriter(XModelCommon& out, const AssetDumpingContext& context, const unsigned lod, const XModel* model)
+    void PopulateXModelWriter(XModelCommon& out, const AssetDumpingContext& context, const XModel* model, DistinctMapper<Material*>& materialMapper)
     {
-        const auto* modelSurfs = model->lodInfo[lod].modelSurfs;
+        AddXModelBones(out, context, model);
+        AddXModelMaterials(out, materialMapper, model);
+    }
 
-        DistinctMapper<Material*> materialMapper(model->numsurfs);
-        AllocateXModelBoneWeights(modelSurfs, out.m_bone_weight_data);
+    void PopulateXModelWriterForLod(
+        XModelCommon& out, XModelVertexDecoder& vertexDecoder, const unsigned lod, const XModel* model, const DistinctMapper<Material*>& materialMapper)
+    {
+        // Bones and materials are the same for all lods. Everything else is replaced while keeping the buffers of the previous lod.
+        out.m_objects.clear();
+        vertexDecoder.Clear();
+
+        const auto* modelSurfs = model->lodInfo[lod].modelSurfs;
 
         out.m_name = modelSurfs->name;
-        AddXModelBones(out, context, model);
-        AddXModelMaterials(out, materialMapper, model);
         AddXModelObjects(out, modelSurfs, materialMapper, model->lodInfo[lod].surfIndex);
-        AddXModelVertices(out, modelSurfs);
-        AddXModelVertexBoneWeights(out, modelSurfs);
+        AddXModelVertices(vertexDecoder, modelSurfs);
+        AddXModelVertexBoneWeights(vertexDecoder, modelSurfs);
+        vertexDecoder.Decode(out);
         AddXModelFaces(out, modelSurfs);
     }
 
@@ -422,8 +304,6 @@ namespace
             return;
 
         const auto writer = obj::CreateMtlWriter(*mtlFile, context.m_zone->m_game->GetShortName(), context.m_zone->m_name);
-        DistinctMapper<Material*> materialMapper(model->numsurfs);
-
         writer->Write(common);
     }
 
@@ -442,8 +322,6 @@ namespace
 
         const auto writer =
             obj::CreateObjWriter(*assetFile, std::format("{}.mtl", model->name), context.m_zone->m_game->GetShortName(), context.m_zone->m_name);
-        DistinctMapper<Material*> materialMapper(model->numsurfs);
-
         writer->Write(common);
     }
 
@@ -481,10 +359,15 @@ namespace
     {
         const auto* model = asset->Asset();
 
+        XModelCommon common;
+        DistinctMapper<Material*> materialMapper(model->numsurfs);
+        PopulateXModelWriter(common, context, model, materialMapper);
+
+        XModelVertexDecoder vertexDecoder(Common::Vec2UnpackTexCoords, Common::Vec3UnpackUnitVec, Common::Vec4UnpackGfxColor);
+
         for (auto currentLod = 0u; currentLod < model->numLods; currentLod++)
         {
-            XModelCommon common;
-            PopulateXModelWriter(common, context, currentLod, asset->Asset());
+            PopulateXModelWriterForLod(common, vertexDecoder, currentLod, model, materialMapper);
 
             switch (ObjWriting::Configuration.ModelOutputFormat)
             {
@@ -22,9 +22,9 @@
 #include "AssetDumpers/AssetDumperVertexShader.h"
 #include "AssetDumpers/AssetDumperWeapon.h"
 #include "AssetDumpers/AssetDumperXModel.h"
+#include "Dumping/DumpingTaskGroup.h"
 #include "Game/IW4/GameAssetPoolIW4.h"
 #include "Game/IW4/GameIW4.h"
-#include "ObjWriting.h"
 
 using namespace IW4;
 
@@ -36,13 +36,18 @@ bool ZoneDumper::CanHandleZone(AssetDumpingContext& context) const
 bool ZoneDumper::DumpZone(AssetDumpingContext& context) const
 {
 #define DUMP_ASSET_POOL(dumperType, poolName, assetType)                                                                                                       \
-    if (assetPools->poolName && ObjWriting::ShouldHandleAssetType(assetType))                                                                                  \
+    if (assetPools->poolName && context.ShouldHandleAssetType(assetType))                                                                                      \
     {                                                                                                                                                          \
-        dumperType dumper;                                                                                                                                     \
-        dumper.DumpPool(context, assetPools->poolName.get());                                                                                                  \
+        poolTasks.Run(                                                                                                                                         \
+            [&context, assetPools]                                                                                                                             \
+            {                                                                                                                                                  \
+                dumperType dumper;                                                                                                                             \
+                dumper.DumpPool(context, assetPools->poolName.get());                                                                                          \
+            });                                                                                                                                                \
     }
 
     const auto* assetPools = dynamic_cast<GameAssetPoolIW4*>(context.m_zone->m_pools.get());
+    DumpingTaskGroup poolTasks(context);
 
     DUMP_ASSET_POOL(AssetDumperPhysPreset, m_phys_preset, ASSET_TYPE_PHYSPRESET)
     DUMP_ASSET_POOL(AssetDumperPhysCollmap, m_phys_collmap, ASSET_TYPE_PHYSCOLLMAP)
@@ -65,8 +70,24 @@ bool ZoneDumper::DumpZone(AssetDumpingContext& context) const
     // DUMP_ASSET_POOL(AssetDumperGfxWorld, m_gfx_world, ASSET_TYPE_GFXWORLD)
     DUMP_ASSET_POOL(AssetDumperGfxLightDef, m_gfx_light_def, ASSET_TYPE_LIGHT_DEF)
     // DUMP_ASSET_POOL(AssetDumperFont_s, m_font, ASSET_TYPE_FONT)
-    DUMP_ASSET_POOL(AssetDumperMenuList, m_menu_list, ASSET_TYPE_MENULIST)
-    DUMP_ASSET_POOL(AssetDumperMenuDef, m_menu_def, ASSET_TYPE_MENU)
+
+    // Menus are dumped to the paths that were decided when dumping the menu lists referencing them, so menu lists must be done first
+    poolTasks.Run(
+        [&context, assetPools]
+        {
+            if (assetPools->m_menu_list && context.ShouldHandleAssetType(ASSET_TYPE_MENULIST))
+            {
+                AssetDumperMenuList dumper;
+                dumper.DumpPool(context, assetPools->m_menu_list.get());
+            }
+
+            if (assetPools->m_menu_def && context.ShouldHandleAssetType(ASSET_TYPE_MENU))
+            {
+                AssetDumperMenuDef dumper;
+                dumper.DumpPool(context, assetPools->m_menu_def.get());
+            }
+        });
+
     DUMP_ASSET_POOL(AssetDumperLocalizeEntry, m_localize, ASSET_TYPE_LOCALIZE_ENTRY)
     DUMP_ASSET_POOL(AssetDumperWeapon, m_weapon, ASSET_TYPE_WEAPON)
     // DUMP_ASSET_POOL(AssetDumperSndDriverGlobals, m_snd_driver_globals, ASSET_TYPE_SNDDRIVER_GLOBALS)
@@ -80,6 +101,7 @@ bool ZoneDumper::DumpZone(AssetDumpingContext& context) const
     DUMP_ASSET_POOL(AssetDumperVehicle, m_vehicle, ASSET_TYPE_VEHICLE)
     DUMP_ASSET_POOL(AssetDumperAddonMapEnts, m_addon_map_ents, ASSET_TYPE_ADDON_MAP_ENTS)
 
+    poolTasks.Wait();
     return true;
 
 #undef DUMP_ASSET_POOL
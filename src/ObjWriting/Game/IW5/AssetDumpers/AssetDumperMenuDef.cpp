@@ -3,7 +3,6 @@
 #include "Game/IW5/GameAssetPoolIW5.h"
 #include "Game/IW5/Menu/MenuDumperIW5.h"
 #include "Menu/AbstractMenuDumper.h"
-#include "ObjWriting.h"
 
 #include <filesystem>
 #include <string>
@@ -55,7 +54,7 @@ void AssetDumperMenuDef::DumpAsset(AssetDumpingContext& context, XAssetInfo<menu
     const auto* menu = asset->Asset();
     const auto menuFilePath = GetPathForMenu(asset);
 
-    if (ObjWriting::ShouldHandleAssetType(ASSET_TYPE_MENULIST))
+    if (context.ShouldHandleAssetType(ASSET_TYPE_MENULIST))
     {
         // Don't dump menu file separately if the name matches the menu list
         const auto* menuListParent = GetParentMenuList(asset);
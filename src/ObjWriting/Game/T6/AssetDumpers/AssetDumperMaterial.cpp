@@ -42,7 +42,7 @@ void AssetDumperMaterial::DumpAsset(AssetDumpingContext& context, XAssetInfo<Mat
 void AssetDumperMaterial::DumpPool(AssetDumpingContext& context, AssetPool<Material>* pool)
 {
     auto* materialConstantState = context.GetZoneAssetDumperState<MaterialConstantZoneState>();
-    materialConstantState->ExtractNamesFromZone();
+    materialConstantState->ExtractNamesFromZone(context);
 
     AbstractAssetDumper::DumpPool(context, pool);
 }
@@ -403,9 +403,13 @@ class AssetDumperSndBank::Internal
         stream.WriteColumn("");
     }
 
-    static SoundBankEntryInputStream FindSoundDataInSoundBanks(const unsigned assetId)
+    SoundBankEntryInputStream FindSoundDataInSoundBanks(const unsigned assetId) const
     {
-        for (const auto* soundBank : SoundBank::Repository)
+        // Only consider sound banks of zones this zone can depend on to not be affected by zones that are dumped concurrently
+        std::vector<Zone*> zones(m_context.m_dependency_zones);
+        zones.emplace_back(m_context.m_zone);
+
+        for (const auto* soundBank : SoundBank::Repository.GetContainersReferencedBy(zones))
         {
             auto soundFile = soundBank->GetEntryStream(assetId);
             if (soundFile.IsOpen())
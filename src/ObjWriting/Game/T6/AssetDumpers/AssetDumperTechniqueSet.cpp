@@ -1,5 +1,6 @@
 #include "AssetDumperTechniqueSet.h"
 
+#include <mutex>
 #include <sstream>
 #include <unordered_set>
 
@@ -10,6 +11,7 @@ class ShaderZoneState final : public IZoneAssetDumperState
 public:
     bool ShouldDumpTechnique(const MaterialTechnique* technique)
     {
+        std::lock_guard lock(m_mutex);
         const auto existingTechnique = m_dumped_techniques.find(technique);
         if (existingTechnique == m_dumped_techniques.end())
         {
@@ -22,6 +24,7 @@ public:
 
     bool ShouldDumpPixelShader(const MaterialPixelShader* pixelShader)
     {
+        std::lock_guard lock(m_mutex);
         const auto existingPixelShader = m_dumped_pixel_shaders.find(pixelShader);
         if (existingPixelShader == m_dumped_pixel_shaders.end())
         {
@@ -34,6 +37,7 @@ public:
 
     bool ShouldDumpVertexShader(const MaterialVertexShader* vertexShader)
     {
+        std::lock_guard lock(m_mutex);
         const auto existingVertexShader = m_dumped_vertex_shaders.find(vertexShader);
         if (existingVertexShader == m_dumped_vertex_shaders.end())
         {
@@ -45,6 +49,7 @@ public:
     }
 
 private:
+    std::mutex m_mutex;
     std::unordered_set<const MaterialTechnique*> m_dumped_techniques;
     std::unordered_set<const MaterialPixelShader*> m_dumped_pixel_shaders;
     std::unordered_set<const MaterialVertexShader*> m_dumped_vertex_shaders;
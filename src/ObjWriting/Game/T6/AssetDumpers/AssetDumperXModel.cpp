@@ -9,10 +9,12 @@
 #include "XModel/Gltf/GltfTextOutput.h"
 #include "XModel/Gltf/GltfWriter.h"
 #include "XModel/Obj/ObjWriter.h"
+#include "XModel/XModelVertexDecoder.h"
 #include "XModel/XModelWriter.h"
 
 #include <cassert>
 #include <format>
+#include <type_traits>
 
 using namespace T6;
 
@@ -217,7 +219,7 @@ namespace
         }
     }
 
-    void AddXModelVertices(XModelCommon& out, const XModel* model, const unsigned lod)
+    void AddXModelVertices(XModelVertexDecoder& vertexDecoder, const XModel* model, const unsigned lod)
     {
         const auto* surfs = &model->surfs[model->lodInfo[lod].surfIndex];
         const auto surfCount = model->lodInfo[lod].numsurfs;
@@ -229,82 +231,22 @@ namespace
         {
             const auto& surface = surfs[surfIndex];
 
-            for (auto vertexIndex = 0u; vertexIndex < surface.vertCount; vertexIndex++)
-            {
-                const auto& v = surface.verts0[vertexIndex];
-                vec2_t uv{};
-                vec3_t normalVec{};
-                vec4_t color{};
-
-                Common::Vec2UnpackTexCoords(v.texCoord, &uv);
-                Common::Vec3UnpackUnitVec(v.normal, &normalVec);
-                Common::Vec4UnpackGfxColor(v.color, &color);
-
-                XModelVertex vertex{};
-                vertex.coordinates[0] = v.xyz.x;
-                vertex.coordinates[1] = v.xyz.y;
-                vertex.coordinates[2] = v.xyz.z;
-                vertex.normal[0] = normalVec.x;
-                vertex.normal[1] = normalVec.y;
-                vertex.normal[2] = normalVec.z;
-                vertex.color[0] = color.x;
-                vertex.color[1] = color.y;
-                vertex.color[2] = color.z;
-                vertex.color[3] = color.w;
-                vertex.uv[0] = uv.x;
-                vertex.uv[1] = uv.y;
-
-                out.m_vertices.emplace_back(vertex);
-            }
-        }
-    }
-
-    void AllocateXModelBoneWeights(const XModel* model, const unsigned lod, XModelVertexBoneWeightCollection& weightCollection)
-    {
-        const auto* surfs = &model->surfs[model->lodInfo[lod].surfIndex];
-        const auto surfCount = model->lodInfo[lod].numsurfs;
-
-        if (!surfs)
-            return;
-
-        auto totalWeightCount = 0u;
-        for (auto surfIndex = 0u; surfIndex < surfCount; surfIndex++)
-        {
-            const auto& surface = surfs[surfIndex];
-
-            if (surface.vertList)
-            {
-                totalWeightCount += surface.vertListCount;
-            }
+            if (surface.vertCount == 0u)
+                continue;
 
-            if (surface.vertInfo.vertsBlend)
-            {
-                totalWeightCount += surface.vertInfo.vertCount[0] * 1;
-                totalWeightCount += surface.vertInfo.vertCount[1] * 2;
-                totalWeightCount += surface.vertInfo.vertCount[2] * 3;
-                totalWeightCount += surface.vertInfo.vertCount[3] * 4;
-            }
+            const auto& v = surface.verts0[0];
+            vertexDecoder.AddVertices(v.xyz.v, &v.normal.packed, &v.color.packed, &v.texCoord.packed, surface.vertCount, sizeof(GfxPackedVertex));
         }
-
-        weightCollection.weights.resize(totalWeightCount);
-    }
-
-    float BoneWeight16(const uint16_t value)
-    {
-        return static_cast<float>(value) / static_cast<float>(std::numeric_limits<uint16_t>::max());
     }
 
-    void AddXModelVertexBoneWeights(XModelCommon& out, const XModel* model, const unsigned lod)
+    void AddXModelVertexBoneWeights(XModelVertexDecoder& vertexDecoder, const XModel* model, const unsigned lod)
     {
         const auto* surfs = &model->surfs[model->lodInfo[lod].surfIndex];
         const auto surfCount = model->lodInfo[lod].numsurfs;
-        auto& weightCollection = out.m_bone_weight_data;
 
         if (!surfs)
             return;
 
-        size_t weightOffset = 0u;
-
         for (auto surfIndex = 0u; surfIndex < surfCount; surfIndex++)
         {
             const auto& surface = surfs[surfIndex];
@@ -315,101 +257,29 @@ namespace
                 for (auto vertListIndex = 0u; vertListIndex < surface.vertListCount; vertListIndex++)
                 {
                     const auto& vertList = surface.vertList[vertListIndex];
-                    const auto* boneWeightOffset = &weightCollection.weights[weightOffset];
-
-                    weightCollection.weights[weightOffset++] = XModelBoneWeight{static_cast<int>(vertList.boneOffset / sizeof(DObjSkelMat)), 1.0f};
-
-                    for (auto vertListVertexOffset = 0u; vertListVertexOffset < vertList.vertCount; vertListVertexOffset++)
-                    {
-                        out.m_vertex_bone_weights.emplace_back(boneWeightOffset, 1);
-                    }
+                    vertexDecoder.AddRigidVertexBoneWeights(static_cast<int>(vertList.boneOffset / sizeof(DObjSkelMat)), vertList.vertCount);
                     handledVertices += vertList.vertCount;
                 }
             }
 
-            auto vertsBlendOffset = 0u;
             if (surface.vertInfo.vertsBlend)
             {
-                // 1 bone weight
-                for (auto vertIndex = 0; vertIndex < surface.vertInfo.vertCount[0]; vertIndex++)
+                // Blended vertices are sorted by the amount of bones that influence them
+                const auto* vertsBlend = surface.vertInfo.vertsBlend;
+                for (auto boneCount = 1u; boneCount <= std::extent_v<decltype(surface.vertInfo.vertCount)>; boneCount++)
                 {
-                    const auto* boneWeightOffset = &weightCollection.weights[weightOffset];
-                    const auto boneIndex0 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 0] / sizeof(DObjSkelMat));
-                    weightCollection.weights[weightOffset++] = XModelBoneWeight{boneIndex0, 1.0f};
-
-                    vertsBlendOffset += 1;
+                    const auto vertexCount = surface.vertInfo.vertCount[boneCount - 1u];
+                    if (vertexCount <= 0)
+                        continue;
 
-                    out.m_vertex_bone_weights.emplace_back(boneWeightOffset, 1);
+                    vertexDecoder.AddBlendedVertexBoneWeights(vertsBlend, vertexCount, boneCount, sizeof(DObjSkelMat));
+                    vertsBlend += vertexCount * (boneCount * 2u - 1u);
+                    handledVertices += vertexCount;
                 }
-
-                // 2 bone weights
-                for (auto vertIndex = 0; vertIndex < surface.vertInfo.vertCount[1]; vertIndex++)
-                {
-                    const auto* boneWeightOffset = &weightCollection.weights[weightOffset];
-                    const auto boneIndex0 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 0] / sizeof(DObjSkelMat));
-                    const auto boneIndex1 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 1] / sizeof(DObjSkelMat));
-                    const auto boneWeight1 = BoneWeight16(surface.vertInfo.vertsBlend[vertsBlendOffset + 2]);
-                    const auto boneWeight0 = 1.0f - boneWeight1;
-
-                    weightCollection.weights[weightOffset++] = XModelBoneWeight{boneIndex0, boneWeight0};
-                    weightCollection.weights[weightOffset++] = XModelBoneWeight{boneIndex1, boneWeight1};
-
-                    vertsBlendOffset += 3;
-
-                    out.m_vertex_bone_weights.emplace_back(boneWeightOffset, 2);
-                }
-
-                // 3 bone weights
-                for (auto vertIndex = 0; vertIndex < surface.vertInfo.vertCount[2]; vertIndex++)
-                {
-                    const auto* boneWeightOffset = &weightCollection.weights[weightOffset];
-                    const auto boneIndex0 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 0] / sizeof(DObjSkelMat));
-                    const auto boneIndex1 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 1] / sizeof(DObjSkelMat));
-                    const auto boneWeight1 = BoneWeight16(surface.vertInfo.vertsBlend[vertsBlendOffset + 2]);
-                    const auto boneIndex2 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 3] / sizeof(DObjSkelMat));
-                    const auto boneWeight2 = BoneWeight16(surface.vertInfo.vertsBlend[vertsBlendOffset + 4]);
-                    const auto boneWeight0 = 1.0f - boneWeight1 - boneWeight2;
-
-                    weightCollection.weights[weightOffset++] = XModelBoneWeight{boneIndex0, boneWeight0};
-                    weightCollection.weights[weightOffset++] = XModelBoneWeight{boneIndex1, boneWeight1};
-                    weightCollection.weights[weightOffset++] = XModelBoneWeight{boneIndex2, boneWeight2};
-
-                    vertsBlendOffset += 5;
-
-                    out.m_vertex_bone_weights.emplace_back(boneWeightOffset, 3);
-                }
-
-                // 4 bone weights
-                for (auto vertIndex = 0; vertIndex < surface.vertInfo.vertCount[3]; vertIndex++)
-                {
-                    const auto* boneWeightOffset = &weightCollection.weights[weightOffset];
-                    const auto boneIndex0 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 0] / sizeof(DObjSkelMat));
-                    const auto boneIndex1 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 1] / sizeof(DObjSkelMat));
-                    const auto boneWeight1 = BoneWeight16(surface.vertInfo.vertsBlend[vertsBlendOffset + 2]);
-                    const auto boneIndex2 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 3] / sizeof(DObjSkelMat));
-                    const auto boneWeight2 = BoneWeight16(surface.vertInfo.vertsBlend[vertsBlendOffset + 4]);
-                    const auto boneIndex3 = static_cast<int>(surface.vertInfo.vertsBlend[vertsBlendOffset + 5] / sizeof(DObjSkelMat));
-                    const auto boneWeight3 = BoneWeight16(surface.vertInfo.vertsBlend[vertsBlendOffset + 6]);
-                    const auto boneWeight0 = 1.0f - boneWeight1 - boneWeight2 - boneWeight3;
-
-                    weightCollection.weights[weightOffset++] = XModelBoneWeight{boneIndex0, boneWeight0};
-                    weightCollection.weights[weightOffset++] = XModelBoneWeight{boneIndex1, boneWeight1};
-                    weightCollection.weights[weightOffset++] = XModelBoneWeight{boneIndex2, boneWeight2};
-                    weightCollection.weights[weightOffset++] = XModelBoneWeight{boneIndex3, boneWeight3};
-
-                    vertsBlendOffset += 7;
-
-                    out.m_vertex_bone_weights.emplace_back(boneWeightOffset, 4);
-                }
-
-                handledVertices +=
-                    surface.vertInfo.vertCount[0] + surface.vertInfo.vertCount[1] + surface.vertInfo.vertCount[2] + surface.vertInfo.vertCount[3];
             }
 
-            for (; handledVertices < surface.vertCount; handledVertices++)
-            {
-                out.m_vertex_bone_weights.emplace_back(nullptr, 0);
-            }
+            if (handledVertices < surface.vertCount)
+                vertexDecoder.AddVerticesWithoutBoneWeights(surface.vertCount - handledVertices);
         }
     }
 
@@ -440,17 +310,24 @@ namespace
         }
     }
 
-    void PopulateXModelWriter(XModelCommon& out, const AssetDumpingContext& context, const unsigned lod, const XModel* model)
+    void PopulateXModelWriter(XModelCommon& out, const AssetDumpingContext& context, const XModel* model, DistinctMapper<Material*>& materialMapper)
     {
-        DistinctMapper<Material*> materialMapper(model->numsurfs);
-        AllocateXModelBoneWeights(model, lod, out.m_bone_weight_data);
-
-        out.m_name = std::format("{}_lod{}", model->name, lod);
         AddXModelBones(out, context, model);
         AddXModelMaterials(out, materialMapper, model);
+    }
+
+    void PopulateXModelWriterForLod(
+        XModelCommon& out, XModelVertexDecoder& vertexDecoder, const unsigned lod, const XModel* model, const DistinctMapper<Material*>& materialMapper)
+    {
+        // Bones and materials are the same for all lods. Everything else is replaced while keeping the buffers of the previous lod.
+        out.m_objects.clear();
+        vertexDecoder.Clear();
+
+        out.m_name = std::format("{}_lod{}", model->name, lod);
         AddXModelObjects(out, model, lod, materialMapper);
-        AddXModelVertices(out, model, lod);
-        AddXModelVertexBoneWeights(out, model, lod);
+        AddXModelVertices(vertexDecoder, model, lod);
+        AddXModelVertexBoneWeights(vertexDecoder, model, lod);
+        vertexDecoder.Decode(out);
         AddXModelFaces(out, model, lod);
     }
 
@@ -463,8 +340,6 @@ namespace
             return;
 
         const auto writer = obj::CreateMtlWriter(*mtlFile, context.m_zone->m_game->GetShortName(), context.m_zone->m_name);
-        DistinctMapper<Material*> materialMapper(model->numsurfs);
-
         writer->Write(common);
     }
 
@@ -478,8 +353,6 @@ namespace
 
         const auto writer =
             obj::CreateObjWriter(*assetFile, std::format("{}.mtl", model->name), context.m_zone->m_game->GetShortName(), context.m_zone->m_name);
-        DistinctMapper<Material*> materialMapper(model->numsurfs);
-
         writer->Write(common);
     }
 
@@ -515,10 +388,15 @@ namespace
     {
         const auto* model = asset->Asset();
 
+        XModelCommon common;
+        DistinctMapper<Material*> materialMapper(model->numsurfs);
+        PopulateXModelWriter(common, context, model, materialMapper);
+
+        XModelVertexDecoder vertexDecoder(Common::Vec2UnpackTexCoords, Common::Vec3UnpackUnitVec, Common::Vec4UnpackGfxColor);
+
         for (auto currentLod = 0u; currentLod < model->numLods; currentLod++)
         {
-            XModelCommon common;
-            PopulateXModelWriter(common, context, currentLod, asset->Asset());
+            PopulateXModelWriterForLod(common, vertexDecoder, currentLod, model, materialMapper);
 
             switch (ObjWriting::Configuration.ModelOutputFormat)
             {
@@ -2,10 +2,10 @@
 
 #include "Game/T6/CommonT6.h"
 #include "Game/T6/GameAssetPoolT6.h"
-#include "Game/T6/GameT6.h"
 #include "ObjWriting.h"
 #include "Shader/D3D11ShaderAnalyser.h"
 
+#include <algorithm>
 #include <chrono>
 
 namespace T6
@@ -478,7 +478,7 @@ namespace T6
         "ui3dSampler",
     };
 
-    void MaterialConstantZoneState::ExtractNamesFromZone()
+    void MaterialConstantZoneState::ExtractNamesFromZone(const AssetDumpingContext& context)
     {
         if (ObjWriting::Configuration.Verbose)
             std::cout << "Building material constant name lookup...\n";
@@ -487,23 +487,9 @@ namespace T6
 
         AddStaticKnownNames();
 
-        for (const auto* zone : g_GameT6.GetZones())
-        {
-            const auto* t6AssetPools = dynamic_cast<const GameAssetPoolT6*>(zone->m_pools.get());
-            if (!t6AssetPools)
-                return;
-
-            for (const auto* techniqueSetInfo : *t6AssetPools->m_technique_set)
-            {
-                const auto* techniqueSet = techniqueSetInfo->Asset();
-
-                for (const auto* technique : techniqueSet->techniques)
-                {
-                    if (technique)
-                        ExtractNamesFromTechnique(technique);
-                }
-            }
-        }
+        for (const auto* zone : context.m_dependency_zones)
+            ExtractNamesFromTechniqueSets(zone);
+        ExtractNamesFromTechniqueSets(context.m_zone);
 
         const auto end = std::chrono::high_resolution_clock::now();
 
@@ -515,6 +501,24 @@ namespace T6
         }
     }
 
+    void MaterialConstantZoneState::ExtractNamesFromTechniqueSets(const Zone* zone)
+    {
+        const auto* t6AssetPools = dynamic_cast<const GameAssetPoolT6*>(zone->m_pools.get());
+        if (!t6AssetPools)
+            return;
+
+        for (const auto* techniqueSetInfo : *t6AssetPools->m_technique_set)
+        {
+            const auto* techniqueSet = techniqueSetInfo->Asset();
+
+            for (const auto* technique : techniqueSet->techniques)
+            {
+                if (technique)
+                    ExtractNamesFromTechnique(technique);
+            }
+        }
+    }
+
     bool MaterialConstantZoneState::GetConstantName(const unsigned hash, std::string& constantName) const
     {
         const auto existingConstantName = m_constant_names_from_shaders.find(hash);
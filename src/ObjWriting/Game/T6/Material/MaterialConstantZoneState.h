@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Dumping/AssetDumpingContext.h"
 #include "Dumping/IZoneAssetDumperState.h"
 #include "Game/T6/T6.h"
 
@@ -12,11 +13,12 @@ namespace T6
     class MaterialConstantZoneState final : public IZoneAssetDumperState
     {
     public:
-        void ExtractNamesFromZone();
+        void ExtractNamesFromZone(const AssetDumpingContext& context);
         bool GetConstantName(unsigned hash, std::string& constantName) const;
         bool GetTextureDefName(unsigned hash, std::string& textureDefName) const;
 
     private:
+        void ExtractNamesFromTechniqueSets(const Zone* zone);
         void ExtractNamesFromTechnique(const MaterialTechnique* technique);
         void ExtractNamesFromShader(const char* shader, size_t shaderSize);
         void AddStaticKnownNames();
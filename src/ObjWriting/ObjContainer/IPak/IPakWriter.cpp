@@ -2,14 +2,22 @@
 
 #include "Game/T6/CommonT6.h"
 #include "Game/T6/GameT6.h"
+#include "Image/IwiFileCache.h"
 #include "ObjContainer/IPak/IPakTypes.h"
+#include "ObjLoading.h"
+#include "ObjWriting.h"
 #include "Utils/Alignment.h"
+#include "Utils/OrderedReadAhead.h"
+#include "Utils/ThreadPool.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <iostream>
 #include <minilzo.h>
+#include <mutex>
 #include <sstream>
-#include <zlib.h>
 
 class IPakWriterImpl final : public IPakWriter
 {
@@ -18,8 +26,39 @@ class IPakWriterImpl final : public IPakWriter
 
     inline static const std::string PAD_DATA = std::string(256, '\xA7');
 
+    // Amount of images that are read from the search path before they are written
+    static constexpr auto IMAGE_READ_AHEAD_COUNT = 2u;
+
+    // Upper bound for the data of images that are read from the search path but not written yet
+    static constexpr size_t IMAGE_READ_AHEAD_MAX_DATA_SIZE = 256u * 1024u * 1024u;
+
+    class PendingImage
+    {
+    public:
+        std::string m_name;
+        SearchPathOpenFile m_file;
+        std::unique_ptr<char[]> m_data;
+        size_t m_size = 0u;
+        unsigned m_data_hash = 0u;
+    };
+
+    class PendingCommand
+    {
+    public:
+        // Keeps the image data alive for commands that are still compressed after their image was written
+        std::shared_ptr<PendingImage> m_image;
+        size_t m_data_offset = 0u;
+        size_t m_data_size = 0u;
+
+        std::unique_ptr<unsigned char[]> m_output;
+        size_t m_output_size = 0u;
+        bool m_compressed = false;
+        bool m_done = false;
+        std::exception_ptr m_error;
+    };
+
 public:
-    explicit IPakWriterImpl(std::ostream& stream, ISearchPath* assetSearchPath)
+    IPakWriterImpl(std::ostream& stream, ISearchPath* assetSearchPath, ThreadPool* threadPool)
         : m_stream(stream),
           m_asset_search_path(assetSearchPath),
           m_current_offset(0),
@@ -31,12 +70,36 @@ public:
           m_file_offset(0u),
           m_chunk_buffer_window_start(0),
           m_current_block{},
-          m_current_block_header_offset(0)
+          m_current_block_header_offset(0),
+          m_pending_commands_data_offset(0u),
+          m_running_command_count(0u),
+          m_thread_pool(threadPool)
+    {
+        if (m_thread_pool == nullptr)
+        {
+            m_owned_thread_pool = std::make_unique<ThreadPool>(ThreadPool::DefaultThreadCount());
+            m_thread_pool = m_owned_thread_pool.get();
+        }
+
+        m_max_pending_command_count = m_thread_pool->GetThreadCount() * 2u;
+    }
+
+    ~IPakWriterImpl() override
     {
-        m_decompressed_buffer = std::make_unique<char[]>(ipak_consts::IPAK_CHUNK_SIZE);
-        m_lzo_work_buffer = std::make_unique<char[]>(LZO1X_1_MEM_COMPRESS);
+        // Commands that were compressed ahead of time but not used anymore may still be running and reference the writer
+        std::unique_lock lock(m_pending_mutex);
+        m_pending_finished.wait(lock,
+                                [this]
+                                {
+                                    return m_running_command_count == 0u;
+                                });
     }
 
+    IPakWriterImpl(const IPakWriterImpl& other) = delete;
+    IPakWriterImpl(IPakWriterImpl&& other) noexcept = delete;
+    IPakWriterImpl& operator=(const IPakWriterImpl& other) = delete;
+    IPakWriterImpl& operator=(IPakWriterImpl&& other) noexcept = delete;
+
     void AddImage(std::string imageName) override
     {
         m_images.emplace_back(std::move(imageName));
@@ -117,22 +180,156 @@ public:
         return ss.str();
     }
 
-    std::unique_ptr<char[]> ReadImageDataFromSearchPath(const std::string& imageName, size_t& imageSize) const
+    size_t OpenImageFromSearchPath(const std::string& imageName, PendingImage& image) const
     {
         const auto fileName = ImageFileName(imageName);
 
-        const auto openFile = m_asset_search_path->Open(fileName);
-        if (!openFile.IsOpen())
+        image.m_name = imageName;
+        image.m_file = m_asset_search_path->Open(fileName);
+        if (!image.m_file.IsOpen())
         {
             std::cerr << "Could not open image for writing to IPak \"" << fileName << "\"\n";
-            return nullptr;
+            return 0u;
+        }
+
+        return static_cast<size_t>(image.m_file.m_length);
+    }
+
+    static void ReadImage(PendingImage& image)
+    {
+        if (!image.m_file.IsOpen())
+            return;
+
+        const auto file = std::move(image.m_file);
+        image.m_size = static_cast<size_t>(file.m_length);
+        image.m_data = std::make_unique<char[]>(image.m_size);
+        file.m_stream->read(image.m_data.get(), static_cast<std::streamsize>(image.m_size));
+        auto* iwiFileCache = ObjLoading::Configuration.ImageFileCache;
+        if (iwiFileCache)
+            image.m_data_hash = iwiFileCache->GetDataHash(file, image.m_data.get(), image.m_size);
+        else
+            image.m_data_hash = IwiFileCache::HashData(image.m_data.get(), image.m_size);
+    }
+
+    static void CompressCommand(PendingCommand& command)
+    {
+        if (!USE_COMPRESSION)
+            return;
+
+        thread_local auto lzoWorkBuffer = std::make_unique<char[]>(LZO1X_1_MEM_COMPRESS);
+
+        // Worst case size of lzo output for incompressible data
+        command.m_output = std::make_unique<unsigned char[]>(command.m_data_size + command.m_data_size / 16u + 64u + 3u);
+
+        auto outLen = static_cast<lzo_uint>(0u);
+        const auto result = lzo1x_1_compress(reinterpret_cast<const unsigned char*>(&command.m_image->m_data[command.m_data_offset]),
+                                             command.m_data_size,
+                                             command.m_output.get(),
+                                             &outLen,
+                                             lzoWorkBuffer.get());
+
+        command.m_compressed = result == LZO_E_OK && outLen < command.m_data_size;
+        command.m_output_size = static_cast<size_t>(outLen);
+    }
+
+    void QueuePendingCommand(const std::shared_ptr<PendingImage>& image, const size_t dataOffset)
+    {
+        auto command = std::make_shared<PendingCommand>();
+        command->m_image = image;
+        command->m_data_offset = dataOffset;
+        command->m_data_size = std::min(image->m_size - dataOffset, static_cast<size_t>(ipak_consts::IPAK_COMMAND_DEFAULT_SIZE));
+        m_pending_commands.emplace_back(command);
+
+        {
+            std::lock_guard lock(m_pending_mutex);
+            m_running_command_count++;
+        }
+
+        m_thread_pool->Enqueue(
+            [this, command]
+            {
+                std::exception_ptr error;
+                try
+                {
+                    CompressCommand(*command);
+                }
+                catch (...)
+                {
+                    error = std::current_exception();
+                }
+
+                std::lock_guard lock(m_pending_mutex);
+                command->m_error = error;
+                command->m_done = true;
+                m_running_command_count--;
+                m_pending_finished.notify_all();
+            });
+    }
+
+    void QueuePendingCommandsAhead(const std::shared_ptr<PendingImage>& image)
+    {
+        if (!USE_COMPRESSION)
+            return;
+
+        while (m_pending_commands.size() < m_max_pending_command_count)
+        {
+            const auto nextDataOffset =
+                m_pending_commands.empty() ? m_pending_commands_data_offset : m_pending_commands.back()->m_data_offset + m_pending_commands.back()->m_data_size;
+
+            if (nextDataOffset >= image->m_size)
+                break;
+
+            QueuePendingCommand(image, nextDataOffset);
         }
+    }
 
-        imageSize = static_cast<size_t>(openFile.m_length);
-        auto imageData = std::make_unique<char[]>(imageSize);
-        openFile.m_stream->read(imageData.get(), imageSize);
+    /**
+     * \brief Starts compressing the commands following the specified offset ahead of time, assuming that they all have the default command size.
+     * This is the case until the end of the chunk buffer window where commands are shortened depending on the compressed size of the previous commands.
+     */
+    void StartCompressingAhead(const std::shared_ptr<PendingImage>& image, const size_t dataOffset)
+    {
+        m_pending_commands.clear();
+        m_pending_commands_data_offset = dataOffset;
 
-        return imageData;
+        QueuePendingCommandsAhead(image);
+    }
+
+    std::shared_ptr<PendingCommand> CompressCommandData(const std::shared_ptr<PendingImage>& image, const size_t dataOffset, const size_t dataSize)
+    {
+        if (!m_pending_commands.empty())
+        {
+            auto pendingCommand = std::move(m_pending_commands.front());
+            m_pending_commands.pop_front();
+
+            if (pendingCommand->m_data_offset == dataOffset && pendingCommand->m_data_size == dataSize)
+            {
+                QueuePendingCommandsAhead(image);
+
+                std::unique_lock lock(m_pending_mutex);
+                m_pending_finished.wait(lock,
+                                        [&pendingCommand]
+                                        {
+                                            return pendingCommand->m_done;
+                                        });
+
+                if (pendingCommand->m_error)
+                    std::rethrow_exception(pendingCommand->m_error);
+
+                return pendingCommand;
+            }
+
+            // The command was shortened so the following commands compressed ahead of time do not match either
+            m_pending_commands.clear();
+        }
+
+        auto command = std::make_shared<PendingCommand>();
+        command->m_image = image;
+        command->m_data_offset = dataOffset;
+        command->m_data_size = dataSize;
+        CompressCommand(*command);
+
+        return command;
     }
 
     void FlushBlock()
@@ -185,8 +382,13 @@ public:
         GoTo(m_current_offset + sizeof(IPakDataBlockHeader));
     }
 
-    void WriteChunkData(const void* data, const size_t dataSize)
+    void WriteChunkData(const std::shared_ptr<PendingImage>& image)
     {
+        const auto* data = image->m_data.get();
+        const auto dataSize = image->m_size;
+
+        StartCompressingAhead(image, 0u);
+
         auto dataOffset = 0u;
         while (dataOffset < dataSize)
         {
@@ -205,34 +407,23 @@ public:
             {
                 FlushChunk();
                 StartNewBlock();
+                StartCompressingAhead(image, dataOffset);
                 continue;
             }
 
             const auto commandSize = std::min(std::min(remainingSize, ipak_consts::IPAK_COMMAND_DEFAULT_SIZE), remainingChunkBufferWindowSize);
 
-            auto writeUncompressed = true;
-            if (USE_COMPRESSION)
+            const auto command = CompressCommandData(image, dataOffset, commandSize);
+            if (command->m_compressed)
             {
-                auto outLen = static_cast<lzo_uint>(ipak_consts::IPAK_CHUNK_SIZE);
-                const auto result = lzo1x_1_compress(&static_cast<const unsigned char*>(data)[dataOffset],
-                                                     commandSize,
-                                                     reinterpret_cast<unsigned char*>(m_decompressed_buffer.get()),
-                                                     &outLen,
-                                                     m_lzo_work_buffer.get());
-
-                if (result == LZO_E_OK && outLen < commandSize)
-                {
-                    writeUncompressed = false;
-                    Write(m_decompressed_buffer.get(), outLen);
+                Write(command->m_output.get(), command->m_output_size);
 
-                    const auto currentCommand = m_current_block.countAndOffset.count;
-                    m_current_block.commands[currentCommand].size = static_cast<uint32_t>(outLen);
-                    m_current_block.commands[currentCommand].compressed = ipak_consts::IPAK_COMMAND_COMPRESSED;
-                    m_current_block.countAndOffset.count = currentCommand + 1u;
-                }
+                const auto currentCommand = m_current_block.countAndOffset.count;
+                m_current_block.commands[currentCommand].size = static_cast<uint32_t>(command->m_output_size);
+                m_current_block.commands[currentCommand].compressed = ipak_consts::IPAK_COMMAND_COMPRESSED;
+                m_current_block.countAndOffset.count = currentCommand + 1u;
             }
-
-            if (writeUncompressed)
+            else
             {
                 Write(&static_cast<const char*>(data)[dataOffset], commandSize);
 
@@ -245,6 +436,8 @@ public:
             dataOffset += commandSize;
             m_file_offset += commandSize;
         }
+
+        m_pending_commands.clear();
     }
 
     void StartNewFile()
@@ -256,15 +449,13 @@ public:
         m_chunk_buffer_window_start = utils::AlignToPrevious(m_current_offset, static_cast<int64_t>(ipak_consts::IPAK_CHUNK_SIZE));
     }
 
-    bool WriteImageData(const std::string& imageName)
+    bool WriteImageData(const std::shared_ptr<PendingImage>& image)
     {
-        size_t imageSize;
-        const auto imageData = ReadImageDataFromSearchPath(imageName, imageSize);
-        if (!imageData)
+        if (!image->m_data)
             return false;
 
-        const auto nameHash = T6::Common::R_HashString(imageName.c_str(), 0);
-        const auto dataHash = static_cast<unsigned>(crc32(0u, reinterpret_cast<const Bytef*>(imageData.get()), imageSize));
+        const auto nameHash = T6::Common::R_HashString(image->m_name.c_str(), 0);
+        const auto dataHash = image->m_data_hash;
 
         StartNewFile();
         const auto startOffset = m_current_block_header_offset;
@@ -274,7 +465,7 @@ public:
         indexEntry.key.dataHash = dataHash & 0x1FFFFFFF;
         indexEntry.offset = static_cast<uint32_t>(startOffset - m_data_section_offset);
 
-        WriteChunkData(imageData.get(), imageSize);
+        WriteChunkData(image);
         const auto writtenImageSize = static_cast<size_t>(m_current_offset - startOffset);
 
         indexEntry.size = writtenImageSize;
@@ -291,11 +482,28 @@ public:
 
         m_index_entries.reserve(m_images.size());
 
-        const auto result = std::ranges::all_of(m_images,
-                                                [this](const std::string& imageName)
-                                                {
-                                                    return WriteImageData(imageName);
-                                                });
+        auto result = true;
+        {
+            OrderedReadAhead<PendingImage> readAhead(
+                *m_thread_pool,
+                m_images.size(),
+                IMAGE_READ_AHEAD_COUNT,
+                IMAGE_READ_AHEAD_MAX_DATA_SIZE,
+                [this](const size_t index, PendingImage& image)
+                {
+                    return OpenImageFromSearchPath(m_images[index], image);
+                },
+                ReadImage);
+
+            for (auto imageIndex = 0u; imageIndex < m_images.size(); imageIndex++)
+            {
+                if (!WriteImageData(readAhead.Next()))
+                {
+                    result = false;
+                    break;
+                }
+            }
+        }
 
         FlushBlock();
         m_data_section_size = static_cast<size_t>(m_current_offset - m_data_section_offset);
@@ -369,15 +577,24 @@ private:
     int64_t m_index_section_offset;
     int64_t m_branding_section_offset;
 
-    std::unique_ptr<char[]> m_decompressed_buffer;
-    std::unique_ptr<char[]> m_lzo_work_buffer;
     size_t m_file_offset;
     int64_t m_chunk_buffer_window_start;
     IPakDataBlockHeader m_current_block;
     int64_t m_current_block_header_offset;
+
+    // Commands are compressed ahead of time on the thread pool while the data is laid out in order
+    std::mutex m_pending_mutex;
+    std::condition_variable m_pending_finished;
+    std::deque<std::shared_ptr<PendingCommand>> m_pending_commands;
+    size_t m_pending_commands_data_offset;
+    size_t m_max_pending_command_count;
+    size_t m_running_command_count;
+
+    ThreadPool* m_thread_pool;
+    std::unique_ptr<ThreadPool> m_owned_thread_pool;
 };
 
 std::unique_ptr<IPakWriter> IPakWriter::Create(std::ostream& stream, ISearchPath* assetSearchPath)
 {
-    return std::make_unique<IPakWriterImpl>(stream, assetSearchPath);
+    return std::make_unique<IPakWriterImpl>(stream, assetSearchPath, ObjWriting::Configuration.IPakThreadPool);
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Dumping/AssetDumpingContext.h"
+#include "Utils/ThreadPool.h"
 #include "Zone/ZoneTypes.h"
 
 #include <vector>
@@ -26,14 +27,16 @@ public:
         };
 
         bool Verbose = false;
-        std::vector<bool> AssetTypesToHandleBitfield;
 
         ImageOutputFormat_e ImageOutputFormat = ImageOutputFormat_e::DDS;
         ModelOutputFormat_e ModelOutputFormat = ModelOutputFormat_e::GLB;
         bool MenuLegacyMode = false;
 
+        /**
+         * \brief The thread pool that ipak writers compress their data ahead of time on. If not set, every ipak writer creates its own one.
+         */
+        ThreadPool* IPakThreadPool = nullptr;
     } Configuration;
 
     static bool DumpZone(AssetDumpingContext& context);
-    static bool ShouldHandleAssetType(asset_type_t assetType);
 };
@@ -38,11 +38,13 @@ namespace
 
 bool AccuracyGraphWriter::ShouldDumpAiVsAiGraph(const std::string& graphName)
 {
+    std::lock_guard lock(m_mutex);
     return ShouldDumpAccuracyGraph(m_dumped_ai_vs_ai_graphs, graphName);
 }
 
 bool AccuracyGraphWriter::ShouldDumpAiVsPlayerGraph(const std::string& graphName)
 {
+    std::lock_guard lock(m_mutex);
     return ShouldDumpAccuracyGraph(m_dumped_ai_vs_player_graphs, graphName);
 }
 
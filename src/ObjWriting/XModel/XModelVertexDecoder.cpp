@@ -0,0 +1,241 @@
+#include "XModelVertexDecoder.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define XMODEL_VERTEX_DECODER_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    // The amount of vertices or bone weights that are decoded at once, which is small enough for their packed and unpacked data to stay in cache
+    constexpr size_t DECODE_BATCH_SIZE = 256u;
+
+    void UnpackBoneWeights(const uint16_t* in, float* out, const size_t count)
+    {
+        constexpr auto maxWeight = static_cast<float>(std::numeric_limits<uint16_t>::max());
+        size_t i = 0;
+
+#ifdef XMODEL_VERTEX_DECODER_SSE2
+        for (; i + 8 <= count; i += 8)
+        {
+            const auto packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&in[i]));
+            const auto low = _mm_cvtepi32_ps(_mm_unpacklo_epi16(packed, _mm_setzero_si128()));
+            const auto high = _mm_cvtepi32_ps(_mm_unpackhi_epi16(packed, _mm_setzero_si128()));
+            _mm_storeu_ps(&out[i], _mm_div_ps(low, _mm_set1_ps(maxWeight)));
+            _mm_storeu_ps(&out[i + 4], _mm_div_ps(high, _mm_set1_ps(maxWeight)));
+        }
+#endif
+
+        for (; i < count; i++)
+            out[i] = static_cast<float>(in[i]) / maxWeight;
+    }
+
+    template<size_t BoneCount>
+    void DecodeBlendedBoneWeights(const uint16_t* vertsBlend,
+                                  const size_t vertexCount,
+                                  const uint64_t boneOffsetReciprocal,
+                                  XModelBoneWeight* weights,
+                                  XModelVertexBoneWeights* vertexBoneWeights)
+    {
+        // The first weight is not packed, it is the weight that remains after all others
+        constexpr auto packedWeightCount = BoneCount - 1u;
+        constexpr auto blendSize = BoneCount * 2u - 1u;
+        constexpr auto batchVertexCount = DECODE_BATCH_SIZE / BoneCount;
+
+        uint16_t packedWeights[DECODE_BATCH_SIZE];
+        float unpackedWeights[DECODE_BATCH_SIZE];
+        for (auto batchOffset = 0u; batchOffset < vertexCount; batchOffset += batchVertexCount)
+        {
+            const auto batchSize = std::min(batchVertexCount, vertexCount - batchOffset);
+
+            if constexpr (packedWeightCount > 0u)
+            {
+                for (auto vertexIndex = 0u; vertexIndex < batchSize; vertexIndex++)
+                {
+                    for (auto weightIndex = 0u; weightIndex < packedWeightCount; weightIndex++)
+                        packedWeights[vertexIndex * packedWeightCount + weightIndex] = vertsBlend[vertexIndex * blendSize + weightIndex * 2u + 2u];
+                }
+
+                UnpackBoneWeights(packedWeights, unpackedWeights, batchSize * packedWeightCount);
+            }
+
+            for (auto vertexIndex = 0u; vertexIndex < batchSize; vertexIndex++)
+            {
+                auto firstWeight = 1.0f;
+                for (auto boneIndex = 1u; boneIndex < BoneCount; boneIndex++)
+                {
+                    const auto boneWeight = unpackedWeights[vertexIndex * packedWeightCount + boneIndex - 1u];
+                    weights[boneIndex] = XModelBoneWeight{static_cast<int>((vertsBlend[boneIndex * 2u - 1u] * boneOffsetReciprocal) >> 32u), boneWeight};
+                    firstWeight -= boneWeight;
+                }
+                weights[0] = XModelBoneWeight{static_cast<int>((vertsBlend[0] * boneOffsetReciprocal) >> 32u), firstWeight};
+
+                *vertexBoneWeights++ = XModelVertexBoneWeights{weights, BoneCount};
+                weights += BoneCount;
+                vertsBlend += blendSize;
+            }
+        }
+    }
+} // namespace
+
+XModelVertexDecoder::XModelVertexDecoder(const unpack_vec2_func_t unpackTexCoords, const unpack_vec3_func_t unpackUnitVec, const unpack_vec4_func_t unpackColor)
+    : m_unpack_tex_coords(unpackTexCoords),
+      m_unpack_unit_vec(unpackUnitVec),
+      m_unpack_color(unpackColor),
+      m_vertex_count(0u)
+{
+}
+
+void XModelVertexDecoder::Clear()
+{
+    m_vertex_spans.clear();
+    m_vertex_count = 0u;
+    m_bone_weight_sets.clear();
+}
+
+void XModelVertexDecoder::AddVertices(const float* coordinates,
+                                      const uint32_t* packedNormals,
+                                      const uint32_t* packedColors,
+                                      const uint32_t* packedTexCoords,
+                                      const size_t vertexCount,
+                                      const size_t vertexSize)
+{
+    m_vertex_spans.emplace_back(VertexSpan{reinterpret_cast<const char*>(coordinates),
+                                           reinterpret_cast<const char*>(packedNormals),
+                                           reinterpret_cast<const char*>(packedColors),
+                                           reinterpret_cast<const char*>(packedTexCoords),
+                                           vertexCount,
+                                           vertexSize});
+    m_vertex_count += vertexCount;
+}
+
+void XModelVertexDecoder::AddRigidVertexBoneWeights(const int boneIndex, const size_t vertexCount)
+{
+    m_bone_weight_sets.emplace_back(BoneWeightSet{nullptr, 0u, boneIndex, 1u, vertexCount});
+}
+
+void XModelVertexDecoder::AddBlendedVertexBoneWeights(const uint16_t* vertsBlend, const size_t vertexCount, const size_t boneCount, const size_t boneOffsetSize)
+{
+    assert(boneCount > 0u && boneCount <= MAX_BLEND_BONE_COUNT);
+    assert(boneOffsetSize > 0u && boneOffsetSize <= std::numeric_limits<uint16_t>::max());
+
+    // Multiplying a 16 bit offset with this reciprocal and shifting the result by 32 bits is the same as dividing it by the bone offset size
+    const auto boneOffsetReciprocal = (static_cast<uint64_t>(1u) << 32u) / boneOffsetSize + 1u;
+    m_bone_weight_sets.emplace_back(BoneWeightSet{vertsBlend, boneOffsetReciprocal, 0, boneCount, vertexCount});
+}
+
+void XModelVertexDecoder::AddVerticesWithoutBoneWeights(const size_t vertexCount)
+{
+    m_bone_weight_sets.emplace_back(BoneWeightSet{nullptr, 0u, 0, 0u, vertexCount});
+}
+
+void XModelVertexDecoder::DecodeVertices(XModelCommon& out) const
+{
+    out.m_vertices.resize(m_vertex_count);
+    auto* vertex = out.m_vertices.data();
+
+    uint32_t packedNormals[DECODE_BATCH_SIZE];
+    uint32_t packedColors[DECODE_BATCH_SIZE];
+    uint32_t packedTexCoords[DECODE_BATCH_SIZE];
+    float normals[3][DECODE_BATCH_SIZE];
+    float colors[4][DECODE_BATCH_SIZE];
+    float texCoords[2][DECODE_BATCH_SIZE];
+    for (const auto& span : m_vertex_spans)
+    {
+        for (auto batchOffset = 0u; batchOffset < span.m_vertex_count; batchOffset += DECODE_BATCH_SIZE)
+        {
+            const auto batchSize = std::min(DECODE_BATCH_SIZE, span.m_vertex_count - batchOffset);
+            for (auto batchIndex = 0u; batchIndex < batchSize; batchIndex++)
+            {
+                const auto dataOffset = (batchOffset + batchIndex) * span.m_vertex_size;
+                std::memcpy(&packedNormals[batchIndex], &span.m_packed_normals[dataOffset], sizeof(uint32_t));
+                std::memcpy(&packedColors[batchIndex], &span.m_packed_colors[dataOffset], sizeof(uint32_t));
+                std::memcpy(&packedTexCoords[batchIndex], &span.m_packed_tex_coords[dataOffset], sizeof(uint32_t));
+            }
+
+            m_unpack_unit_vec(packedNormals, normals[0], normals[1], normals[2], batchSize);
+            m_unpack_color(packedColors, colors[0], colors[1], colors[2], colors[3], batchSize);
+            m_unpack_tex_coords(packedTexCoords, texCoords[0], texCoords[1], batchSize);
+
+            for (auto batchIndex = 0u; batchIndex < batchSize; batchIndex++, vertex++)
+            {
+                std::memcpy(vertex->coordinates, &span.m_coordinates[(batchOffset + batchIndex) * span.m_vertex_size], sizeof(vertex->coordinates));
+                vertex->normal[0] = normals[0][batchIndex];
+                vertex->normal[1] = normals[1][batchIndex];
+                vertex->normal[2] = normals[2][batchIndex];
+                vertex->color[0] = colors[0][batchIndex];
+                vertex->color[1] = colors[1][batchIndex];
+                vertex->color[2] = colors[2][batchIndex];
+                vertex->color[3] = colors[3][batchIndex];
+                vertex->uv[0] = texCoords[0][batchIndex];
+                vertex->uv[1] = texCoords[1][batchIndex];
+            }
+        }
+    }
+}
+
+void XModelVertexDecoder::DecodeBoneWeights(XModelCommon& out) const
+{
+    size_t vertexCount = 0u;
+    size_t weightCount = 0u;
+    for (const auto& weightSet : m_bone_weight_sets)
+    {
+        vertexCount += weightSet.m_vertex_count;
+        weightCount += weightSet.m_verts_blend ? weightSet.m_vertex_count * weightSet.m_weight_count : weightSet.m_weight_count;
+    }
+
+    out.m_bone_weight_data.weights.resize(weightCount);
+    out.m_vertex_bone_weights.resize(vertexCount);
+
+    auto* weights = out.m_bone_weight_data.weights.data();
+    auto* vertexBoneWeights = out.m_vertex_bone_weights.data();
+    for (const auto& weightSet : m_bone_weight_sets)
+    {
+        if (weightSet.m_verts_blend)
+        {
+            switch (weightSet.m_weight_count)
+            {
+            case 1:
+                DecodeBlendedBoneWeights<1>(weightSet.m_verts_blend, weightSet.m_vertex_count, weightSet.m_bone_offset_reciprocal, weights, vertexBoneWeights);
+                break;
+            case 2:
+                DecodeBlendedBoneWeights<2>(weightSet.m_verts_blend, weightSet.m_vertex_count, weightSet.m_bone_offset_reciprocal, weights, vertexBoneWeights);
+                break;
+            case 3:
+                DecodeBlendedBoneWeights<3>(weightSet.m_verts_blend, weightSet.m_vertex_count, weightSet.m_bone_offset_reciprocal, weights, vertexBoneWeights);
+                break;
+            case 4:
+                DecodeBlendedBoneWeights<4>(weightSet.m_verts_blend, weightSet.m_vertex_count, weightSet.m_bone_offset_reciprocal, weights, vertexBoneWeights);
+                break;
+            default:
+                assert(false);
+                break;
+            }
+
+            weights += weightSet.m_vertex_count * weightSet.m_weight_count;
+        }
+        else if (weightSet.m_weight_count > 0u)
+        {
+            *weights = XModelBoneWeight{weightSet.m_bone_index, 1.0f};
+            std::fill_n(vertexBoneWeights, weightSet.m_vertex_count, XModelVertexBoneWeights{weights, 1u});
+            weights++;
+        }
+        else
+        {
+            std::fill_n(vertexBoneWeights, weightSet.m_vertex_count, XModelVertexBoneWeights{nullptr, 0u});
+        }
+
+        vertexBoneWeights += weightSet.m_vertex_count;
+    }
+}
+
+void XModelVertexDecoder::Decode(XModelCommon& out) const
+{
+    DecodeVertices(out);
+    DecodeBoneWeights(out);
+}
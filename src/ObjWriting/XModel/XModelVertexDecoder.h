@@ -0,0 +1,97 @@
+#pragma once
+
+#include "XModel/XModelCommon.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * \brief Decodes the packed vertices and bone weights of a model lod.
+ * All surfaces of the lod are gathered first and then decoded in structure of arrays batches, so every attribute can be unpacked with batched functions.
+ * Batches are small enough to stay in cache, so the packed data of the lod is only read once and the unpacked data is only written once to the model.
+ */
+class XModelVertexDecoder
+{
+public:
+    static constexpr size_t MAX_BLEND_BONE_COUNT = 4u;
+
+    typedef void (*unpack_vec2_func_t)(const uint32_t* in, float* out0, float* out1, size_t count);
+    typedef void (*unpack_vec3_func_t)(const uint32_t* in, float* out0, float* out1, float* out2, size_t count);
+    typedef void (*unpack_vec4_func_t)(const uint32_t* in, float* out0, float* out1, float* out2, float* out3, size_t count);
+
+private:
+    class VertexSpan
+    {
+    public:
+        const char* m_coordinates;
+        const char* m_packed_normals;
+        const char* m_packed_colors;
+        const char* m_packed_tex_coords;
+        size_t m_vertex_count;
+        size_t m_vertex_size;
+    };
+
+    class BoneWeightSet
+    {
+    public:
+        // Blended vertices are only read when decoding, rigid vertices share a single bone and vertices without bone weights have none
+        const uint16_t* m_verts_blend;
+        uint64_t m_bone_offset_reciprocal;
+        int m_bone_index;
+        size_t m_weight_count;
+        size_t m_vertex_count;
+    };
+
+    unpack_vec2_func_t m_unpack_tex_coords;
+    unpack_vec3_func_t m_unpack_unit_vec;
+    unpack_vec4_func_t m_unpack_color;
+
+    std::vector<VertexSpan> m_vertex_spans;
+    size_t m_vertex_count;
+
+    std::vector<BoneWeightSet> m_bone_weight_sets;
+
+    void DecodeVertices(XModelCommon& out) const;
+    void DecodeBoneWeights(XModelCommon& out) const;
+
+public:
+    XModelVertexDecoder(unpack_vec2_func_t unpackTexCoords, unpack_vec3_func_t unpackUnitVec, unpack_vec4_func_t unpackColor);
+
+    /**
+     * \brief Removes all vertices and bone weights to start with the next lod.
+     */
+    void Clear();
+
+    /**
+     * \brief Adds vertices whose attributes are stored in an array of structures.
+     * The vertices are only read when decoding, so they need to stay valid until then.
+     * \param coordinates The coordinates of the first vertex. The attributes of all other vertices follow with a distance of vertexSize.
+     */
+    void AddVertices(const float* coordinates,
+                     const uint32_t* packedNormals,
+                     const uint32_t* packedColors,
+                     const uint32_t* packedTexCoords,
+                     size_t vertexCount,
+                     size_t vertexSize);
+
+    /**
+     * \brief Adds a single bone weight that is shared by vertices that are only influenced by one bone.
+     */
+    void AddRigidVertexBoneWeights(int boneIndex, size_t vertexCount);
+
+    /**
+     * \brief Adds the bone weights of vertices that are influenced by the same amount of bones, which can be at most MAX_BLEND_BONE_COUNT.
+     * The blend data is only read when decoding, so it needs to stay valid until then.
+     * \param vertsBlend The blend data as it is stored in surfaces: The offset of the first bone followed by an offset and a weight for each other bone.
+     * \param boneOffsetSize The size that bone offsets are divided by to get bone indices.
+     */
+    void AddBlendedVertexBoneWeights(const uint16_t* vertsBlend, size_t vertexCount, size_t boneCount, size_t boneOffsetSize);
+
+    void AddVerticesWithoutBoneWeights(size_t vertexCount);
+
+    /**
+     * \brief Unpacks all added vertices and bone weights and replaces the vertices and bone weights of the model with them.
+     */
+    void Decode(XModelCommon& out) const;
+};
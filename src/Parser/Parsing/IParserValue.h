@@ -1,5 +1,6 @@
 #pragma once
 
+#include "TokenDispatchKey.h"
 #include "TokenPos.h"
 #include "Utils/ClassUtils.h"
 
@@ -17,4 +18,14 @@ public:
 
     _NODISCARD virtual bool IsEof() const = 0;
     _NODISCARD virtual const TokenPos& GetPos() const = 0;
+
+    /**
+     * \brief Gets the key sequences starting with this token are dispatched on.
+     * \param key The dispatch key of the token.
+     * \return \c true if the token supports dispatching, \c false if all sequences need to be tried for it.
+     */
+    _NODISCARD virtual bool GetDispatchKey(TokenDispatchKey& key) const
+    {
+        return false;
+    }
 };
@@ -4,8 +4,10 @@
 #include "Parsing/IParser.h"
 #include "Parsing/ParsingException.h"
 #include "Parsing/Sequence/AbstractSequence.h"
+#include "Parsing/Sequence/SequenceDispatchTable.h"
 
 #include <iostream>
+#include <unordered_map>
 #include <vector>
 
 template<typename TokenType, typename ParserState> class AbstractParser : public IParser
@@ -16,24 +18,68 @@ template<typename TokenType, typename ParserState> class AbstractParser : public
 public:
     typedef AbstractSequence<TokenType, ParserState> sequence_t;
 
+private:
+    bool m_dispatch_sequences;
+    std::unordered_map<const std::vector<sequence_t*>*, SequenceDispatchTable<TokenType, ParserState>> m_dispatch_tables;
+
+    const std::vector<sequence_t*>& GetCandidateTestsForState()
+    {
+        const auto& availableTests = GetTestsForState();
+        if (!m_dispatch_sequences)
+            return availableTests;
+
+        auto foundTable = m_dispatch_tables.find(&availableTests);
+        if (foundTable == m_dispatch_tables.end())
+            foundTable = m_dispatch_tables.emplace(&availableTests, SequenceDispatchTable<TokenType, ParserState>(availableTests)).first;
+
+        return foundTable->second.GetCandidates(m_lexer->GetToken(0));
+    }
+
 protected:
     ILexer<TokenType>* m_lexer;
     std::unique_ptr<ParserState> m_state;
 
     explicit AbstractParser(ILexer<TokenType>* lexer, std::unique_ptr<ParserState> state)
-        : m_lexer(lexer),
+        : m_dispatch_sequences(false),
+          m_lexer(lexer),
           m_state(std::move(state))
     {
     }
 
     virtual const std::vector<sequence_t*>& GetTestsForState() = 0;
 
+    /**
+     * \brief Only tries the sequences whose leading matcher can match the next token instead of all sequences returned by \c GetTestsForState.
+     * Sequences are dispatched with a table that is built the first time a collection is returned by \c GetTestsForState,
+     * so collections must not change afterwards.
+     */
+    void EnableSequenceDispatch()
+    {
+        m_dispatch_sequences = true;
+        m_dispatch_tables.clear();
+    }
+
 public:
     ~AbstractParser() override = default;
-    AbstractParser(const AbstractParser& other) = default;
-    AbstractParser(AbstractParser&& other) noexcept = default;
-    AbstractParser& operator=(const AbstractParser& other) = default;
-    AbstractParser& operator=(AbstractParser&& other) noexcept = default;
+    AbstractParser(const AbstractParser& other) = delete;
+    AbstractParser& operator=(const AbstractParser& other) = delete;
+
+    // Dispatch tables are keyed by the sequence collections of the parser they were built for, so they are rebuilt after moving
+    AbstractParser(AbstractParser&& other) noexcept
+        : m_dispatch_sequences(other.m_dispatch_sequences),
+          m_lexer(other.m_lexer),
+          m_state(std::move(other.m_state))
+    {
+    }
+
+    AbstractParser& operator=(AbstractParser&& other) noexcept
+    {
+        m_dispatch_sequences = other.m_dispatch_sequences;
+        m_dispatch_tables.clear();
+        m_lexer = other.m_lexer;
+        m_state = std::move(other.m_state);
+        return *this;
+    }
 
     bool Parse() override
     {
@@ -42,7 +88,7 @@ public:
             while (!m_lexer->IsEof())
             {
                 auto testSuccessful = false;
-                const auto& availableTests = GetTestsForState();
+                const auto& availableTests = GetCandidateTestsForState();
 
                 for (const sequence_t* test : availableTests)
                 {
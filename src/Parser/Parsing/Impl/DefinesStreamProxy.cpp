@@ -8,6 +8,7 @@
 #include "Utils/ClassUtils.h"
 #include "Utils/StringUtils.h"
 
+#include <cassert>
 #include <regex>
 #include <sstream>
 #include <utility>
@@ -1086,9 +1087,140 @@ void DefinesStreamProxy::Undefine(const std::string& name)
         m_defines.erase(entry);
 }
 
+bool DefinesStreamProxy::GetSnapshotState(std::string& state) const
+{
+    if (!IsInSnapshotState())
+        return false;
+
+    std::ostringstream str;
+    str << (m_skip_directive_lines ? '1' : '0');
+    for (const auto& [name, define] : m_defines)
+    {
+        str << name << '\0' << define.m_value << '\0' << (define.m_contains_token_pasting_operators ? '1' : '0');
+        for (const auto& parameterPosition : define.m_parameter_positions)
+            str << parameterPosition.m_parameter_index << ',' << parameterPosition.m_parameter_position << ',' << (parameterPosition.m_stringize ? '1' : '0') << ';';
+        str << '\0';
+    }
+
+    state = str.str();
+    return true;
+}
+
+void DefinesStreamProxy::RecordSnapshot(snapshot_callback_t callback)
+{
+    // Recorded files cannot include other files, so a recording that is still active belongs to a file that already ended
+    FinishSnapshotRecording();
+
+    SnapshotRecording recording;
+    recording.m_block_depth = m_modes.size();
+    recording.m_snapshot = std::make_shared<Snapshot>();
+    recording.m_callback = std::move(callback);
+
+    m_snapshot_recording = std::move(recording);
+}
+
+void DefinesStreamProxy::ApplySnapshot(const Snapshot& snapshot)
+{
+    assert(IsInSnapshotState());
+
+    // The defines of the snapshot must not end up in the snapshot of a file that was included before
+    FinishSnapshotRecording();
+
+    m_defines = snapshot.m_defines;
+    m_replayed_lines.insert(m_replayed_lines.end(), snapshot.m_lines.begin(), snapshot.m_lines.end());
+}
+
+bool DefinesStreamProxy::IsInSnapshotState() const
+{
+    return !m_in_define && m_multi_line_macro_parameters.m_parameter_state == ParameterState::NOT_IN_PARAMETERS
+           && (m_modes.empty() || m_modes.top() == BlockMode::IN_BLOCK) && m_ignore_depth == 0;
+}
+
+void DefinesStreamProxy::ContinueSnapshotRecording(const ParserLine& line)
+{
+    auto& recording = *m_snapshot_recording;
+
+    // The first line after starting a recording is the first line of the included file
+    if (!recording.m_file)
+    {
+        if (line.IsEof())
+            m_snapshot_recording.reset();
+        else
+            recording.m_file = line.m_filename;
+        return;
+    }
+
+    if (line.m_filename != recording.m_file)
+        FinishSnapshotRecording();
+}
+
+void DefinesStreamProxy::FinishSnapshotRecording()
+{
+    if (!m_snapshot_recording)
+        return;
+
+    auto& recording = *m_snapshot_recording;
+
+    // The included file ended, it can only be replayed if it did not leave any directive open
+    if (recording.m_file && IsInSnapshotState() && m_modes.size() == recording.m_block_depth)
+    {
+        recording.m_snapshot->m_defines = m_defines;
+        recording.m_callback(std::move(recording.m_snapshot));
+    }
+
+    m_snapshot_recording.reset();
+}
+
+bool DefinesStreamProxy::ReadLine(ParserLine& line)
+{
+    if (m_pending_line)
+    {
+        line = std::move(*m_pending_line);
+        m_pending_line.reset();
+        return true;
+    }
+
+    line = m_stream->NextLine();
+
+    if (m_snapshot_recording)
+        ContinueSnapshotRecording(line);
+
+    // Reading the line may have included a file that was replaced by a snapshot, so its lines need to come first
+    if (!m_replayed_lines.empty())
+    {
+        m_pending_line = std::move(line);
+        return false;
+    }
+
+    return true;
+}
+
+ParserLine DefinesStreamProxy::TakeReplayedLine()
+{
+    auto line = std::move(m_replayed_lines.front());
+    m_replayed_lines.pop_front();
+
+    return line;
+}
+
 ParserLine DefinesStreamProxy::NextLine()
 {
-    auto line = m_stream->NextLine();
+    auto line = ProcessNextLine();
+
+    if (m_snapshot_recording && m_snapshot_recording->m_file && line.m_filename == m_snapshot_recording->m_file)
+        m_snapshot_recording->m_snapshot->m_lines.emplace_back(line);
+
+    return line;
+}
+
+ParserLine DefinesStreamProxy::ProcessNextLine()
+{
+    if (!m_replayed_lines.empty())
+        return TakeReplayedLine();
+
+    ParserLine line;
+    if (!ReadLine(line))
+        return TakeReplayedLine();
 
     while (true)
     {
@@ -1109,7 +1241,8 @@ ParserLine DefinesStreamProxy::NextLine()
                 return line;
             }
 
-            line = m_stream->NextLine();
+            if (!ReadLine(line))
+                return TakeReplayedLine();
         }
         else if (m_multi_line_macro_parameters.m_parameter_state != ParameterState::NOT_IN_PARAMETERS)
         {
@@ -1124,7 +1257,8 @@ ParserLine DefinesStreamProxy::NextLine()
                 return line;
             }
 
-            line = m_stream->NextLine();
+            if (!ReadLine(line))
+                return TakeReplayedLine();
         }
         else
         {
@@ -1151,5 +1285,5 @@ bool DefinesStreamProxy::IsOpen() const
 
 bool DefinesStreamProxy::Eof() const
 {
-    return m_stream->Eof();
+    return m_replayed_lines.empty() && !m_pending_line && m_stream->Eof();
 }
@@ -4,7 +4,11 @@
 #include "Parsing/IParserLineStream.h"
 #include "Parsing/Simple/Expression/ISimpleExpression.h"
 
+#include <deque>
+#include <functional>
 #include <map>
+#include <memory>
+#include <optional>
 #include <set>
 #include <sstream>
 #include <stack>
@@ -71,6 +75,18 @@ public:
         MacroParameterState();
     };
 
+    /**
+     * \brief The result of preprocessing a single included file: The define table after it was processed and the lines it emitted.
+     */
+    class Snapshot
+    {
+    public:
+        std::map<std::string, Define> m_defines;
+        std::vector<ParserLine> m_lines;
+    };
+
+    using snapshot_callback_t = std::function<void(std::shared_ptr<Snapshot> snapshot)>;
+
 private:
     enum class BlockMode : uint8_t
 
@@ -95,6 +111,19 @@ private:
     const Define* m_current_macro;
     MacroParameterState m_multi_line_macro_parameters;
 
+    class SnapshotRecording
+    {
+    public:
+        std::shared_ptr<std::string> m_file;
+        size_t m_block_depth;
+        std::shared_ptr<Snapshot> m_snapshot;
+        snapshot_callback_t m_callback;
+    };
+
+    std::optional<SnapshotRecording> m_snapshot_recording;
+    std::deque<ParserLine> m_replayed_lines;
+    std::optional<ParserLine> m_pending_line;
+
     static int GetLineEndEscapePos(const ParserLine& line);
     void MatchDefineParameters(const ParserLine& line, unsigned& currentPos);
     void ContinueDefine(const ParserLine& line, unsigned currentPos);
@@ -132,12 +161,38 @@ private:
     void ProcessMacrosSingleLine(ParserLine& line);
     void ProcessMacrosMultiLine(ParserLine& line);
 
+    _NODISCARD bool IsInSnapshotState() const;
+    void ContinueSnapshotRecording(const ParserLine& line);
+    void FinishSnapshotRecording();
+    _NODISCARD bool ReadLine(ParserLine& line);
+    ParserLine TakeReplayedLine();
+    ParserLine ProcessNextLine();
+
 public:
     explicit DefinesStreamProxy(IParserLineStream* stream, bool skipDirectiveLines = false);
 
     void AddDefine(Define define);
     void Undefine(const std::string& name);
 
+    /**
+     * \brief Describes the current define table if the proxy is in a state where an included file can be replaced by a snapshot.
+     * \param state The description of the define table that snapshots taken from this state are valid for.
+     * \return \c true if the proxy is outside of any define, macro usage or disabled block, \c false otherwise.
+     */
+    _NODISCARD bool GetSnapshotState(std::string& state) const;
+
+    /**
+     * \brief Records the preprocessing result of the file that is going to be included next. Finishes any recording of a previously included file.
+     * \param callback The callback to call with the snapshot once the file was fully processed. Is not called when the file did not leave a clean state.
+     */
+    void RecordSnapshot(snapshot_callback_t callback);
+
+    /**
+     * \brief Applies a snapshot in place of processing an included file. Its lines are emitted before any further lines of the underlying stream.
+     * \param snapshot The snapshot taken from the same state as the current one.
+     */
+    void ApplySnapshot(const Snapshot& snapshot);
+
     _NODISCARD std::unique_ptr<ISimpleExpression> ParseExpression(std::shared_ptr<std::string> fileName, int lineNumber, std::string expressionString);
 
     ParserLine NextLine() override;
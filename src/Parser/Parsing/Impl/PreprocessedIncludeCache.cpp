@@ -0,0 +1,99 @@
+#include "PreprocessedIncludeCache.h"
+
+#include <sstream>
+
+namespace
+{
+    bool ContainsDirective(const std::string& content, const char* directive)
+    {
+        const auto directiveLength = std::char_traits<char>::length(directive);
+
+        for (auto pos = content.find('#'); pos != std::string::npos; pos = content.find('#', pos + 1))
+        {
+            auto directivePos = pos + 1;
+            while (directivePos < content.size() && (content[directivePos] == ' ' || content[directivePos] == '\t'))
+                directivePos++;
+
+            if (content.compare(directivePos, directiveLength, directive) == 0)
+                return true;
+        }
+
+        return false;
+    }
+} // namespace
+
+bool PreprocessedIncludeCache::Key::operator==(const Key& other) const
+{
+    return m_content == other.m_content && m_state == other.m_state;
+}
+
+size_t PreprocessedIncludeCache::KeyHash::operator()(const Key& key) const noexcept
+{
+    const auto contentHash = std::hash<std::string>()(key.m_content);
+    const auto stateHash = std::hash<std::string>()(key.m_state);
+
+    return contentHash ^ (stateHash + 0x9e3779b9 + (contentHash << 6) + (contentHash >> 2));
+}
+
+bool PreprocessedIncludeCache::IsCacheable(const std::string& content)
+{
+    // Nested includes and pragmas are handled below the defines proxy and cannot be replayed by it
+    if (content.empty() || ContainsDirective(content, "include") || ContainsDirective(content, "pragma"))
+        return false;
+
+    // Files ending within a multi line comment would comment out lines of the including file
+
+    const auto lastCommentStart = content.rfind("/*");
+    return lastCommentStart == std::string::npos || content.find("*/", lastCommentStart + 2) != std::string::npos;
+}
+
+std::shared_ptr<const DefinesStreamProxy::Snapshot> PreprocessedIncludeCache::FindSnapshot(const Key& key)
+{
+    std::lock_guard lock(m_mutex);
+
+    const auto existingSnapshot = m_snapshots.find(key);
+    if (existingSnapshot != m_snapshots.end())
+        return existingSnapshot->second;
+
+    return nullptr;
+}
+
+void PreprocessedIncludeCache::AddSnapshot(Key key, std::shared_ptr<const DefinesStreamProxy::Snapshot> snapshot)
+{
+    std::lock_guard lock(m_mutex);
+    m_snapshots.emplace(std::move(key), std::move(snapshot));
+}
+
+std::unique_ptr<std::istream> PreprocessedIncludeCache::OpenInclude(std::istream& stream, DefinesStreamProxy& defines)
+{
+    std::ostringstream contentStream;
+    contentStream << stream.rdbuf();
+
+    Key key;
+    key.m_content = contentStream.str();
+
+    if (!IsCacheable(key.m_content) || !defines.GetSnapshotState(key.m_state))
+        return std::make_unique<std::istringstream>(std::move(key.m_content));
+
+    const auto snapshot = FindSnapshot(key);
+    if (snapshot)
+    {
+        defines.ApplySnapshot(*snapshot);
+        return std::make_unique<std::istringstream>();
+    }
+
+    auto content = key.m_content;
+    defines.RecordSnapshot(
+        [this, key = std::move(key)](std::shared_ptr<DefinesStreamProxy::Snapshot> recordedSnapshot) mutable
+        {
+            AddSnapshot(std::move(key), std::move(recordedSnapshot));
+        });
+
+    return std::make_unique<std::istringstream>(std::move(content));
+}
+
+size_t PreprocessedIncludeCache::GetSnapshotCount()
+{
+    std::lock_guard lock(m_mutex);
+    return m_snapshots.size();
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "DefinesStreamProxy.h"
+
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/**
+ * \brief Caches the preprocessing result of included files so parsers that include the same file from the same define state can skip reading it again.
+ */
+class PreprocessedIncludeCache
+{
+    class Key
+    {
+    public:
+        std::string m_content;
+        std::string m_state;
+
+        bool operator==(const Key& other) const;
+    };
+
+    class KeyHash
+    {
+    public:
+        size_t operator()(const Key& key) const noexcept;
+    };
+
+    std::mutex m_mutex;
+    std::unordered_map<Key, std::shared_ptr<const DefinesStreamProxy::Snapshot>, KeyHash> m_snapshots;
+
+    _NODISCARD static bool IsCacheable(const std::string& content);
+    _NODISCARD std::shared_ptr<const DefinesStreamProxy::Snapshot> FindSnapshot(const Key& key);
+    void AddSnapshot(Key key, std::shared_ptr<const DefinesStreamProxy::Snapshot> snapshot);
+
+public:
+    PreprocessedIncludeCache() = default;
+    ~PreprocessedIncludeCache() = default;
+    PreprocessedIncludeCache(const PreprocessedIncludeCache& other) = delete;
+    PreprocessedIncludeCache(PreprocessedIncludeCache&& other) noexcept = delete;
+    PreprocessedIncludeCache& operator=(const PreprocessedIncludeCache& other) = delete;
+    PreprocessedIncludeCache& operator=(PreprocessedIncludeCache&& other) noexcept = delete;
+
+    /**
+     * \brief Prepares an included file for the specified defines proxy. Either seeds the proxy from a snapshot or records one while the file is processed.
+     * \param stream The stream of the included file.
+     * \param defines The defines proxy that is going to process the included file.
+     * \return The stream that should be included in place of the original one.
+     */
+    std::unique_ptr<std::istream> OpenInclude(std::istream& stream, DefinesStreamProxy& defines);
+
+    _NODISCARD size_t GetSnapshotCount();
+};
@@ -3,8 +3,10 @@
 #include "Parsing/ILexer.h"
 #include "Parsing/IParserValue.h"
 #include "Parsing/Matcher/MatcherResult.h"
+#include "Parsing/TokenDispatchKey.h"
 
 #include <functional>
+#include <vector>
 
 template<typename TokenType> class AbstractMatcher
 {
@@ -54,6 +56,16 @@ public:
         m_no_consume = !value;
     }
 
+    /**
+     * \brief Collects the dispatch keys of all tokens a match of this matcher can start with.
+     * \param keys The list to add the dispatch keys to.
+     * \return \c true if every match starts with a token of one of the collected keys, \c false if the matcher cannot tell.
+     */
+    _NODISCARD virtual bool GetFirstTokenDispatchKeys(std::vector<TokenDispatchKey>& keys) const
+    {
+        return false;
+    }
+
     void SetTransform(std::function<TokenType(std::vector<std::reference_wrapper<const TokenType>>&)> transform)
     {
         m_transform_func = std::move(transform);
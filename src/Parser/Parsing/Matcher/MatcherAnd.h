@@ -32,6 +32,11 @@ protected:
     }
 
 public:
+    _NODISCARD bool GetFirstTokenDispatchKeys(std::vector<TokenDispatchKey>& keys) const override
+    {
+        return !m_matchers.empty() && m_matchers.front()->GetFirstTokenDispatchKeys(keys);
+    }
+
     MatcherAnd(std::initializer_list<Movable<std::unique_ptr<AbstractMatcher<TokenType>>>> matchers)
         : m_matchers(std::make_move_iterator(matchers.begin()), std::make_move_iterator(matchers.end()))
     {
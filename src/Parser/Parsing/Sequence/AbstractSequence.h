@@ -72,6 +72,16 @@ public:
         return nullptr;
     }
 
+    /**
+     * \brief Collects the dispatch keys of all tokens a match of this sequence can start with.
+     * \param keys The list to add the dispatch keys to.
+     * \return \c true if every match starts with a token of one of the collected keys, \c false if the sequence cannot tell.
+     */
+    _NODISCARD bool GetFirstTokenDispatchKeys(std::vector<TokenDispatchKey>& keys) const
+    {
+        return m_entry && m_entry->GetFirstTokenDispatchKeys(keys);
+    }
+
     _NODISCARD bool MatchSequence(ILexer<TokenType>* lexer, ParserState* state, unsigned& consumedTokenCount) const
     {
         if (!m_entry)
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "AbstractSequence.h"
+#include "Parsing/IParserValue.h"
+
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <unordered_map>
+#include <vector>
+
+template<typename TokenType, typename ParserState> class SequenceDispatchTable
+{
+    // TokenType must inherit IParserValue
+    static_assert(std::is_base_of<IParserValue, TokenType>::value);
+
+public:
+    typedef AbstractSequence<TokenType, ParserState> sequence_t;
+
+private:
+    class TypeEntry
+    {
+    public:
+        std::vector<size_t> m_type_sequences;
+        std::unordered_map<size_t, std::vector<size_t>> m_value_sequences;
+
+        std::vector<sequence_t*> m_type_candidates;
+        std::unordered_map<size_t, std::vector<sequence_t*>> m_value_candidates;
+    };
+
+    const std::vector<sequence_t*>* m_sequences;
+    std::vector<sequence_t*> m_undispatched_candidates;
+    std::unordered_map<size_t, TypeEntry> m_types;
+
+    std::vector<sequence_t*> ToCandidates(const std::vector<size_t>& dispatchedSequences, const std::vector<size_t>& undispatchedSequences) const
+    {
+        std::vector<size_t> sequenceIndices;
+        sequenceIndices.reserve(dispatchedSequences.size() + undispatchedSequences.size());
+        std::ranges::set_union(dispatchedSequences, undispatchedSequences, std::back_inserter(sequenceIndices));
+
+        std::vector<sequence_t*> candidates;
+        candidates.reserve(sequenceIndices.size());
+        for (const auto sequenceIndex : sequenceIndices)
+            candidates.emplace_back((*m_sequences)[sequenceIndex]);
+
+        return candidates;
+    }
+
+    static void AddSequenceIndex(std::vector<size_t>& sequenceIndices, const size_t sequenceIndex)
+    {
+        if (sequenceIndices.empty() || sequenceIndices.back() != sequenceIndex)
+            sequenceIndices.emplace_back(sequenceIndex);
+    }
+
+public:
+    /**
+     * \brief Sorts sequences by the tokens their leading matcher can start with.
+     * Candidates for a token always keep the order of the sequences.
+     * \param sequences The sequences to dispatch to. Must outlive the dispatch table and must not change.
+     */
+    explicit SequenceDispatchTable(const std::vector<sequence_t*>& sequences)
+        : m_sequences(&sequences)
+    {
+        std::vector<size_t> undispatchedSequences;
+        std::vector<TokenDispatchKey> keys;
+        for (auto sequenceIndex = 0u; sequenceIndex < sequences.size(); sequenceIndex++)
+        {
+            keys.clear();
+            if (!sequences[sequenceIndex]->GetFirstTokenDispatchKeys(keys))
+            {
+                undispatchedSequences.emplace_back(sequenceIndex);
+                continue;
+            }
+
+            for (const auto& key : keys)
+            {
+                auto& typeEntry = m_types[key.m_type_key];
+                if (key.m_has_value_key)
+                    AddSequenceIndex(typeEntry.m_value_sequences[key.m_value_key], sequenceIndex);
+                else
+                    AddSequenceIndex(typeEntry.m_type_sequences, sequenceIndex);
+            }
+        }
+
+        // Precompute the candidates of every key so dispatching does not need to merge anything
+        for (auto& typeEntry : m_types | std::views::values)
+        {
+            typeEntry.m_type_candidates = ToCandidates(typeEntry.m_type_sequences, undispatchedSequences);
+
+            for (auto& [valueKey, valueSequences] : typeEntry.m_value_sequences)
+            {
+                std::vector<size_t> dispatchedSequences;
+                std::ranges::set_union(valueSequences, typeEntry.m_type_sequences, std::back_inserter(dispatchedSequences));
+                typeEntry.m_value_candidates.emplace(valueKey, ToCandidates(dispatchedSequences, undispatchedSequences));
+            }
+        }
+
+        m_undispatched_candidates = ToCandidates({}, undispatchedSequences);
+    }
+
+    /**
+     * \brief Gets all sequences that may match starting with the specified token in the order of the sequences.
+     * \param token The first token of the match.
+     * \return All sequences that may match.
+     */
+    _NODISCARD const std::vector<sequence_t*>& GetCandidates(const TokenType& token) const
+    {
+        TokenDispatchKey key;
+        if (!token.GetDispatchKey(key))
+            return *m_sequences;
+
+        const auto foundType = m_types.find(key.m_type_key);
+        if (foundType == m_types.end())
+            return m_undispatched_candidates;
+
+        const auto& typeEntry = foundType->second;
+        if (key.m_has_value_key)
+        {
+            const auto foundValue = typeEntry.m_value_candidates.find(key.m_value_key);
+            if (foundValue != typeEntry.m_value_candidates.end())
+                return foundValue->second;
+        }
+
+        return typeEntry.m_type_candidates;
+    }
+};
@@ -12,3 +12,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherAnyCharacterBesides::CanMatch(ILex
                ? MatcherResult<SimpleParserValue>::Match(1)
                : MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherAnyCharacterBesides::GetFirstTokenDispatchKeys(std::vector<TokenDispatchKey>& keys) const
+{
+    keys.emplace_back(SimpleParserValue::TypeDispatchKey(SimpleParserValueType::CHARACTER));
+    return true;
+}
@@ -14,4 +14,6 @@ protected:
 
 public:
     explicit SimpleMatcherAnyCharacterBesides(std::vector<char> chars);
+
+    _NODISCARD bool GetFirstTokenDispatchKeys(std::vector<TokenDispatchKey>& keys) const override;
 };
@@ -11,3 +11,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherCharacter::CanMatch(ILexer<SimpleP
     return token.m_type == SimpleParserValueType::CHARACTER && token.CharacterValue() == m_char ? MatcherResult<SimpleParserValue>::Match(1)
                                                                                                 : MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherCharacter::GetFirstTokenDispatchKeys(std::vector<TokenDispatchKey>& keys) const
+{
+    keys.emplace_back(SimpleParserValue::CharacterDispatchKey(m_char));
+    return true;
+}
@@ -12,4 +12,6 @@ protected:
 
 public:
     explicit SimpleMatcherCharacter(char c);
+
+    _NODISCARD bool GetFirstTokenDispatchKeys(std::vector<TokenDispatchKey>& keys) const override;
 };
@@ -14,3 +14,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherKeyword::CanMatch(ILexer<SimplePar
                ? MatcherResult<SimpleParserValue>::Match(1)
                : MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherKeyword::GetFirstTokenDispatchKeys(std::vector<TokenDispatchKey>& keys) const
+{
+    keys.emplace_back(SimpleParserValue::IdentifierDispatchKey(m_value));
+    return true;
+}
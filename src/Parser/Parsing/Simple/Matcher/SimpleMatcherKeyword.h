@@ -15,4 +15,6 @@ protected:
 
 public:
     explicit SimpleMatcherKeyword(std::string value);
+
+    _NODISCARD bool GetFirstTokenDispatchKeys(std::vector<TokenDispatchKey>& keys) const override;
 };
@@ -29,3 +29,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherKeywordIgnoreCase::CanMatch(ILexer
 
     return MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherKeywordIgnoreCase::GetFirstTokenDispatchKeys(std::vector<TokenDispatchKey>& keys) const
+{
+    keys.emplace_back(SimpleParserValue::IdentifierDispatchKey(m_value));
+    return true;
+}
@@ -12,3 +12,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherKeywordPrefix::CanMatch(ILexer<Sim
                ? MatcherResult<SimpleParserValue>::Match(1)
                : MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherKeywordPrefix::GetFirstTokenDispatchKeys(std::vector<TokenDispatchKey>& keys) const
+{
+    keys.emplace_back(SimpleParserValue::TypeDispatchKey(SimpleParserValueType::IDENTIFIER));
+    return true;
+}
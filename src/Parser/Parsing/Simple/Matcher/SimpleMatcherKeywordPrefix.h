@@ -14,4 +14,6 @@ protected:
 
 public:
     explicit SimpleMatcherKeywordPrefix(std::string value);
+
+    _NODISCARD bool GetFirstTokenDispatchKeys(std::vector<TokenDispatchKey>& keys) const override;
 };
@@ -12,3 +12,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherMultiCharacter::CanMatch(ILexer<Si
                ? MatcherResult<SimpleParserValue>::Match(1)
                : MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherMultiCharacter::GetFirstTokenDispatchKeys(std::vector<TokenDispatchKey>& keys) const
+{
+    keys.emplace_back(SimpleParserValue::MultiCharacterDispatchKey(m_multi_character_sequence_id));
+    return true;
+}
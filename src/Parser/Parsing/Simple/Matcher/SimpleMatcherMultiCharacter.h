@@ -12,4 +12,6 @@ protected:
 
 public:
     explicit SimpleMatcherMultiCharacter(int multiCharacterSequenceId);
+
+    _NODISCARD bool GetFirstTokenDispatchKeys(std::vector<TokenDispatchKey>& keys) const override;
 };
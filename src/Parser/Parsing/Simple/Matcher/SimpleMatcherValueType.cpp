@@ -9,3 +9,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherValueType::CanMatch(ILexer<SimpleP
 {
     return lexer->GetToken(tokenOffset).m_type == m_type ? MatcherResult<SimpleParserValue>::Match(1) : MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherValueType::GetFirstTokenDispatchKeys(std::vector<TokenDispatchKey>& keys) const
+{
+    keys.emplace_back(SimpleParserValue::TypeDispatchKey(m_type));
+    return true;
+}
@@ -12,4 +12,6 @@ protected:
 
 public:
     explicit SimpleMatcherValueType(SimpleParserValueType type);
+
+    _NODISCARD bool GetFirstTokenDispatchKeys(std::vector<TokenDispatchKey>& keys) const override;
 };
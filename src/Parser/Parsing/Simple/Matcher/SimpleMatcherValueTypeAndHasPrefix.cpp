@@ -12,3 +12,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherValueTypeAndHasSignPrefix::CanMatc
     return token.m_type == m_type && token.m_has_sign_prefix == m_has_sign_prefix ? MatcherResult<SimpleParserValue>::Match(1)
                                                                                   : MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherValueTypeAndHasSignPrefix::GetFirstTokenDispatchKeys(std::vector<TokenDispatchKey>& keys) const
+{
+    keys.emplace_back(SimpleParserValue::TypeDispatchKey(m_type));
+    return true;
+}
@@ -1,6 +1,7 @@
 #include "SimpleParserValue.h"
 
 #include <cassert>
+#include <cctype>
 
 SimpleParserValue SimpleParserValue::Invalid(const TokenPos pos)
 {
@@ -177,3 +178,55 @@ size_t SimpleParserValue::IdentifierHash() const
     assert(m_type == SimpleParserValueType::IDENTIFIER);
     return m_hash;
 }
+
+bool SimpleParserValue::GetDispatchKey(TokenDispatchKey& key) const
+{
+    switch (m_type)
+    {
+    case SimpleParserValueType::CHARACTER:
+        key = CharacterDispatchKey(m_value.char_value);
+        break;
+
+    case SimpleParserValueType::MULTI_CHARACTER:
+        key = MultiCharacterDispatchKey(m_value.multi_character_sequence_id);
+        break;
+
+    case SimpleParserValueType::IDENTIFIER:
+        key = IdentifierDispatchKey(*m_value.string_value);
+        break;
+
+    default:
+        key = TypeDispatchKey(m_type);
+        break;
+    }
+
+    return true;
+}
+
+TokenDispatchKey SimpleParserValue::TypeDispatchKey(const SimpleParserValueType type)
+{
+    return TokenDispatchKey(static_cast<size_t>(type));
+}
+
+TokenDispatchKey SimpleParserValue::CharacterDispatchKey(const char c)
+{
+    return TokenDispatchKey(static_cast<size_t>(SimpleParserValueType::CHARACTER), static_cast<unsigned char>(c));
+}
+
+TokenDispatchKey SimpleParserValue::MultiCharacterDispatchKey(const int multiCharacterSequenceId)
+{
+    return TokenDispatchKey(static_cast<size_t>(SimpleParserValueType::MULTI_CHARACTER), static_cast<size_t>(multiCharacterSequenceId));
+}
+
+TokenDispatchKey SimpleParserValue::IdentifierDispatchKey(const std::string& identifier)
+{
+    // FNV-1a over the lower case characters to not need to allocate a lower case copy
+    auto hash = 2166136261u;
+    for (const auto c : identifier)
+    {
+        hash ^= static_cast<unsigned char>(tolower(static_cast<unsigned char>(c)));
+        hash *= 16777619u;
+    }
+
+    return TokenDispatchKey(static_cast<size_t>(SimpleParserValueType::IDENTIFIER), hash);
+}
@@ -76,4 +76,15 @@ public:
     _NODISCARD std::string& StringValue() const;
     _NODISCARD std::string& IdentifierValue() const;
     _NODISCARD size_t IdentifierHash() const;
+
+    _NODISCARD bool GetDispatchKey(TokenDispatchKey& key) const override;
+
+    /**
+     * \brief Dispatch keys of tokens only depend on the type of the token unless it is a character, a multi character sequence or an identifier.
+     * Identifiers are dispatched on case-insensitively so matchers that ignore case can use the same keys.
+     */
+    _NODISCARD static TokenDispatchKey TypeDispatchKey(SimpleParserValueType type);
+    _NODISCARD static TokenDispatchKey CharacterDispatchKey(char c);
+    _NODISCARD static TokenDispatchKey MultiCharacterDispatchKey(int multiCharacterSequenceId);
+    _NODISCARD static TokenDispatchKey IdentifierDispatchKey(const std::string& identifier);
 };
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * \brief Identifies the tokens a sequence can start with so parsers can skip sequences that cannot match the next token.
+ * The type key is shared by all tokens of the same type. The value key additionally depends on the value of a token, if its type has values worth
+ * dispatching on. Keys may collide since sequences are still matched after dispatching.
+ */
+class TokenDispatchKey
+{
+public:
+    size_t m_type_key;
+    bool m_has_value_key;
+    size_t m_value_key;
+
+    TokenDispatchKey()
+        : m_type_key(0u),
+          m_has_value_key(false),
+          m_value_key(0u)
+    {
+    }
+
+    explicit TokenDispatchKey(const size_t typeKey)
+        : m_type_key(typeKey),
+          m_has_value_key(false),
+          m_value_key(0u)
+    {
+    }
+
+    TokenDispatchKey(const size_t typeKey, const size_t valueKey)
+        : m_type_key(typeKey),
+          m_has_value_key(true),
+          m_value_key(valueKey)
+    {
+    }
+};
@@ -16,10 +16,14 @@
 #include "Utils/Arguments/ArgumentParser.h"
 #include "Utils/ClassUtils.h"
 #include "Utils/ObjFileStream.h"
+#include "Utils/TaskGroup.h"
+#include "Utils/ThreadPool.h"
 #include "ZoneLoading.h"
 
+#include <atomic>
 #include <filesystem>
 #include <fstream>
+#include <mutex>
 #include <regex>
 #include <set>
 
@@ -42,6 +46,12 @@ class Unlinker::Impl
 
     std::vector<std::unique_ptr<Zone>> m_loaded_zones;
 
+    // Search paths and obj containers are shared between all zones that are unlinked concurrently
+    std::mutex m_obj_mutex;
+
+    // Shared by all zones for dumping their assets concurrently, nullptr when dumping sequentially
+    std::unique_ptr<ThreadPool> m_dump_thread_pool;
+
     _NODISCARD bool ShouldLoadObj() const
     {
         return m_args.m_task != UnlinkerArgs::ProcessingTask::LIST && !m_args.m_skip_obj;
@@ -209,11 +219,11 @@ class Unlinker::Impl
         return true;
     }
 
-    void UpdateAssetIncludesAndExcludes(const AssetDumpingContext& context) const
+    void UpdateAssetIncludesAndExcludes(AssetDumpingContext& context) const
     {
         const auto assetTypeCount = context.m_zone->m_pools->GetAssetTypeCount();
 
-        ObjWriting::Configuration.AssetTypesToHandleBitfield = std::vector<bool>(assetTypeCount);
+        context.m_asset_types_to_handle = std::vector<bool>(assetTypeCount);
 
         std::vector<bool> handledSpecifiedAssets(m_args.m_specified_asset_types.size());
         for (auto i = 0; i < assetTypeCount; i++)
@@ -223,12 +233,12 @@ class Unlinker::Impl
             const auto foundSpecifiedEntry = m_args.m_specified_asset_type_map.find(assetTypeName);
             if (foundSpecifiedEntry != m_args.m_specified_asset_type_map.end())
             {
-                ObjWriting::Configuration.AssetTypesToHandleBitfield[i] = m_args.m_asset_type_handling == UnlinkerArgs::AssetTypeHandling::INCLUDE;
+                context.m_asset_types_to_handle[i] = m_args.m_asset_type_handling == UnlinkerArgs::AssetTypeHandling::INCLUDE;
                 assert(foundSpecifiedEntry->second < handledSpecifiedAssets.size());
                 handledSpecifiedAssets[foundSpecifiedEntry->second] = true;
             }
             else
-                ObjWriting::Configuration.AssetTypesToHandleBitfield[i] = m_args.m_asset_type_handling == UnlinkerArgs::AssetTypeHandling::EXCLUDE;
+                context.m_asset_types_to_handle[i] = m_args.m_asset_type_handling == UnlinkerArgs::AssetTypeHandling::EXCLUDE;
         }
 
         auto anySpecifiedValueInvalid = false;
@@ -288,6 +298,10 @@ class Unlinker::Impl
             AssetDumpingContext context;
             context.m_zone = zone;
             context.m_base_path = outputFolderPath;
+            context.m_thread_pool = m_dump_thread_pool.get();
+
+            for (const auto& loadedZone : m_loaded_zones)
+                context.m_dependency_zones.emplace_back(loadedZone.get());
 
             if (m_args.m_use_gdt)
             {
@@ -371,51 +385,96 @@ class Unlinker::Impl
         m_loaded_zones.clear();
     }
 
-    bool UnlinkZones()
+    /**
+     * \brief Loads, handles and unloads a single zone to unlink.
+     * Loading and dumping the zone can happen concurrently to other zones. Only loading and unloading obj data is serialized.
+     * \param zonePath The path to the zone to unlink.
+     * \return \c true if unlinking the zone was successful or the zone does not exist, otherwise \c false.
+     */
+    bool UnlinkZone(const std::string& zonePath)
     {
-        for (const auto& zonePath : m_args.m_zones_to_unlink)
+        if (!fs::is_regular_file(zonePath))
         {
-            if (!fs::is_regular_file(zonePath))
-            {
-                printf("Could not find file \"%s\".\n", zonePath.c_str());
-                continue;
-            }
+            printf("Could not find file \"%s\".\n", zonePath.c_str());
+            return true;
+        }
+
+        std::string zoneName;
+        auto zone = ZoneLoading::LoadZone(zonePath);
+        if (zone == nullptr)
+        {
+            printf("Failed to load zone \"%s\".\n", zonePath.c_str());
+            return false;
+        }
+
+        zoneName = zone->m_name;
+        if (m_args.m_verbose)
+            std::cout << "Loaded zone \"" << zoneName << "\"\n";
+
+        {
+            std::lock_guard lock(m_obj_mutex);
 
             auto absoluteZoneDirectory = absolute(std::filesystem::path(zonePath).remove_filename()).string();
 
             auto searchPathsForZone = GetSearchPathsForZone(absoluteZoneDirectory);
             searchPathsForZone.IncludeSearchPath(&m_search_paths);
 
-            std::string zoneName;
-            auto zone = ZoneLoading::LoadZone(zonePath);
-            if (zone == nullptr)
+            if (ShouldLoadObj())
             {
-                printf("Failed to load zone \"%s\".\n", zonePath.c_str());
-                return false;
+                ObjLoading::LoadReferencedContainersForZone(&searchPathsForZone, zone.get());
+                ObjLoading::LoadObjDataForZone(&searchPathsForZone, zone.get());
             }
+        }
 
-            zoneName = zone->m_name;
-            if (m_args.m_verbose)
-                std::cout << "Loaded zone \"" << zoneName << "\"\n";
+        const auto result = HandleZone(zone.get());
 
-            if (ShouldLoadObj())
+        if (ShouldLoadObj())
+        {
+            std::lock_guard lock(m_obj_mutex);
+            ObjLoading::UnloadContainersOfZone(zone.get());
+        }
+
+        zone.reset();
+        if (m_args.m_verbose)
+            std::cout << "Unloaded zone \"" << zoneName << "\"\n";
+
+        return result;
+    }
+
+    bool UnlinkZones()
+    {
+        // Listing prints to the console which would interleave when done concurrently.
+        // Zones that share an output folder would write files of assets with the same name at the same time.
+        if (m_args.m_job_count <= 1 || m_args.m_task == UnlinkerArgs::ProcessingTask::LIST || !m_args.OutputFolderDependsOnZone())
+        {
+            for (const auto& zonePath : m_args.m_zones_to_unlink)
             {
-                ObjLoading::LoadReferencedContainersForZone(&searchPathsForZone, zone.get());
-                ObjLoading::LoadObjDataForZone(&searchPathsForZone, zone.get());
+                if (!UnlinkZone(zonePath))
+                    return false;
             }
 
-            if (!HandleZone(zone.get()))
-                return false;
+            return true;
+        }
 
-            if (ShouldLoadObj())
-                ObjLoading::UnloadContainersOfZone(zone.get());
+        std::atomic_bool failed = false;
+        {
+            ThreadPool threadPool(m_args.m_job_count);
+            TaskGroup zones(&threadPool);
+            for (const auto& zonePath : m_args.m_zones_to_unlink)
+            {
+                zones.Run(
+                    [this, &zonePath, &failed]
+                    {
+                        if (!failed && !UnlinkZone(zonePath))
+                            failed = true;
+                    });
+            }
 
-            zone.reset();
-            if (m_args.m_verbose)
-                std::cout << "Unloaded zone \"" << zoneName << "\"\n";
+            // Errors that are not caught while unlinking a zone are thrown on the calling thread like when unlinking sequentially
+            zones.Wait();
         }
 
-        return true;
+        return !failed;
     }
 
 public:
@@ -442,7 +501,11 @@ public:
         if (!LoadZones())
             return false;
 
+        if (m_args.m_dump_thread_count > 1)
+            m_dump_thread_pool = std::make_unique<ThreadPool>(m_args.m_dump_thread_count);
+
         const auto result = UnlinkZones();
+        m_dump_thread_pool.reset();
 
         UnloadZones();
         return result;
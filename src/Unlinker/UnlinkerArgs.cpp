@@ -7,6 +7,7 @@
 #include "Utils/FileUtils.h"
 #include "Utils/StringUtils.h"
 
+#include <cstdlib>
 #include <iostream>
 #include <regex>
 #include <type_traits>
@@ -118,6 +119,21 @@ const CommandLineOption* const OPTION_LEGACY_MENUS =
     .WithDescription("Dumps menus with a compatibility mode to work with applications not compatible with the newer dumping mode.")
     .Build();
 
+const CommandLineOption* const OPTION_JOBS =
+    CommandLineOption::Builder::Create()
+    .WithShortName("j")
+    .WithLongName("jobs")
+    .WithDescription("Specifies the amount of zones that are unlinked concurrently. Defaults to 1.")
+    .WithParameter("jobCount")
+    .Build();
+
+const CommandLineOption* const OPTION_DUMP_THREADS =
+    CommandLineOption::Builder::Create()
+    .WithLongName("dump-threads")
+    .WithDescription("Specifies the amount of threads that are used for dumping the assets of a zone. Defaults to 1.")
+    .WithParameter("threadCount")
+    .Build();
+
 // clang-format on
 
 const CommandLineOption* const COMMAND_LINE_OPTIONS[]{
@@ -136,6 +152,8 @@ const CommandLineOption* const COMMAND_LINE_OPTIONS[]{
     OPTION_EXCLUDE_ASSETS,
     OPTION_INCLUDE_ASSETS,
     OPTION_LEGACY_MENUS,
+    OPTION_JOBS,
+    OPTION_DUMP_THREADS,
 };
 
 UnlinkerArgs::UnlinkerArgs()
@@ -146,7 +164,9 @@ UnlinkerArgs::UnlinkerArgs()
       m_asset_type_handling(AssetTypeHandling::EXCLUDE),
       m_skip_obj(false),
       m_use_gdt(false),
-      m_verbose(false)
+      m_verbose(false),
+      m_job_count(1u),
+      m_dump_thread_count(1u)
 {
 }
 
@@ -233,6 +253,24 @@ bool UnlinkerArgs::SetModelDumpingMode()
     return false;
 }
 
+bool UnlinkerArgs::SetCount(const CommandLineOption* option, unsigned& count)
+{
+    const auto specifiedValue = m_argument_parser.GetValueForOption(option);
+
+    char* endPtr;
+    const auto parsedCount = std::strtoul(specifiedValue.c_str(), &endPtr, 10);
+    if (specifiedValue.empty() || *endPtr != '\0' || parsedCount < 1)
+    {
+        printf("Illegal value: \"%s\" is not a valid count for option \"%s\". Use -? to see usage information.\n",
+               specifiedValue.c_str(),
+               option->m_long_name.c_str());
+        return false;
+    }
+
+    count = static_cast<unsigned>(parsedCount);
+    return true;
+}
+
 void UnlinkerArgs::AddSpecifiedAssetType(std::string value)
 {
     const auto alreadySpecifiedAssetType = m_specified_asset_type_map.find(value);
@@ -373,6 +411,24 @@ bool UnlinkerArgs::ParseArgs(const int argc, const char** argv, bool& shouldCont
     if (m_argument_parser.IsOptionSpecified(OPTION_LEGACY_MENUS))
         ObjWriting::Configuration.MenuLegacyMode = true;
 
+    // -j; --jobs
+    if (m_argument_parser.IsOptionSpecified(OPTION_JOBS))
+    {
+        if (!SetCount(OPTION_JOBS, m_job_count))
+        {
+            return false;
+        }
+    }
+
+    // --dump-threads
+    if (m_argument_parser.IsOptionSpecified(OPTION_DUMP_THREADS))
+    {
+        if (!SetCount(OPTION_DUMP_THREADS, m_dump_thread_count))
+        {
+            return false;
+        }
+    }
+
     return true;
 }
 
@@ -380,3 +436,8 @@ std::string UnlinkerArgs::GetOutputFolderPathForZone(const Zone* zone) const
 {
     return std::regex_replace(m_output_folder, m_zone_pattern, zone->m_name);
 }
+
+bool UnlinkerArgs::OutputFolderDependsOnZone() const
+{
+    return std::regex_search(m_output_folder, m_zone_pattern);
+}
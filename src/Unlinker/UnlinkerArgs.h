@@ -26,6 +26,7 @@ private:
     void SetVerbose(bool isVerbose);
     bool SetImageDumpingMode();
     bool SetModelDumpingMode();
+    bool SetCount(const CommandLineOption* option, unsigned& count);
 
     void AddSpecifiedAssetType(std::string value);
     void ParseCommaSeparatedAssetTypeString(const std::string& input);
@@ -60,6 +61,16 @@ public:
 
     bool m_verbose;
 
+    /**
+     * \brief The amount of zones to unlink concurrently.
+     */
+    unsigned m_job_count;
+
+    /**
+     * \brief The amount of threads used for dumping the assets of a single zone.
+     */
+    unsigned m_dump_thread_count;
+
     UnlinkerArgs();
     bool ParseArgs(int argc, const char** argv, bool& shouldContinue);
 
@@ -69,4 +80,10 @@ public:
      * \return An output path for the zone based on the user input.
      */
     std::string GetOutputFolderPathForZone(const Zone* zone) const;
+
+    /**
+     * \brief Checks whether every zone is written to its own output folder.
+     * \return \c true if the output path contains the zone placeholder.
+     */
+    _NODISCARD bool OutputFolderDependsOnZone() const;
 };
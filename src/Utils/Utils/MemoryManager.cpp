@@ -1,73 +1,135 @@
 #include "MemoryManager.h"
 
+#include "Alignment.h"
+
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 
-MemoryManager::AllocationInfo::AllocationInfo(IDestructible* data, void* dataPtr)
+MemoryManager::AllocationInfo::AllocationInfo(IDestructible* data, const size_t size)
 {
     m_data = data;
-    m_data_ptr = dataPtr;
+    m_size = size;
 }
 
-MemoryManager::MemoryManager() = default;
+MemoryManager::MemoryManager()
+    : MemoryManager(0u)
+{
+}
+
+MemoryManager::MemoryManager(const size_t arenaChunkSize)
+    : m_arena_chunk_size(utils::Align(arenaChunkSize, ARENA_ALIGNMENT)),
+      m_arena_pos(nullptr),
+      m_arena_remaining(0u)
+{
+}
 
 MemoryManager::~MemoryManager()
 {
-    for (auto allocation : m_allocations)
+    for (const auto& [allocation, size] : m_allocations)
     {
         free(allocation);
     }
     m_allocations.clear();
 
-    for (auto destructible : m_destructible)
+    for (auto* chunk : m_arena_chunks)
+    {
+        free(chunk);
+    }
+    m_arena_chunks.clear();
+
+    for (const auto& destructible : m_destructible)
     {
         delete destructible.m_data;
     }
     m_destructible.clear();
+    m_destructible_lookup.clear();
 }
 
-void* MemoryManager::AllocRaw(const size_t size)
+void* MemoryManager::AllocFromArena(const size_t size)
+{
+    const auto alignedSize = utils::Align(std::max(size, static_cast<size_t>(1u)), ARENA_ALIGNMENT);
+
+    if (alignedSize > m_arena_remaining)
+    {
+        // Arena chunks are zero initialized and never reused, so allocations from them are always zeroed
+        m_arena_pos = static_cast<char*>(calloc(m_arena_chunk_size, 1u));
+        m_arena_remaining = m_arena_chunk_size;
+        m_arena_chunks.push_back(m_arena_pos);
+        m_statistics.m_bytes_reserved += m_arena_chunk_size;
+    }
+
+    void* result = m_arena_pos;
+    m_arena_pos += alignedSize;
+    m_arena_remaining -= alignedSize;
+
+    return result;
+}
+
+void* MemoryManager::AllocIndividually(const size_t size)
 {
     void* result = calloc(size, 1u);
-    m_allocations.push_back(result);
+    m_allocations.emplace(result, size);
+    m_statistics.m_bytes_reserved += size;
 
     return result;
 }
 
+void* MemoryManager::AllocRaw(const size_t size)
+{
+    m_statistics.m_allocation_count++;
+    m_statistics.m_bytes_requested += size;
+
+    // Allocations that would waste a large part of a chunk are not served from the arena
+    if (m_arena_chunk_size > 0 && size <= m_arena_chunk_size / 4u)
+        return AllocFromArena(size);
+
+    return AllocIndividually(size);
+}
+
 char* MemoryManager::Dup(const char* str)
 {
-#ifdef _MSC_VER
-    auto* result = _strdup(str);
-#else
-    auto* result = strdup(str);
-#endif
-    m_allocations.push_back(result);
+    const auto size = strlen(str) + 1u;
+    auto* result = static_cast<char*>(AllocRaw(size));
+    memcpy(result, str, size);
+
+    return result;
+}
+
+char* MemoryManager::Dup(const std::string_view str)
+{
+    auto* result = static_cast<char*>(AllocRaw(str.size() + 1u));
+    memcpy(result, str.data(), str.size());
+    result[str.size()] = '\0';
 
     return result;
 }
 
 void MemoryManager::Free(const void* data)
 {
-    for (auto iAlloc = m_allocations.begin(); iAlloc != m_allocations.end(); ++iAlloc)
-    {
-        if (*iAlloc == data)
-        {
-            free(*iAlloc);
-            m_allocations.erase(iAlloc);
-            return;
-        }
-    }
+    const auto foundAllocation = m_allocations.find(const_cast<void*>(data));
+    if (foundAllocation == m_allocations.end())
+        return;
+
+    free(foundAllocation->first);
+    m_statistics.m_bytes_reserved -= foundAllocation->second;
+    m_allocations.erase(foundAllocation);
 }
 
 void MemoryManager::Delete(const void* data)
 {
-    for (auto iAlloc = m_destructible.begin(); iAlloc != m_destructible.end(); ++iAlloc)
-    {
-        if (iAlloc->m_data_ptr == data)
-        {
-            delete iAlloc->m_data;
-            m_destructible.erase(iAlloc);
-            return;
-        }
-    }
+    const auto foundDestructible = m_destructible_lookup.find(data);
+    if (foundDestructible == m_destructible_lookup.end())
+        return;
+
+    const auto destructible = foundDestructible->second;
+    delete destructible->m_data;
+    m_statistics.m_bytes_reserved -= destructible->m_size;
+    m_destructible.erase(destructible);
+    m_destructible_lookup.erase(foundDestructible);
+}
+
+const MemoryStatistics& MemoryManager::GetStatistics() const
+{
+    return m_statistics;
 }
@@ -1,9 +1,28 @@
 #pragma once
 
+#include "ClassUtils.h"
+
 #include <cstddef>
+#include <iterator>
+#include <list>
+#include <string_view>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
+class MemoryStatistics
+{
+public:
+    // The amount of allocations that were made over the lifetime of the memory manager
+    size_t m_allocation_count = 0u;
+
+    // The amount of bytes that were requested over the lifetime of the memory manager
+    size_t m_bytes_requested = 0u;
+
+    // The amount of bytes that are currently reserved from the system, including unused space of arena chunks
+    size_t m_bytes_reserved = 0u;
+};
+
 class MemoryManager
 {
     class IDestructible
@@ -40,16 +59,39 @@ class MemoryManager
     {
     public:
         IDestructible* m_data;
-        void* m_data_ptr;
+        size_t m_size;
 
-        AllocationInfo(IDestructible* data, void* dataPtr);
+        AllocationInfo(IDestructible* data, size_t size);
     };
 
-    std::vector<void*> m_allocations;
-    std::vector<AllocationInfo> m_destructible;
+    std::unordered_map<void*, size_t> m_allocations;
+
+    // Destructible allocations are destroyed in the order they were created in
+    std::list<AllocationInfo> m_destructible;
+    std::unordered_map<const void*, std::list<AllocationInfo>::iterator> m_destructible_lookup;
+
+    size_t m_arena_chunk_size;
+    std::vector<void*> m_arena_chunks;
+    char* m_arena_pos;
+    size_t m_arena_remaining;
+
+    MemoryStatistics m_statistics;
+
+    void* AllocFromArena(size_t size);
+    void* AllocIndividually(size_t size);
 
 public:
+    static constexpr size_t ARENA_ALIGNMENT = alignof(std::max_align_t);
+
     MemoryManager();
+
+    /**
+     * \brief Creates a memory manager that serves small allocations from chunks of the specified size.
+     * Memory of these allocations is only released when the memory manager is destroyed.
+     * \param arenaChunkSize The size of each arena chunk.
+     */
+    explicit MemoryManager(size_t arenaChunkSize);
+
     virtual ~MemoryManager();
     MemoryManager(const MemoryManager& other) = delete;
     MemoryManager(MemoryManager&& other) noexcept = default;
@@ -58,6 +100,7 @@ public:
 
     void* AllocRaw(size_t size);
     char* Dup(const char* str);
+    char* Dup(std::string_view str);
 
     template<typename T> std::add_pointer_t<T> Alloc(const size_t count = 1u)
     {
@@ -67,10 +110,19 @@ public:
     template<class T, class... ValType> std::add_pointer_t<T> Create(ValType&&... val)
     {
         Allocation<T>* allocation = new Allocation<T>(std::forward<ValType>(val)...);
-        m_destructible.emplace_back(allocation, &allocation->m_entry);
+        m_destructible.emplace_back(allocation, sizeof(Allocation<T>));
+        m_destructible_lookup.emplace(&allocation->m_entry, std::prev(m_destructible.end()));
+        m_statistics.m_allocation_count++;
+        m_statistics.m_bytes_requested += sizeof(T);
+        m_statistics.m_bytes_reserved += sizeof(Allocation<T>);
         return &allocation->m_entry;
     }
 
+    /**
+     * \brief Releases a single allocation. Allocations that were served from an arena chunk are only released when the memory manager is destroyed.
+     */
     void Free(const void* data);
     void Delete(const void* data);
+
+    _NODISCARD const MemoryStatistics& GetStatistics() const;
 };
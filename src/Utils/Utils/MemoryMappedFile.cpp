@@ -0,0 +1,144 @@
+#include "MemoryMappedFile.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    Close();
+}
+
+#if defined(_WIN32) || defined(_WIN64)
+
+MemoryMappedFile::MemoryMappedFile()
+    : m_data(nullptr),
+      m_size(0),
+      m_file_handle(INVALID_HANDLE_VALUE),
+      m_mapping_handle(nullptr)
+{
+}
+
+bool MemoryMappedFile::Open(const std::string& path)
+{
+    Close();
+
+    m_file_handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (m_file_handle == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(m_file_handle, &fileSize) || fileSize.QuadPart <= 0 || static_cast<uint64_t>(fileSize.QuadPart) > SIZE_MAX)
+    {
+        Close();
+        return false;
+    }
+
+    m_mapping_handle = CreateFileMappingA(m_file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (m_mapping_handle == nullptr)
+    {
+        Close();
+        return false;
+    }
+
+    m_data = static_cast<const uint8_t*>(MapViewOfFile(m_mapping_handle, FILE_MAP_READ, 0, 0, 0));
+    if (m_data == nullptr)
+    {
+        Close();
+        return false;
+    }
+
+    m_size = static_cast<size_t>(fileSize.QuadPart);
+    return true;
+}
+
+void MemoryMappedFile::Close()
+{
+    if (m_data != nullptr)
+        UnmapViewOfFile(m_data);
+
+    if (m_mapping_handle != nullptr)
+        CloseHandle(m_mapping_handle);
+
+    if (m_file_handle != INVALID_HANDLE_VALUE)
+        CloseHandle(m_file_handle);
+
+    m_data = nullptr;
+    m_size = 0;
+    m_mapping_handle = nullptr;
+    m_file_handle = INVALID_HANDLE_VALUE;
+}
+
+#else
+
+MemoryMappedFile::MemoryMappedFile()
+    : m_data(nullptr),
+      m_size(0)
+{
+}
+
+bool MemoryMappedFile::Open(const std::string& path)
+{
+    Close();
+
+    const auto fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat fileStat
+    {
+    };
+
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    const auto fileSize = static_cast<size_t>(fileStat.st_size);
+    auto* data = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // The mapping stays valid after the descriptor is closed
+    close(fd);
+
+    if (data == MAP_FAILED)
+        return false;
+
+    madvise(data, fileSize, MADV_SEQUENTIAL);
+
+    m_data = static_cast<const uint8_t*>(data);
+    m_size = fileSize;
+    return true;
+}
+
+void MemoryMappedFile::Close()
+{
+    if (m_data != nullptr)
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+
+    m_data = nullptr;
+    m_size = 0;
+}
+
+#endif
+
+bool MemoryMappedFile::IsOpen() const
+{
+    return m_data != nullptr;
+}
+
+const uint8_t* MemoryMappedFile::Data() const
+{
+    return m_data;
+}
+
+size_t MemoryMappedFile::Size() const
+{
+    return m_size;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "ClassUtils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * \brief A read-only mapping of a whole file into memory.
+ * Reading from the mapping does not copy the data into a separate buffer and uses the page cache of the operating system directly.
+ */
+class MemoryMappedFile
+{
+    const uint8_t* m_data;
+    size_t m_size;
+
+#if defined(_WIN32) || defined(_WIN64)
+    void* m_file_handle;
+    void* m_mapping_handle;
+#endif
+
+public:
+    MemoryMappedFile();
+    ~MemoryMappedFile();
+    MemoryMappedFile(const MemoryMappedFile& other) = delete;
+    MemoryMappedFile(MemoryMappedFile&& other) noexcept = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile& other) = delete;
+    MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept = delete;
+
+    /**
+     * \brief Maps the file at the specified path into memory.
+     * \param path The path of the file to map.
+     * \return \c true if the file could be mapped, otherwise \c false. Empty files cannot be mapped.
+     */
+    bool Open(const std::string& path);
+    void Close();
+
+    _NODISCARD bool IsOpen() const;
+    _NODISCARD const uint8_t* Data() const;
+    _NODISCARD size_t Size() const;
+};
@@ -0,0 +1,178 @@
+#pragma once
+
+#include "ThreadPool.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+/**
+ * \brief Reads a sequence of items on a thread pool ahead of the order they are consumed in.
+ * Limits both the amount of items and the expected size of their data that are read but not consumed yet.
+ */
+template<typename T> class OrderedReadAhead
+{
+public:
+    /**
+     * \brief Prepares the item with the specified index on the calling thread, e.g. by opening its file.
+     * \return The size of the data the item holds once it was read.
+     */
+    using open_func_t = std::function<size_t(size_t index, T& item)>;
+
+    /**
+     * \brief Reads the data of a prepared item on the thread pool.
+     */
+    using read_func_t = std::function<void(T& item)>;
+
+private:
+    class PendingItem
+    {
+    public:
+        std::shared_ptr<T> m_item;
+        size_t m_expected_size = 0u;
+        bool m_queued = false;
+        bool m_loaded = false;
+        std::exception_ptr m_error;
+    };
+
+    ThreadPool& m_thread_pool;
+    size_t m_item_count;
+    size_t m_max_pending_count;
+    size_t m_max_pending_data_size;
+    open_func_t m_open;
+    read_func_t m_read;
+
+    std::mutex m_mutex;
+    std::condition_variable m_item_loaded;
+    unsigned m_running_read_count;
+
+    std::deque<std::shared_ptr<PendingItem>> m_pending_items;
+    size_t m_next_item_to_open;
+
+    // Expected size of all queued items and the item that was consumed last
+    size_t m_pending_data_size;
+    size_t m_consumed_data_size;
+
+    void QueueRead(const std::shared_ptr<PendingItem>& pendingItem)
+    {
+        pendingItem->m_queued = true;
+        m_pending_data_size += pendingItem->m_expected_size;
+
+        {
+            std::lock_guard lock(m_mutex);
+            m_running_read_count++;
+        }
+
+        m_thread_pool.Enqueue(
+            [this, pendingItem]
+            {
+                std::exception_ptr error;
+                try
+                {
+                    m_read(*pendingItem->m_item);
+                }
+                catch (...)
+                {
+                    error = std::current_exception();
+                }
+
+                std::lock_guard lock(m_mutex);
+                pendingItem->m_error = error;
+                pendingItem->m_loaded = true;
+                m_running_read_count--;
+                m_item_loaded.notify_all();
+            });
+    }
+
+    void ReadAhead()
+    {
+        while (m_next_item_to_open < m_item_count && m_pending_items.size() < m_max_pending_count)
+        {
+            auto pendingItem = std::make_shared<PendingItem>();
+            pendingItem->m_item = std::make_shared<T>();
+            pendingItem->m_expected_size = m_open(m_next_item_to_open++, *pendingItem->m_item);
+            m_pending_items.emplace_back(std::move(pendingItem));
+        }
+
+        for (const auto& pendingItem : m_pending_items)
+        {
+            if (pendingItem->m_queued)
+                continue;
+
+            // A single item is always read even when it exceeds the limit by itself
+            if (m_pending_data_size > 0u && m_pending_data_size + pendingItem->m_expected_size > m_max_pending_data_size)
+                break;
+
+            QueueRead(pendingItem);
+        }
+    }
+
+public:
+    OrderedReadAhead(ThreadPool& threadPool, const size_t itemCount, const size_t maxPendingCount, const size_t maxPendingDataSize, open_func_t open, read_func_t read)
+        : m_thread_pool(threadPool),
+          m_item_count(itemCount),
+          m_max_pending_count(maxPendingCount),
+          m_max_pending_data_size(maxPendingDataSize),
+          m_open(std::move(open)),
+          m_read(std::move(read)),
+          m_running_read_count(0u),
+          m_next_item_to_open(0u),
+          m_pending_data_size(0u),
+          m_consumed_data_size(0u)
+    {
+    }
+
+    ~OrderedReadAhead()
+    {
+        // Queued reads reference the read ahead, so they need to be done before it goes away
+        std::unique_lock lock(m_mutex);
+        m_item_loaded.wait(lock,
+                           [this]
+                           {
+                               return m_running_read_count == 0u;
+                           });
+    }
+
+    OrderedReadAhead(const OrderedReadAhead& other) = delete;
+    OrderedReadAhead(OrderedReadAhead&& other) noexcept = delete;
+    OrderedReadAhead& operator=(const OrderedReadAhead& other) = delete;
+    OrderedReadAhead& operator=(OrderedReadAhead&& other) noexcept = delete;
+
+    /**
+     * \brief Takes the next item in order and waits for it to be read. The data of the previously taken item counts towards the limit until this is called.
+     * Rethrows the exception that was thrown while reading the item.
+     * \return The next item or \c nullptr if all items were taken.
+     */
+    std::shared_ptr<T> Next()
+    {
+        m_pending_data_size -= m_consumed_data_size;
+        m_consumed_data_size = 0u;
+
+        ReadAhead();
+        if (m_pending_items.empty())
+            return nullptr;
+
+        const auto pendingItem = std::move(m_pending_items.front());
+        m_pending_items.pop_front();
+        m_consumed_data_size = pendingItem->m_expected_size;
+
+        // Keep reading while the current item is consumed
+        ReadAhead();
+
+        std::unique_lock lock(m_mutex);
+        m_item_loaded.wait(lock,
+                           [&pendingItem]
+                           {
+                               return pendingItem->m_loaded;
+                           });
+
+        if (pendingItem->m_error)
+            std::rethrow_exception(pendingItem->m_error);
+
+        return pendingItem->m_item;
+    }
+};
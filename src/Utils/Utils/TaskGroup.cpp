@@ -0,0 +1,89 @@
+#include "TaskGroup.h"
+
+TaskGroup::TaskGroup(ThreadPool* threadPool)
+    : m_thread_pool(threadPool),
+      m_pending_task_count(0u)
+{
+}
+
+TaskGroup::~TaskGroup()
+{
+    // Tasks reference the group, so they need to be done before it goes away
+    WaitForPendingTasks();
+}
+
+void TaskGroup::Run(std::function<void()> task)
+{
+    if (m_thread_pool == nullptr)
+    {
+        task();
+        return;
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_pending_task_count++;
+    }
+
+    m_thread_pool->Enqueue(
+        [this, task = std::move(task)]
+        {
+            std::exception_ptr error;
+            try
+            {
+                task();
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+
+            std::lock_guard lock(m_mutex);
+            if (error && !m_error)
+                m_error = error;
+
+            m_pending_task_count--;
+            if (m_pending_task_count == 0)
+                m_done.notify_all();
+        });
+}
+
+void TaskGroup::WaitForPendingTasks()
+{
+    if (m_thread_pool == nullptr)
+        return;
+
+    while (true)
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            if (m_pending_task_count == 0)
+                return;
+        }
+
+        // Help with queued tasks instead of blocking a thread that might be a worker of the pool itself
+        if (!m_thread_pool->RunPendingTask())
+        {
+            std::unique_lock lock(m_mutex);
+            m_done.wait(lock,
+                        [this]
+                        {
+                            return m_pending_task_count == 0;
+                        });
+        }
+    }
+}
+
+void TaskGroup::Wait()
+{
+    WaitForPendingTasks();
+
+    std::exception_ptr error;
+    {
+        std::lock_guard lock(m_mutex);
+        std::swap(error, m_error);
+    }
+
+    if (error)
+        std::rethrow_exception(error);
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "ThreadPool.h"
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+
+/**
+ * \brief A set of tasks that can be waited for independently of other tasks running on the same thread pool.
+ * While waiting the calling thread executes queued tasks of the pool itself, so groups can be nested inside of tasks without exhausting the pool.
+ * Without a thread pool all tasks are executed immediately on the calling thread.
+ */
+class TaskGroup
+{
+    ThreadPool* m_thread_pool;
+    std::mutex m_mutex;
+    std::condition_variable m_done;
+    unsigned m_pending_task_count;
+    std::exception_ptr m_error;
+
+    void WaitForPendingTasks();
+
+public:
+    explicit TaskGroup(ThreadPool* threadPool);
+    ~TaskGroup();
+    TaskGroup(const TaskGroup& other) = delete;
+    TaskGroup(TaskGroup&& other) noexcept = delete;
+    TaskGroup& operator=(const TaskGroup& other) = delete;
+    TaskGroup& operator=(TaskGroup&& other) noexcept = delete;
+
+    void Run(std::function<void()> task);
+
+    /**
+     * \brief Blocks until all tasks of the group are done.
+     * Rethrows the first exception that was thrown by a task of the group.
+     */
+    void Wait();
+};
@@ -0,0 +1,115 @@
+#include "ThreadPool.h"
+
+#include <cassert>
+
+ThreadPool::ThreadPool(const unsigned threadCount)
+    : m_active_task_count(0u),
+      m_stopping(false)
+{
+    assert(threadCount > 0);
+
+    m_threads.reserve(threadCount);
+    for (auto i = 0u; i < threadCount; i++)
+        m_threads.emplace_back(&ThreadPool::Work, this);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_stopping = true;
+    }
+    m_task_available.notify_all();
+
+    for (auto& thread : m_threads)
+        thread.join();
+}
+
+void ThreadPool::Work()
+{
+    while (true)
+    {
+        std::function<void()> task;
+
+        {
+            std::unique_lock lock(m_mutex);
+            m_task_available.wait(lock,
+                                  [this]
+                                  {
+                                      return m_stopping || !m_tasks.empty();
+                                  });
+
+            if (m_tasks.empty())
+                return;
+
+            task = std::move(m_tasks.front());
+            m_tasks.pop();
+            m_active_task_count++;
+        }
+
+        task();
+
+        {
+            std::lock_guard lock(m_mutex);
+            m_active_task_count--;
+            if (m_active_task_count == 0 && m_tasks.empty())
+                m_idle.notify_all();
+        }
+    }
+}
+
+void ThreadPool::Enqueue(std::function<void()> task)
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_tasks.emplace(std::move(task));
+    }
+    m_task_available.notify_one();
+}
+
+bool ThreadPool::RunPendingTask()
+{
+    std::function<void()> task;
+
+    {
+        std::lock_guard lock(m_mutex);
+        if (m_tasks.empty())
+            return false;
+
+        task = std::move(m_tasks.front());
+        m_tasks.pop();
+        m_active_task_count++;
+    }
+
+    task();
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_active_task_count--;
+        if (m_active_task_count == 0 && m_tasks.empty())
+            m_idle.notify_all();
+    }
+
+    return true;
+}
+
+void ThreadPool::WaitForIdle()
+{
+    std::unique_lock lock(m_mutex);
+    m_idle.wait(lock,
+                [this]
+                {
+                    return m_active_task_count == 0 && m_tasks.empty();
+                });
+}
+
+unsigned ThreadPool::GetThreadCount() const
+{
+    return static_cast<unsigned>(m_threads.size());
+}
+
+unsigned ThreadPool::DefaultThreadCount()
+{
+    const auto hardwareThreads = std::thread::hardware_concurrency();
+    return hardwareThreads > 0 ? hardwareThreads : 1u;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "ClassUtils.h"
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+/**
+ * \brief A fixed set of long-lived worker threads that execute enqueued tasks in submission order.
+ * All tasks that were enqueued are executed before the pool is destroyed.
+ */
+class ThreadPool
+{
+    std::vector<std::thread> m_threads;
+    std::queue<std::function<void()>> m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_task_available;
+    std::condition_variable m_idle;
+    unsigned m_active_task_count;
+    bool m_stopping;
+
+    void Work();
+
+public:
+    explicit ThreadPool(unsigned threadCount);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool& other) = delete;
+    ThreadPool(ThreadPool&& other) noexcept = delete;
+    ThreadPool& operator=(const ThreadPool& other) = delete;
+    ThreadPool& operator=(ThreadPool&& other) noexcept = delete;
+
+    /**
+     * \brief Queues a task to be executed by a worker thread.
+     * Tasks must not throw since there is no caller to pass the exception to. Use a \c TaskGroup for tasks that may throw.
+     */
+    void Enqueue(std::function<void()> task);
+
+    /**
+     * \brief Takes the oldest queued task and executes it on the calling thread.
+     * \return \c true if a task was executed, \c false if there were no queued tasks.
+     */
+    bool RunPendingTask();
+
+    /**
+     * \brief Blocks until there are no queued or running tasks left.
+     */
+    void WaitForIdle();
+
+    _NODISCARD unsigned GetThreadCount() const;
+
+    /**
+     * \brief The amount of worker threads to use when the caller does not have a preference.
+     * \return The amount of hardware threads or \c 1 if it cannot be determined.
+     */
+    _NODISCARD static unsigned DefaultThreadCount();
+};
@@ -16,8 +16,14 @@ const char* GameAssetPoolIW3::ASSET_TYPE_NAMES[]{
 };
 
 GameAssetPoolIW3::GameAssetPoolIW3(Zone* zone, const int priority)
+    : GameAssetPoolIW3(zone, priority, true)
+{
+}
+
+GameAssetPoolIW3::GameAssetPoolIW3(Zone* zone, const int priority, const bool linkGlobally)
     : ZoneAssetPools(zone),
-      m_priority(priority)
+      m_priority(priority),
+      m_link_globally(linkGlobally)
 {
     static_assert(std::extent_v<decltype(ASSET_TYPE_NAMES)> == ASSET_TYPE_COUNT);
 }
@@ -78,7 +84,7 @@ void GameAssetPoolIW3::InitPoolDynamic(const asset_type_t type)
     {                                                                                                                                                          \
         if ((poolName) == nullptr)                                                                                                                             \
         {                                                                                                                                                      \
-            (poolName) = std::make_unique<AssetPoolDynamic<decltype(poolName)::element_type::type>>(m_priority, (assetType));                                  \
+            (poolName) = std::make_unique<AssetPoolDynamic<decltype(poolName)::element_type::type>>(m_priority, (assetType), m_link_globally);                 \
         }                                                                                                                                                      \
         break;                                                                                                                                                 \
     }
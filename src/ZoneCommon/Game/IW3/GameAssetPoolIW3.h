@@ -9,6 +9,7 @@
 class GameAssetPoolIW3 final : public ZoneAssetPools
 {
     int m_priority;
+    bool m_link_globally;
 
     static constexpr const char* ASSET_TYPE_INVALID = "invalid_asset_type";
     static const char* ASSET_TYPE_NAMES[];
@@ -47,6 +48,12 @@ public:
     std::unique_ptr<AssetPool<IW3::StringTable>> m_string_table;
 
     GameAssetPoolIW3(Zone* zone, int priority);
+
+    /**
+     * \brief Creates asset pools for a zone.
+     * \param linkGlobally Whether the assets can be found through the \c GlobalAssetPool from other zones.
+     */
+    GameAssetPoolIW3(Zone* zone, int priority, bool linkGlobally);
     ~GameAssetPoolIW3() override = default;
 
     void InitPoolStatic(asset_type_t type, size_t capacity) override;
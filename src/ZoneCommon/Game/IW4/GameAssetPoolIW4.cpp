@@ -17,8 +17,14 @@ const char* GameAssetPoolIW4::ASSET_TYPE_NAMES[]{
 };
 
 GameAssetPoolIW4::GameAssetPoolIW4(Zone* zone, const int priority)
+    : GameAssetPoolIW4(zone, priority, true)
+{
+}
+
+GameAssetPoolIW4::GameAssetPoolIW4(Zone* zone, const int priority, const bool linkGlobally)
     : ZoneAssetPools(zone),
-      m_priority(priority)
+      m_priority(priority),
+      m_link_globally(linkGlobally)
 {
     assert(std::extent_v<decltype(ASSET_TYPE_NAMES)> == ASSET_TYPE_COUNT);
 }
@@ -89,7 +95,7 @@ void GameAssetPoolIW4::InitPoolDynamic(const asset_type_t type)
     {                                                                                                                                                          \
         if ((poolName) == nullptr)                                                                                                                             \
         {                                                                                                                                                      \
-            (poolName) = std::make_unique<AssetPoolDynamic<decltype(poolName)::element_type::type>>(m_priority, (assetType));                                  \
+            (poolName) = std::make_unique<AssetPoolDynamic<decltype(poolName)::element_type::type>>(m_priority, (assetType), m_link_globally);                 \
         }                                                                                                                                                      \
         break;                                                                                                                                                 \
     }
@@ -10,6 +10,7 @@
 class GameAssetPoolIW4 final : public ZoneAssetPools
 {
     int m_priority;
+    bool m_link_globally;
 
     static constexpr const char* ASSET_TYPE_INVALID = "invalid_asset_type";
     static const char* ASSET_TYPE_NAMES[];
@@ -55,6 +56,12 @@ public:
     std::unique_ptr<AssetPool<IW4::AddonMapEnts>> m_addon_map_ents;
 
     GameAssetPoolIW4(Zone* zone, int priority);
+
+    /**
+     * \brief Creates asset pools for a zone.
+     * \param linkGlobally Whether the assets can be found through the \c GlobalAssetPool from other zones.
+     */
+    GameAssetPoolIW4(Zone* zone, int priority, bool linkGlobally);
     ~GameAssetPoolIW4() override = default;
 
     void InitPoolStatic(asset_type_t type, size_t capacity) override;
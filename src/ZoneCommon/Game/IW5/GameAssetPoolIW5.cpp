@@ -58,8 +58,14 @@ const char* GameAssetPoolIW5::ASSET_TYPE_NAMES[]{
 };
 
 GameAssetPoolIW5::GameAssetPoolIW5(Zone* zone, const int priority)
+    : GameAssetPoolIW5(zone, priority, true)
+{
+}
+
+GameAssetPoolIW5::GameAssetPoolIW5(Zone* zone, const int priority, const bool linkGlobally)
     : ZoneAssetPools(zone),
-      m_priority(priority)
+      m_priority(priority),
+      m_link_globally(linkGlobally)
 {
     assert(std::extent_v<decltype(ASSET_TYPE_NAMES)> == ASSET_TYPE_COUNT);
 }
@@ -134,7 +140,7 @@ void GameAssetPoolIW5::InitPoolDynamic(const asset_type_t type)
     {                                                                                                                                                          \
         if ((poolName) == nullptr)                                                                                                                             \
         {                                                                                                                                                      \
-            (poolName) = std::make_unique<AssetPoolDynamic<decltype(poolName)::element_type::type>>(m_priority, (assetType));                                  \
+            (poolName) = std::make_unique<AssetPoolDynamic<decltype(poolName)::element_type::type>>(m_priority, (assetType), m_link_globally);                 \
         }                                                                                                                                                      \
         break;                                                                                                                                                 \
     }
@@ -19,8 +19,14 @@ const char* GameAssetPoolT5::ASSET_TYPE_NAMES[]{
 };
 
 GameAssetPoolT5::GameAssetPoolT5(Zone* zone, const int priority)
+    : GameAssetPoolT5(zone, priority, true)
+{
+}
+
+GameAssetPoolT5::GameAssetPoolT5(Zone* zone, const int priority, const bool linkGlobally)
     : ZoneAssetPools(zone),
-      m_priority(priority)
+      m_priority(priority),
+      m_link_globally(linkGlobally)
 {
     assert(std::extent_v<decltype(ASSET_TYPE_NAMES)> == ASSET_TYPE_COUNT);
 }
@@ -88,7 +94,7 @@ void GameAssetPoolT5::InitPoolDynamic(const asset_type_t type)
     {                                                                                                                                                          \
         if ((poolName) == nullptr)                                                                                                                             \
         {                                                                                                                                                      \
-            (poolName) = std::make_unique<AssetPoolDynamic<decltype(poolName)::element_type::type>>(m_priority, (assetType));                                  \
+            (poolName) = std::make_unique<AssetPoolDynamic<decltype(poolName)::element_type::type>>(m_priority, (assetType), m_link_globally);                 \
         }                                                                                                                                                      \
         break;                                                                                                                                                 \
     }
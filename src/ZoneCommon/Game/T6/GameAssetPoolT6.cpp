@@ -72,8 +72,14 @@ const char* GameAssetPoolT6::ASSET_TYPE_NAMES[]{
 };
 
 GameAssetPoolT6::GameAssetPoolT6(Zone* zone, const int priority)
+    : GameAssetPoolT6(zone, priority, true)
+{
+}
+
+GameAssetPoolT6::GameAssetPoolT6(Zone* zone, const int priority, const bool linkGlobally)
     : ZoneAssetPools(zone),
-      m_priority(priority)
+      m_priority(priority),
+      m_link_globally(linkGlobally)
 {
     assert(std::extent_v<decltype(ASSET_TYPE_NAMES)> == ASSET_TYPE_COUNT);
 }
@@ -157,7 +163,7 @@ void GameAssetPoolT6::InitPoolDynamic(const asset_type_t type)
     {                                                                                                                                                          \
         if ((poolName) == nullptr)                                                                                                                             \
         {                                                                                                                                                      \
-            (poolName) = std::make_unique<AssetPoolDynamic<decltype(poolName)::element_type::type>>(m_priority, (assetType));                                  \
+            (poolName) = std::make_unique<AssetPoolDynamic<decltype(poolName)::element_type::type>>(m_priority, (assetType), m_link_globally);                 \
         }                                                                                                                                                      \
         break;                                                                                                                                                 \
     }
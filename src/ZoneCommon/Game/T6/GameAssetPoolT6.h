@@ -9,6 +9,7 @@
 class GameAssetPoolT6 final : public ZoneAssetPools
 {
     int m_priority;
+    bool m_link_globally;
 
     static constexpr const char* ASSET_TYPE_INVALID = "invalid_asset_type";
     static const char* ASSET_TYPE_NAMES[];
@@ -67,6 +68,12 @@ public:
     std::unique_ptr<AssetPool<T6::ZBarrierDef>> m_zbarrier;
 
     GameAssetPoolT6(Zone* zone, int priority);
+
+    /**
+     * \brief Creates asset pools for a zone.
+     * \param linkGlobally Whether the assets can be found through the \c GlobalAssetPool from other zones.
+     */
+    GameAssetPoolT6(Zone* zone, int priority, bool linkGlobally);
     ~GameAssetPoolT6() override = default;
 
     void InitPoolStatic(asset_type_t type, size_t capacity) override;
@@ -10,10 +10,19 @@ SequenceZoneDefinitionBuild::SequenceZoneDefinitionBuild()
         create.Keyword("build"),
         create.Char(','),
         create.Field().Capture(CAPTURE_BUILD_TARGET_NAME),
+        create.OptionalLoop(create.And({
+            create.Char(','),
+            create.Keyword("after"),
+            create.Char(','),
+            create.Field().Capture(CAPTURE_BUILD_AFTER_TARGET_NAME),
+        })),
     });
 }
 
 void SequenceZoneDefinitionBuild::ProcessMatch(ZoneDefinition* state, SequenceResult<ZoneDefinitionParserValue>& result) const
 {
-    state->m_targets_to_build.emplace_back(result.NextCapture(CAPTURE_BUILD_TARGET_NAME).FieldValue());
+    auto& buildTarget = state->m_targets_to_build.emplace_back(result.NextCapture(CAPTURE_BUILD_TARGET_NAME).FieldValue());
+
+    while (result.HasNextCapture(CAPTURE_BUILD_AFTER_TARGET_NAME))
+        buildTarget.m_build_after.emplace_back(result.NextCapture(CAPTURE_BUILD_AFTER_TARGET_NAME).FieldValue());
 }
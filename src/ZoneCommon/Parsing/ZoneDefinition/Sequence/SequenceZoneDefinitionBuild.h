@@ -5,6 +5,7 @@
 class SequenceZoneDefinitionBuild final : public ZoneDefinitionParser::sequence_t
 {
     static constexpr auto CAPTURE_BUILD_TARGET_NAME = 1;
+    static constexpr auto CAPTURE_BUILD_AFTER_TARGET_NAME = 2;
 
 protected:
     void ProcessMatch(ZoneDefinition* state, SequenceResult<ZoneDefinitionParserValue>& result) const override;
@@ -12,12 +12,20 @@ template<typename T> class AssetPoolDynamic final : public AssetPool<T>
 
     std::vector<std::unique_ptr<XAssetInfo<T>>> m_assets;
     asset_type_t m_type;
+    bool m_link_globally;
 
 public:
     AssetPoolDynamic(const int priority, const asset_type_t type)
+        : AssetPoolDynamic(priority, type, true)
     {
-        GlobalAssetPool<T>::LinkAssetPool(this, priority);
-        m_type = type;
+    }
+
+    AssetPoolDynamic(const int priority, const asset_type_t type, const bool linkGlobally)
+        : m_type(type),
+          m_link_globally(linkGlobally)
+    {
+        if (m_link_globally)
+            GlobalAssetPool<T>::LinkAssetPool(this, priority);
     }
 
     AssetPoolDynamic(AssetPoolDynamic<T>&) = delete;
@@ -27,7 +35,8 @@ public:
 
     ~AssetPoolDynamic() override
     {
-        GlobalAssetPool<T>::UnlinkAssetPool(this);
+        if (m_link_globally)
+            GlobalAssetPool<T>::UnlinkAssetPool(this);
 
         for (auto& entry : m_assets)
         {
@@ -40,17 +49,18 @@ public:
 
     XAssetInfo<T>* AddAsset(std::unique_ptr<XAssetInfo<T>> xAssetInfo) override
     {
-        const auto normalizedName = XAssetInfo<T>::NormalizeAssetName(xAssetInfo->m_name);
+        auto normalizedName = XAssetInfo<T>::NormalizeAssetName(xAssetInfo->m_name);
 
         T* newAsset = new T();
         memcpy(newAsset, xAssetInfo->Asset(), sizeof(T));
         xAssetInfo->m_ptr = newAsset;
 
         auto* pAssetInfo = xAssetInfo.get();
-        m_asset_lookup[normalizedName] = pAssetInfo;
+        const auto& lookupName = m_asset_lookup.insert_or_assign(std::move(normalizedName), pAssetInfo).first->first;
         m_assets.emplace_back(std::move(xAssetInfo));
 
-        GlobalAssetPool<T>::LinkAsset(this, normalizedName, pAssetInfo);
+        if (m_link_globally)
+            GlobalAssetPool<T>::LinkAsset(this, lookupName, pAssetInfo);
 
         return pAssetInfo;
     }
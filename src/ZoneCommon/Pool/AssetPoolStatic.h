@@ -84,7 +84,7 @@ public:
         if (m_free == nullptr)
             throw std::runtime_error("Could not add asset to static asset pool: capacity exhausted.");
 
-        const auto normalizedName = XAssetInfo<T>::NormalizeAssetName(xAssetInfo->m_name);
+        auto normalizedName = XAssetInfo<T>::NormalizeAssetName(xAssetInfo->m_name);
 
         AssetPoolEntry* poolSlot = m_free;
         m_free = m_free->m_next;
@@ -95,9 +95,9 @@ public:
 
         *poolSlot->m_info = std::move(*xAssetInfo);
 
-        m_asset_lookup[normalizedName] = poolSlot->m_info;
+        const auto& lookupName = m_asset_lookup.insert_or_assign(std::move(normalizedName), poolSlot->m_info).first->first;
 
-        GlobalAssetPool<T>::LinkAsset(this, normalizedName, poolSlot->m_info);
+        GlobalAssetPool<T>::LinkAsset(this, lookupName, poolSlot->m_info);
 
         return poolSlot->m_info;
     }
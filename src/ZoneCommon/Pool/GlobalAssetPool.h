@@ -5,7 +5,11 @@
 #include <algorithm>
 #include <cassert>
 #include <memory>
+#include <mutex>
+#include <ranges>
+#include <shared_mutex>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -24,34 +28,33 @@ template<typename T> class GlobalAssetPool
         LinkedAssetPool* m_asset_pool;
     };
 
+    // Sorted by priority
     static std::vector<std::unique_ptr<LinkedAssetPool>> m_linked_asset_pools;
-    static std::unordered_map<std::string, GameAssetPoolEntry> m_assets;
+    static std::unordered_map<const AssetPool<T>*, LinkedAssetPool*> m_links_by_asset_pool;
 
-    static void SortLinkedAssetPools()
-    {
-        std::sort(m_linked_asset_pools.begin(),
-                  m_linked_asset_pools.end(),
-                  [](const std::unique_ptr<LinkedAssetPool>& a, const std::unique_ptr<LinkedAssetPool>& b) -> bool
-                  {
-                      return a->m_priority < b->m_priority;
-                  });
-    }
+    // Names are views of the normalized name keys of the asset pool the entry belongs to, so they do not need to be copied
+    static std::unordered_map<std::string_view, GameAssetPoolEntry> m_assets;
+
+    // Zones can be loaded and unloaded from multiple threads at once while lookups can happen concurrently
+    static std::shared_mutex m_mutex;
 
-    static bool ReplaceAssetPoolEntry(GameAssetPoolEntry& assetEntry)
+    static bool ReplaceAssetPoolEntry(GameAssetPoolEntry& assetEntry, const std::string& normalizedAssetName, std::string_view& entryName)
     {
         int occurrences = 0;
 
         for (const auto& linkedAssetPool : m_linked_asset_pools)
         {
-            XAssetInfo<T>* foundAsset = linkedAssetPool->m_asset_pool->GetAsset(assetEntry.m_asset->m_name);
+            const auto& assetLookup = linkedAssetPool->m_asset_pool->m_asset_lookup;
+            const auto foundAsset = assetLookup.find(normalizedAssetName);
 
-            if (foundAsset != nullptr)
+            if (foundAsset != assetLookup.end())
             {
                 if (++occurrences == 1)
                 {
-                    assetEntry.m_asset = foundAsset;
+                    assetEntry.m_asset = foundAsset->second;
                     assetEntry.m_duplicate = false;
                     assetEntry.m_asset_pool = linkedAssetPool.get();
+                    entryName = foundAsset->first;
                 }
                 else
                 {
@@ -66,111 +69,106 @@ template<typename T> class GlobalAssetPool
 
     static void LinkAsset(LinkedAssetPool* link, const std::string& normalizedAssetName, XAssetInfo<T>* asset)
     {
-        auto existingAsset = m_assets.find(normalizedAssetName);
-
-        if (existingAsset == m_assets.end())
-        {
-            GameAssetPoolEntry entry{};
-            entry.m_asset = asset;
-            entry.m_asset_pool = link;
-            entry.m_duplicate = false;
+        const auto [existingAsset, inserted] = m_assets.try_emplace(normalizedAssetName, GameAssetPoolEntry{asset, false, link});
+        if (inserted)
+            return;
 
-            m_assets[normalizedAssetName] = entry;
-        }
-        else
-        {
-            auto& existingEntry = existingAsset->second;
+        auto& existingEntry = existingAsset->second;
 
-            existingEntry.m_duplicate = true;
+        existingEntry.m_duplicate = true;
 
-            if (existingEntry.m_asset_pool->m_priority < link->m_priority)
-            {
-                existingEntry.m_asset_pool = link;
-                existingEntry.m_asset = asset;
-            }
+        if (existingEntry.m_asset_pool->m_priority < link->m_priority)
+        {
+            // The key has to be replaced as well since it references the name owned by the previous asset pool
+            auto node = m_assets.extract(existingAsset);
+            node.key() = normalizedAssetName;
+            node.mapped().m_asset_pool = link;
+            node.mapped().m_asset = asset;
+            m_assets.insert(std::move(node));
         }
     }
 
 public:
     static void LinkAssetPool(AssetPool<T>* assetPool, const int priority)
     {
+        std::unique_lock lock(m_mutex);
+
         auto newLink = std::make_unique<LinkedAssetPool>();
         newLink->m_asset_pool = assetPool;
         newLink->m_priority = priority;
 
         auto* newLinkPtr = newLink.get();
-        m_linked_asset_pools.emplace_back(std::move(newLink));
-        SortLinkedAssetPools();
-
-        for (auto asset : *assetPool)
-        {
-            const auto normalizedAssetName = XAssetInfo<T>::NormalizeAssetName(asset->m_name);
+        const auto insertPosition = std::ranges::upper_bound(m_linked_asset_pools,
+                                                             priority,
+                                                             std::less(),
+                                                             [](const std::unique_ptr<LinkedAssetPool>& link)
+                                                             {
+                                                                 return link->m_priority;
+                                                             });
+        m_linked_asset_pools.emplace(insertPosition, std::move(newLink));
+        m_links_by_asset_pool.emplace(assetPool, newLinkPtr);
+
+        for (const auto& [normalizedAssetName, asset] : assetPool->m_asset_lookup)
             LinkAsset(newLinkPtr, normalizedAssetName, asset);
-        }
     }
 
+    /**
+     * \brief Links an asset that was added to an already linked asset pool.
+     * \param assetPool The asset pool the asset was added to.
+     * \param normalizedAssetName The normalized name of the asset. Must be the key of the asset in the lookup of the asset pool.
+     * \param asset The asset to link.
+     */
     static void LinkAsset(AssetPool<T>* assetPool, const std::string& normalizedAssetName, XAssetInfo<T>* asset)
     {
-        LinkedAssetPool* link = nullptr;
+        std::unique_lock lock(m_mutex);
 
-        for (const auto& existingLink : m_linked_asset_pools)
-        {
-            if (existingLink->m_asset_pool == assetPool)
-            {
-                link = existingLink.get();
-                break;
-            }
-        }
+        const auto link = m_links_by_asset_pool.find(assetPool);
 
-        assert(link != nullptr);
-        if (link == nullptr)
+        assert(link != m_links_by_asset_pool.end());
+        if (link == m_links_by_asset_pool.end())
             return;
 
-        LinkAsset(link, normalizedAssetName, asset);
+        LinkAsset(link->second, normalizedAssetName, asset);
     }
 
     static void UnlinkAssetPool(AssetPool<T>* assetPool)
     {
-        auto iLinkEntry = m_linked_asset_pools.begin();
+        std::unique_lock lock(m_mutex);
 
-        for (; iLinkEntry != m_linked_asset_pools.end(); ++iLinkEntry)
-        {
-            LinkedAssetPool* linkEntry = iLinkEntry->get();
-            if (linkEntry->m_asset_pool == assetPool)
-            {
-                break;
-            }
-        }
+        const auto linkByAssetPool = m_links_by_asset_pool.find(assetPool);
 
-        assert(iLinkEntry != m_linked_asset_pools.end());
-        if (iLinkEntry == m_linked_asset_pools.end())
+        assert(linkByAssetPool != m_links_by_asset_pool.end());
+        if (linkByAssetPool == m_links_by_asset_pool.end())
             return;
 
-        auto assetPoolToUnlink = std::move(*iLinkEntry);
+        auto* linkToRemove = linkByAssetPool->second;
+        m_links_by_asset_pool.erase(linkByAssetPool);
+
+        const auto iLinkEntry = std::ranges::find_if(m_linked_asset_pools,
+                                                     [linkToRemove](const std::unique_ptr<LinkedAssetPool>& link)
+                                                     {
+                                                         return link.get() == linkToRemove;
+                                                     });
+        const auto assetPoolToUnlink = std::move(*iLinkEntry);
         m_linked_asset_pools.erase(iLinkEntry);
 
-        for (auto iAssetEntry = m_assets.begin(); iAssetEntry != m_assets.end();)
+        // Only entries of assets of the unlinked pool can reference it
+        for (const auto& normalizedAssetName : assetPool->m_asset_lookup | std::views::keys)
         {
-            auto& assetEntry = *iAssetEntry;
-
-            if (assetEntry.second.m_asset_pool != assetPoolToUnlink.get())
-            {
-                ++iAssetEntry;
+            const auto iAssetEntry = m_assets.find(normalizedAssetName);
+            if (iAssetEntry == m_assets.end() || iAssetEntry->second.m_asset_pool != assetPoolToUnlink.get())
                 continue;
-            }
 
-            if (assetEntry.second.m_duplicate && ReplaceAssetPoolEntry(assetEntry.second))
-            {
-                ++iAssetEntry;
-                continue;
-            }
-
-            iAssetEntry = m_assets.erase(iAssetEntry);
+            auto node = m_assets.extract(iAssetEntry);
+            if (node.mapped().m_duplicate && ReplaceAssetPoolEntry(node.mapped(), normalizedAssetName, node.key()))
+                m_assets.insert(std::move(node));
         }
     }
 
-    static XAssetInfo<T>* GetAssetByName(const std::string& name)
+    static XAssetInfo<T>* GetAssetByName(const std::string_view name)
     {
+        std::shared_lock lock(m_mutex);
+
         const auto foundEntry = m_assets.find(name);
         if (foundEntry == m_assets.end())
             return nullptr;
@@ -184,5 +182,11 @@ std::vector<std::unique_ptr<typename GlobalAssetPool<T>::LinkedAssetPool>> Globa
     std::vector<std::unique_ptr<LinkedAssetPool>>();
 
 template<typename T>
-std::unordered_map<std::string, typename GlobalAssetPool<T>::GameAssetPoolEntry> GlobalAssetPool<T>::m_assets =
-    std::unordered_map<std::string, GameAssetPoolEntry>();
+std::unordered_map<const AssetPool<T>*, typename GlobalAssetPool<T>::LinkedAssetPool*> GlobalAssetPool<T>::m_links_by_asset_pool =
+    std::unordered_map<const AssetPool<T>*, LinkedAssetPool*>();
+
+template<typename T>
+std::unordered_map<std::string_view, typename GlobalAssetPool<T>::GameAssetPoolEntry> GlobalAssetPool<T>::m_assets =
+    std::unordered_map<std::string_view, GameAssetPoolEntry>();
+
+template<typename T> std::shared_mutex GlobalAssetPool<T>::m_mutex;
@@ -5,9 +5,9 @@ AssetListInputStream::AssetListInputStream(std::istream& stream)
 {
 }
 
-bool AssetListInputStream::NextEntry(AssetListEntry& entry) const
+bool AssetListInputStream::NextEntry(AssetListEntry& entry)
 {
-    std::vector<std::string> row;
+    std::vector<std::string_view> row;
 
     while (true)
     {
@@ -11,7 +11,7 @@ class AssetListInputStream
 public:
     explicit AssetListInputStream(std::istream& stream);
 
-    bool NextEntry(AssetListEntry& entry) const;
+    bool NextEntry(AssetListEntry& entry);
 };
 
 class AssetListOutputStream
@@ -20,6 +20,13 @@ ZoneMetaDataEntry::ZoneMetaDataEntry(std::string key, std::string value)
 {
 }
 
+ZoneDefinitionBuildTarget::ZoneDefinitionBuildTarget() = default;
+
+ZoneDefinitionBuildTarget::ZoneDefinitionBuildTarget(std::string name)
+    : m_name(std::move(name))
+{
+}
+
 void ZoneDefinition::AddMetaData(std::string key, std::string value)
 {
     auto metaData = std::make_unique<ZoneMetaDataEntry>(std::move(key), std::move(value));
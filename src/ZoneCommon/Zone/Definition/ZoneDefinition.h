@@ -28,6 +28,18 @@ public:
     ZoneMetaDataEntry(std::string key, std::string value);
 };
 
+class ZoneDefinitionBuildTarget
+{
+public:
+    std::string m_name;
+
+    // Other referenced targets that need to be built before this one, for example because it uses their output
+    std::vector<std::string> m_build_after;
+
+    ZoneDefinitionBuildTarget();
+    explicit ZoneDefinitionBuildTarget(std::string name);
+};
+
 class ZoneDefinition
 {
 public:
@@ -37,7 +49,7 @@ public:
     std::vector<std::string> m_includes;
     std::vector<std::string> m_asset_lists;
     std::vector<std::string> m_ignores;
-    std::vector<std::string> m_targets_to_build;
+    std::vector<ZoneDefinitionBuildTarget> m_targets_to_build;
     std::vector<ZoneDefinitionEntry> m_assets;
 
     void AddMetaData(std::string key, std::string value);
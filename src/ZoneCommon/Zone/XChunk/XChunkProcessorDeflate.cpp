@@ -6,6 +6,17 @@
 #include <zlib.h>
 #include <zutil.h>
 
+XChunkProcessorDeflate::XChunkProcessorDeflate()
+    : XChunkProcessorDeflate(Z_BEST_COMPRESSION)
+{
+}
+
+XChunkProcessorDeflate::XChunkProcessorDeflate(const int compressionLevel)
+    : m_compression_level(compressionLevel)
+{
+    assert(compressionLevel >= Z_NO_COMPRESSION && compressionLevel <= Z_BEST_COMPRESSION);
+}
+
 size_t XChunkProcessorDeflate::Process(int streamNumber, const uint8_t* input, const size_t inputLength, uint8_t* output, const size_t outputBufferSize)
 {
     z_stream stream{};
@@ -13,7 +24,7 @@ size_t XChunkProcessorDeflate::Process(int streamNumber, const uint8_t* input, c
     stream.zfree = Z_NULL;
     stream.opaque = Z_NULL;
 
-    auto ret = deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, -DEF_WBITS, DEF_MEM_LEVEL, Z_DEFAULT_STRATEGY);
+    auto ret = deflateInit2(&stream, m_compression_level, Z_DEFLATED, -DEF_WBITS, DEF_MEM_LEVEL, Z_DEFAULT_STRATEGY);
     if (ret != Z_OK)
         throw XChunkException("Initializing deflate failed.");
 
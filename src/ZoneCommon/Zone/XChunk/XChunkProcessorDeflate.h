@@ -3,6 +3,15 @@
 
 class XChunkProcessorDeflate final : public IXChunkProcessor
 {
+    int m_compression_level;
+
 public:
+    XChunkProcessorDeflate();
+
+    /**
+     * \brief Deflates chunks with the specified zlib compression level from 0 to 9 instead of the best compression.
+     */
+    explicit XChunkProcessorDeflate(int compressionLevel);
+
     size_t Process(int streamNumber, const uint8_t* input, size_t inputLength, uint8_t* output, size_t outputBufferSize) override;
 };
@@ -1,6 +1,9 @@
 #include "ZoneMemory.h"
 
-ZoneMemory::ZoneMemory() = default;
+ZoneMemory::ZoneMemory()
+    : MemoryManager(ARENA_CHUNK_SIZE)
+{
+}
 
 void ZoneMemory::AddBlock(std::unique_ptr<XBlock> block)
 {
@@ -8,6 +8,8 @@
 
 class ZoneMemory : public MemoryManager
 {
+    static constexpr size_t ARENA_CHUNK_SIZE = 0x40000;
+
     std::vector<std::unique_ptr<XBlock>> m_blocks;
 
 public:
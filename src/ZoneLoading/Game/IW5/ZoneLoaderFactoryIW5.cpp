@@ -9,6 +9,7 @@
 #include "Loading/Processor/ProcessorAuthedBlocks.h"
 #include "Loading/Processor/ProcessorCaptureData.h"
 #include "Loading/Processor/ProcessorInflate.h"
+#include "Loading/Processor/ProcessorReadAhead.h"
 #include "Loading/Steps/StepAddProcessor.h"
 #include "Loading/Steps/StepAllocXBlocks.h"
 #include "Loading/Steps/StepLoadHash.h"
@@ -182,6 +183,9 @@ public:
 
         zoneLoader->AddLoadingStep(std::make_unique<StepAddProcessor>(std::make_unique<ProcessorInflate>(ZoneConstants::AUTHED_CHUNK_SIZE)));
 
+        // Verify and inflate the next blocks on a background thread while the content of the previous ones is loaded
+        zoneLoader->AddLoadingStep(std::make_unique<StepAddProcessor>(std::make_unique<ProcessorReadAhead>()));
+
         // Start of the XFile struct
         zoneLoader->AddLoadingStep(std::make_unique<StepSkipBytes>(8));
         // Skip size and externalSize fields since they are not interesting for us
@@ -0,0 +1,23 @@
+#include "ILoadingStream.h"
+
+size_t ILoadingStream::LoadNullTerminated(void* buffer, const size_t maxLength)
+{
+    auto* byteBuffer = static_cast<uint8_t*>(buffer);
+
+    size_t loadedSize = 0;
+    while (loadedSize < maxLength)
+    {
+        if (Load(&byteBuffer[loadedSize], 1) == 0)
+            break;
+
+        if (byteBuffer[loadedSize++] == 0)
+            break;
+    }
+
+    return loadedSize;
+}
+
+std::span<const uint8_t> ILoadingStream::LoadSpan(const size_t length)
+{
+    return {};
+}
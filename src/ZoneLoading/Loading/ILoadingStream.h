@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <span>
 
 class ILoadingStream
 {
@@ -10,4 +11,23 @@ public:
 
     virtual size_t Load(void* buffer, size_t length) = 0;
     virtual int64_t Pos() = 0;
+
+    /**
+     * \brief Loads data up to and including the next null terminator.
+     * Streams that keep their data in memory can override this to scan for the terminator and copy whole runs at once.
+     * \param buffer The buffer to load the data into.
+     * \param maxLength The maximum amount of bytes to load.
+     * \return The amount of bytes that were loaded including the terminator.
+     * If no terminator was loaded, either \c maxLength was reached or the end of the stream.
+     */
+    virtual size_t LoadNullTerminated(void* buffer, size_t maxLength);
+
+    /**
+     * \brief Loads data without copying it into a separate buffer.
+     * Streams that keep their data in memory can override this to hand out their data directly.
+     * \param length The maximum amount of bytes to load.
+     * \return The loaded data which stays valid for the lifetime of the stream.
+     * An empty span is returned if the stream cannot load without copying or is at its end, in which case nothing was loaded and \c Load should be used.
+     */
+    virtual std::span<const uint8_t> LoadSpan(size_t length);
 };
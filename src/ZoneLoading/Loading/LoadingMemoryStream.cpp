@@ -0,0 +1,52 @@
+#include "LoadingMemoryStream.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+LoadingMemoryStream::LoadingMemoryStream(const uint8_t* data, const size_t size, const size_t offset)
+    : m_data(data),
+      m_size(size),
+      m_offset(std::min(offset, size))
+{
+    assert(data != nullptr || size == 0);
+}
+
+size_t LoadingMemoryStream::Load(void* buffer, const size_t length)
+{
+    const auto loadedData = LoadSpan(length);
+    if (!loadedData.empty())
+        memcpy(buffer, loadedData.data(), loadedData.size());
+
+    return loadedData.size();
+}
+
+int64_t LoadingMemoryStream::Pos()
+{
+    return static_cast<int64_t>(m_offset);
+}
+
+size_t LoadingMemoryStream::LoadNullTerminated(void* buffer, const size_t maxLength)
+{
+    const auto sizeToScan = std::min(maxLength, m_size - m_offset);
+    if (sizeToScan == 0)
+        return 0;
+
+    const auto* scanStart = m_data + m_offset;
+    const auto* terminator = static_cast<const uint8_t*>(memchr(scanStart, 0, sizeToScan));
+    const auto sizeToCopy = terminator != nullptr ? static_cast<size_t>(terminator - scanStart) + 1u : sizeToScan;
+
+    memcpy(buffer, scanStart, sizeToCopy);
+    m_offset += sizeToCopy;
+
+    return sizeToCopy;
+}
+
+std::span<const uint8_t> LoadingMemoryStream::LoadSpan(const size_t length)
+{
+    const auto loadedSize = std::min(length, m_size - m_offset);
+    const std::span loadedData(m_data + m_offset, loadedSize);
+    m_offset += loadedSize;
+
+    return loadedData;
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include "ILoadingStream.h"
+
+/**
+ * \brief A loading stream for data that is already in memory, like a memory mapped file.
+ * Data can be loaded without copying it via \c LoadSpan.
+ */
+class LoadingMemoryStream final : public ILoadingStream
+{
+    const uint8_t* m_data;
+    size_t m_size;
+    size_t m_offset;
+
+public:
+    /**
+     * \param data The data of the stream. It needs to stay valid for the lifetime of the stream and of all spans that were loaded from it.
+     * \param size The size of the data.
+     * \param offset The offset to start loading from. Positions of the stream are relative to the start of the data.
+     */
+    LoadingMemoryStream(const uint8_t* data, size_t size, size_t offset);
+
+    size_t Load(void* buffer, size_t length) override;
+    int64_t Pos() override;
+    size_t LoadNullTerminated(void* buffer, size_t maxLength) override;
+    std::span<const uint8_t> LoadSpan(size_t length) override;
+};
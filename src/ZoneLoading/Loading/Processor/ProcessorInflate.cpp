@@ -2,7 +2,9 @@
 
 #include "Loading/Exception/InvalidCompressionException.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <stdexcept>
 #include <zlib.h>
@@ -16,10 +18,64 @@ class ProcessorInflate::Impl
     std::unique_ptr<uint8_t[]> m_buffer;
     size_t m_buffer_size;
 
+    // Data that was inflated ahead when scanning for null terminators but not yet consumed
+    std::unique_ptr<uint8_t[]> m_output_buffer;
+    size_t m_output_buffer_offset;
+    size_t m_output_buffer_size;
+
+    bool InflateInto(uint8_t* buffer, const size_t length)
+    {
+        m_stream.next_out = buffer;
+        m_stream.avail_out = length;
+
+        while (m_stream.avail_out > 0)
+        {
+            if (m_stream.avail_in == 0)
+            {
+                // Inflate straight from the base stream when it can hand out its data without copying
+                if (const auto input = m_base->m_base_stream->LoadSpan(m_buffer_size); !input.empty())
+                {
+                    m_stream.avail_in = static_cast<uInt>(input.size());
+                    m_stream.next_in = const_cast<Bytef*>(input.data());
+                }
+                else
+                {
+                    m_stream.avail_in = m_base->m_base_stream->Load(m_buffer.get(), m_buffer_size);
+                    m_stream.next_in = m_buffer.get();
+                }
+
+                if (m_stream.avail_in == 0) // EOF
+                    return false;
+            }
+
+            auto ret = inflate(&m_stream, Z_SYNC_FLUSH);
+
+            if (ret < 0)
+                throw InvalidCompressionException();
+
+            if (ret == Z_STREAM_END)
+                return false;
+        }
+
+        return true;
+    }
+
+    size_t LoadFromOutputBuffer(void* buffer, const size_t length)
+    {
+        const auto sizeToCopy = std::min(length, m_output_buffer_size - m_output_buffer_offset);
+        memcpy(buffer, &m_output_buffer[m_output_buffer_offset], sizeToCopy);
+        m_output_buffer_offset += sizeToCopy;
+
+        return sizeToCopy;
+    }
+
 public:
     Impl(ProcessorInflate* baseClass, const size_t bufferSize)
         : m_buffer(std::make_unique<uint8_t[]>(bufferSize)),
-          m_buffer_size(bufferSize)
+          m_buffer_size(bufferSize),
+          m_output_buffer(std::make_unique<uint8_t[]>(bufferSize)),
+          m_output_buffer_offset(0),
+          m_output_buffer_size(0)
     {
         m_base = baseClass;
 
@@ -49,27 +105,45 @@ public:
 
     size_t Load(void* buffer, const size_t length)
     {
-        m_stream.next_out = static_cast<Bytef*>(buffer);
-        m_stream.avail_out = length;
+        const auto bufferedSize = LoadFromOutputBuffer(buffer, length);
+        if (bufferedSize == length)
+            return length;
 
-        while (m_stream.avail_out > 0)
+        const auto remainingLength = length - bufferedSize;
+        InflateInto(static_cast<Bytef*>(buffer) + bufferedSize, remainingLength);
+
+        return length - m_stream.avail_out;
+    }
+
+    size_t LoadNullTerminated(void* buffer, const size_t maxLength)
+    {
+        auto* byteBuffer = static_cast<uint8_t*>(buffer);
+
+        size_t loadedSize = 0;
+        while (loadedSize < maxLength)
         {
-            if (m_stream.avail_in == 0)
+            if (m_output_buffer_offset == m_output_buffer_size)
             {
-                m_stream.avail_in = m_base->m_base_stream->Load(m_buffer.get(), m_buffer_size);
-                m_stream.next_in = m_buffer.get();
+                const auto hasMoreData = InflateInto(m_output_buffer.get(), m_buffer_size);
+                m_output_buffer_offset = 0;
+                m_output_buffer_size = m_buffer_size - m_stream.avail_out;
 
-                if (m_stream.avail_in == 0) // EOF
-                    return length - m_stream.avail_out;
+                if (!hasMoreData && m_output_buffer_size == 0)
+                    break;
             }
 
-            auto ret = inflate(&m_stream, Z_SYNC_FLUSH);
+            const auto* scanStart = &m_output_buffer[m_output_buffer_offset];
+            const auto sizeToScan = std::min(maxLength - loadedSize, m_output_buffer_size - m_output_buffer_offset);
+            const auto* terminator = static_cast<const uint8_t*>(memchr(scanStart, 0, sizeToScan));
+            const auto sizeToCopy = terminator != nullptr ? static_cast<size_t>(terminator - scanStart) + 1u : sizeToScan;
 
-            if (ret < 0)
-                throw InvalidCompressionException();
+            loadedSize += LoadFromOutputBuffer(&byteBuffer[loadedSize], sizeToCopy);
+
+            if (terminator != nullptr)
+                break;
         }
 
-        return length - m_stream.avail_out;
+        return loadedSize;
     }
 };
 
@@ -94,6 +168,11 @@ size_t ProcessorInflate::Load(void* buffer, const size_t length)
     return m_impl->Load(buffer, length);
 }
 
+size_t ProcessorInflate::LoadNullTerminated(void* buffer, const size_t maxLength)
+{
+    return m_impl->LoadNullTerminated(buffer, maxLength);
+}
+
 int64_t ProcessorInflate::Pos()
 {
     return m_base_stream->Pos();
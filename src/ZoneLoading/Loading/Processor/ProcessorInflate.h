@@ -18,5 +18,6 @@ public:
     ProcessorInflate& operator=(ProcessorInflate&& other) noexcept = default;
 
     size_t Load(void* buffer, size_t length) override;
+    size_t LoadNullTerminated(void* buffer, size_t maxLength) override;
     int64_t Pos() override;
 };
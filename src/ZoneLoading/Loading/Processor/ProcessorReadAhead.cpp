@@ -0,0 +1,295 @@
+#include "ProcessorReadAhead.h"
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ProcessorReadAhead::Impl
+{
+    class Buffer
+    {
+    public:
+        std::unique_ptr<uint8_t[]> m_data;
+        size_t m_size;
+        int64_t m_base_pos;
+
+        explicit Buffer(const size_t bufferSize)
+            : m_data(std::make_unique<uint8_t[]>(bufferSize)),
+              m_size(0),
+              m_base_pos(0)
+        {
+        }
+    };
+
+    ProcessorReadAhead* m_base;
+    const size_t m_buffer_size;
+    std::vector<Buffer> m_buffers;
+
+    std::mutex m_mutex;
+    std::condition_variable m_buffer_loaded;
+    std::condition_variable m_buffer_consumed;
+    size_t m_loaded_buffer_count;
+    bool m_base_stream_done;
+    bool m_stop;
+    std::exception_ptr m_error;
+
+    // Only accessed by the background thread after it started
+    size_t m_write_index;
+
+    // Only accessed by the consuming thread
+    size_t m_read_index;
+    bool m_has_current_buffer;
+    size_t m_current_buffer_offset;
+    int64_t m_current_pos;
+
+    std::thread m_thread;
+
+    void LoadAhead(ILoadingStream* baseStream)
+    {
+        while (true)
+        {
+            {
+                std::unique_lock lock(m_mutex);
+                m_buffer_consumed.wait(lock,
+                                       [this]
+                                       {
+                                           return m_stop || m_loaded_buffer_count < m_buffers.size();
+                                       });
+
+                if (m_stop)
+                    return;
+            }
+
+            auto& buffer = m_buffers[m_write_index];
+            std::exception_ptr error;
+            try
+            {
+                // Streams may load less than requested before their end, so only a load without any data ends the stream
+                buffer.m_size = 0;
+                while (buffer.m_size < m_buffer_size)
+                {
+                    const auto loadedSize = baseStream->Load(&buffer.m_data[buffer.m_size], m_buffer_size - buffer.m_size);
+                    if (loadedSize == 0)
+                        break;
+
+                    buffer.m_size += loadedSize;
+                }
+                buffer.m_base_pos = baseStream->Pos();
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+
+            std::lock_guard lock(m_mutex);
+            if (error)
+            {
+                m_error = error;
+                m_base_stream_done = true;
+            }
+            else
+            {
+                m_write_index = (m_write_index + 1) % m_buffers.size();
+                m_loaded_buffer_count++;
+                m_base_stream_done = buffer.m_size < m_buffer_size;
+            }
+
+            m_buffer_loaded.notify_one();
+
+            if (m_base_stream_done)
+                return;
+        }
+    }
+
+    void StartIfNecessary()
+    {
+        if (m_thread.joinable())
+            return;
+
+        // The base stream is passed on so that rebuilding the processor chain does not touch data the background thread uses
+        m_current_pos = m_base->m_base_stream->Pos();
+        m_thread = std::thread(&Impl::LoadAhead, this, m_base->m_base_stream);
+    }
+
+    bool NextBuffer()
+    {
+        std::unique_lock lock(m_mutex);
+
+        if (m_has_current_buffer)
+        {
+            m_has_current_buffer = false;
+            m_read_index = (m_read_index + 1) % m_buffers.size();
+            m_loaded_buffer_count--;
+            m_buffer_consumed.notify_one();
+        }
+
+        m_buffer_loaded.wait(lock,
+                             [this]
+                             {
+                                 return m_loaded_buffer_count > 0 || m_base_stream_done;
+                             });
+
+        if (m_loaded_buffer_count == 0)
+        {
+            if (m_error)
+                std::rethrow_exception(m_error);
+
+            return false;
+        }
+
+        m_has_current_buffer = true;
+        m_current_buffer_offset = 0;
+        m_current_pos = m_buffers[m_read_index].m_base_pos;
+
+        return true;
+    }
+
+    bool HasDataInCurrentBuffer() const
+    {
+        return m_has_current_buffer && m_current_buffer_offset < m_buffers[m_read_index].m_size;
+    }
+
+public:
+    Impl(ProcessorReadAhead* baseClass, const size_t bufferSize, const unsigned bufferCount)
+        : m_base(baseClass),
+          m_buffer_size(bufferSize),
+          m_loaded_buffer_count(0),
+          m_base_stream_done(false),
+          m_stop(false),
+          m_write_index(0),
+          m_read_index(0),
+          m_has_current_buffer(false),
+          m_current_buffer_offset(0),
+          m_current_pos(0)
+    {
+        assert(bufferSize > 0);
+        assert(bufferCount > 0);
+
+        m_buffers.reserve(bufferCount);
+        for (auto i = 0u; i < bufferCount; i++)
+            m_buffers.emplace_back(bufferSize);
+    }
+
+    ~Impl()
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stop = true;
+        }
+        m_buffer_consumed.notify_one();
+
+        if (m_thread.joinable())
+            m_thread.join();
+    }
+
+    Impl(const Impl& other) = delete;
+    Impl(Impl&& other) noexcept = delete;
+    Impl& operator=(const Impl& other) = delete;
+    Impl& operator=(Impl&& other) noexcept = delete;
+
+    size_t Load(void* buffer, const size_t length)
+    {
+        StartIfNecessary();
+
+        size_t loadedSize = 0;
+        while (loadedSize < length)
+        {
+            if (!HasDataInCurrentBuffer())
+            {
+                if (!NextBuffer())
+                    break;
+
+                continue;
+            }
+
+            const auto& currentBuffer = m_buffers[m_read_index];
+            const auto sizeToCopy = std::min(length - loadedSize, currentBuffer.m_size - m_current_buffer_offset);
+            memcpy(&static_cast<uint8_t*>(buffer)[loadedSize], &currentBuffer.m_data[m_current_buffer_offset], sizeToCopy);
+            loadedSize += sizeToCopy;
+            m_current_buffer_offset += sizeToCopy;
+        }
+
+        return loadedSize;
+    }
+
+    size_t LoadNullTerminated(void* buffer, const size_t maxLength)
+    {
+        StartIfNecessary();
+
+        auto* byteBuffer = static_cast<uint8_t*>(buffer);
+
+        size_t loadedSize = 0;
+        while (loadedSize < maxLength)
+        {
+            if (!HasDataInCurrentBuffer())
+            {
+                if (!NextBuffer())
+                    break;
+
+                continue;
+            }
+
+            const auto& currentBuffer = m_buffers[m_read_index];
+            const auto* scanStart = &currentBuffer.m_data[m_current_buffer_offset];
+            const auto sizeToScan = std::min(maxLength - loadedSize, currentBuffer.m_size - m_current_buffer_offset);
+            const auto* terminator = static_cast<const uint8_t*>(memchr(scanStart, 0, sizeToScan));
+            const auto sizeToCopy = terminator != nullptr ? static_cast<size_t>(terminator - scanStart) + 1u : sizeToScan;
+
+            memcpy(&byteBuffer[loadedSize], scanStart, sizeToCopy);
+            loadedSize += sizeToCopy;
+            m_current_buffer_offset += sizeToCopy;
+
+            if (terminator != nullptr)
+                break;
+        }
+
+        return loadedSize;
+    }
+
+    int64_t Pos()
+    {
+        // The base stream cannot be asked while it is loading ahead, so this is its position after loading the buffer that is currently consumed
+        if (!m_thread.joinable())
+            return m_base->m_base_stream->Pos();
+
+        return m_current_pos;
+    }
+};
+
+ProcessorReadAhead::ProcessorReadAhead()
+    : ProcessorReadAhead(DEFAULT_BUFFER_SIZE, DEFAULT_BUFFER_COUNT)
+{
+}
+
+ProcessorReadAhead::ProcessorReadAhead(const size_t bufferSize, const unsigned bufferCount)
+    : m_impl(new Impl(this, bufferSize, bufferCount))
+{
+}
+
+ProcessorReadAhead::~ProcessorReadAhead()
+{
+    delete m_impl;
+    m_impl = nullptr;
+}
+
+size_t ProcessorReadAhead::Load(void* buffer, const size_t length)
+{
+    return m_impl->Load(buffer, length);
+}
+
+size_t ProcessorReadAhead::LoadNullTerminated(void* buffer, const size_t maxLength)
+{
+    return m_impl->LoadNullTerminated(buffer, maxLength);
+}
+
+int64_t ProcessorReadAhead::Pos()
+{
+    return m_impl->Pos();
+}
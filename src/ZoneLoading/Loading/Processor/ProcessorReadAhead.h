@@ -0,0 +1,29 @@
+#pragma once
+#include "Loading/StreamProcessor.h"
+
+/**
+ * \brief Loads the data of its base stream ahead on a background thread into a ring of buffers while the previously loaded buffers are consumed.
+ * The base stream is only accessed from the background thread after the first load, so it must not be used by anything else from then on.
+ * Errors of the base stream are thrown when the data that failed to load would have been consumed.
+ */
+class ProcessorReadAhead final : public StreamProcessor
+{
+    class Impl;
+    Impl* m_impl;
+
+    static constexpr size_t DEFAULT_BUFFER_SIZE = 0x10000;
+    static constexpr unsigned DEFAULT_BUFFER_COUNT = 8;
+
+public:
+    ProcessorReadAhead();
+    ProcessorReadAhead(size_t bufferSize, unsigned bufferCount);
+    ~ProcessorReadAhead() override;
+    ProcessorReadAhead(const ProcessorReadAhead& other) = delete;
+    ProcessorReadAhead(ProcessorReadAhead&& other) noexcept = delete;
+    ProcessorReadAhead& operator=(const ProcessorReadAhead& other) = delete;
+    ProcessorReadAhead& operator=(ProcessorReadAhead&& other) noexcept = delete;
+
+    size_t Load(void* buffer, size_t length) override;
+    size_t LoadNullTerminated(void* buffer, size_t maxLength) override;
+    int64_t Pos() override;
+};
@@ -1,40 +1,78 @@
 #include "ProcessorXChunks.h"
 
 #include "Loading/Exception/InvalidChunkSizeException.h"
+#include "Utils/ThreadPool.h"
 #include "Zone/ZoneTypes.h"
 
+#include <algorithm>
 #include <cassert>
 #include <condition_variable>
 #include <cstring>
+#include <exception>
 #include <memory>
 #include <mutex>
-#include <thread>
+#include <utility>
 #include <vector>
 
 class DBLoadStream
 {
-    int m_index;
+    class Chunk
+    {
+    public:
+        std::unique_ptr<uint8_t[]> m_buffers[2];
 
-    std::unique_ptr<uint8_t[]> m_buffers[2];
+        uint8_t* m_input_buffer;
+        size_t m_input_size;
 
-    uint8_t* m_input_buffer;
-    size_t m_input_size;
+        // Either the input buffer or data of the base stream that could be loaded without copying
+        const uint8_t* m_input_data;
 
-    uint8_t* m_output_buffer;
-    size_t m_output_size;
+        uint8_t* m_output_buffer;
+        size_t m_output_size;
 
+        bool m_is_ready;
+
+        explicit Chunk(const size_t chunkSize)
+        {
+            for (auto& buffer : m_buffers)
+                buffer = std::make_unique<uint8_t[]>(chunkSize);
+
+            m_input_buffer = m_buffers[0].get();
+            m_input_size = 0;
+            m_input_data = m_input_buffer;
+
+            m_output_buffer = m_buffers[1].get();
+            m_output_size = 0;
+
+            m_is_ready = false;
+        }
+    };
+
+    int m_index;
     size_t m_chunk_size;
 
-    bool m_is_loading;
+    // Ring of chunks of this stream. Chunks are filled, processed and consumed in the same order.
+    std::vector<Chunk> m_chunks;
+    size_t m_next_fill_chunk;
+    size_t m_next_process_chunk;
+    size_t m_next_read_chunk;
+    size_t m_pending_chunk_count;
+
+    bool m_is_scheduled;
+    std::exception_ptr m_error;
     std::mutex m_load_mutex;
-    std::condition_variable m_loading_finished;
-    std::thread m_load_thread;
+    std::condition_variable m_chunk_finished;
 
     std::vector<std::unique_ptr<IXChunkProcessor>>& m_processors;
+    ThreadPool& m_thread_pool;
 
-    void Load()
+    void ProcessChunk(Chunk& chunk) const
     {
-        std::lock_guard<std::mutex> lock(m_load_mutex);
+        if (chunk.m_input_size == 0)
+        {
+            chunk.m_output_size = 0;
+            return;
+        }
 
         bool firstProcessor = true;
 
@@ -42,66 +80,108 @@ class DBLoadStream
         {
             if (!firstProcessor)
             {
-                uint8_t* previousInputBuffer = m_input_buffer;
-                m_input_buffer = m_output_buffer;
-                m_output_buffer = previousInputBuffer;
+                std::swap(chunk.m_input_buffer, chunk.m_output_buffer);
 
-                m_input_size = m_output_size;
-                m_output_size = 0;
+                chunk.m_input_data = chunk.m_input_buffer;
+                chunk.m_input_size = chunk.m_output_size;
+                chunk.m_output_size = 0;
             }
 
-            m_output_size = processor->Process(m_index, m_input_buffer, m_input_size, m_output_buffer, m_chunk_size);
+            chunk.m_output_size = processor->Process(m_index, chunk.m_input_data, chunk.m_input_size, chunk.m_output_buffer, m_chunk_size);
 
             firstProcessor = false;
         }
+    }
+
+    // Runs on the thread pool. Chunks of the same stream have to be processed sequentially
+    // since processors like Salsa20 decryption carry state from one chunk of a stream to the next.
+    void ProcessPendingChunks()
+    {
+        std::unique_lock lock(m_load_mutex);
+
+        while (m_pending_chunk_count > 0 && !m_error)
+        {
+            auto& chunk = m_chunks[m_next_process_chunk];
+            lock.unlock();
+
+            std::exception_ptr error;
+            try
+            {
+                ProcessChunk(chunk);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
 
-        m_is_loading = false;
-        m_loading_finished.notify_all();
+            lock.lock();
+            m_error = error;
+            chunk.m_is_ready = true;
+            m_next_process_chunk = (m_next_process_chunk + 1) % m_chunks.size();
+            m_pending_chunk_count--;
+            m_chunk_finished.notify_all();
+        }
+
+        m_is_scheduled = false;
+        m_chunk_finished.notify_all();
     }
 
 public:
-    DBLoadStream(const int streamIndex, const size_t chunkSize, std::vector<std::unique_ptr<IXChunkProcessor>>& chunkProcessors)
-        : m_processors(chunkProcessors)
+    DBLoadStream(const int streamIndex,
+                 const size_t chunkSize,
+                 const unsigned prefetchChunkCount,
+                 std::vector<std::unique_ptr<IXChunkProcessor>>& chunkProcessors,
+                 ThreadPool& threadPool)
+        : m_processors(chunkProcessors),
+          m_thread_pool(threadPool)
     {
+        assert(prefetchChunkCount > 0);
+
         m_index = streamIndex;
         m_chunk_size = chunkSize;
 
-        for (auto& buffer : m_buffers)
-            buffer = std::make_unique<uint8_t[]>(chunkSize);
+        m_chunks.reserve(prefetchChunkCount);
+        for (auto i = 0u; i < prefetchChunkCount; i++)
+            m_chunks.emplace_back(chunkSize);
 
-        m_input_buffer = m_buffers[0].get();
-        m_output_buffer = m_buffers[1].get();
+        m_next_fill_chunk = 0;
+        m_next_process_chunk = 0;
+        m_next_read_chunk = 0;
+        m_pending_chunk_count = 0;
 
-        m_input_size = 0;
-        m_output_size = 0;
-
-        m_is_loading = false;
+        m_is_scheduled = false;
     }
 
     uint8_t* GetInputBuffer() const
     {
-        return m_input_buffer;
+        return m_chunks[m_next_fill_chunk].m_input_buffer;
     }
 
-    void StartLoading(const size_t inputSize)
+    /**
+     * \brief Starts processing the next chunk of this stream.
+     * \param inputData The input of the chunk. Either the buffer of \c GetInputBuffer or data that stays valid until the chunk was processed.
+     * \param inputSize The size of the input of the chunk.
+     */
+    void StartLoading(const uint8_t* inputData, const size_t inputSize)
     {
-        if (inputSize > 0)
-        {
-            std::unique_lock<std::mutex> lock(m_load_mutex);
+        std::lock_guard lock(m_load_mutex);
 
-            if (m_is_loading)
-            {
-                m_loading_finished.wait(lock);
-            }
+        auto& chunk = m_chunks[m_next_fill_chunk];
+        assert(!chunk.m_is_ready);
 
-            m_input_size = inputSize;
-            m_is_loading = true;
-            m_load_thread = std::thread(&DBLoadStream::Load, this);
-            m_load_thread.detach();
-        }
-        else
+        chunk.m_input_data = inputData;
+        chunk.m_input_size = inputSize;
+        m_next_fill_chunk = (m_next_fill_chunk + 1) % m_chunks.size();
+        m_pending_chunk_count++;
+
+        if (!m_is_scheduled)
         {
-            m_output_size = 0;
+            m_is_scheduled = true;
+            m_thread_pool.Enqueue(
+                [this]
+                {
+                    ProcessPendingChunks();
+                });
         }
     }
 
@@ -110,14 +190,37 @@ public:
         assert(pBuffer != nullptr);
         assert(pSize != nullptr);
 
-        std::unique_lock<std::mutex> lock(m_load_mutex);
-        if (m_is_loading)
-        {
-            m_loading_finished.wait(lock);
-        }
+        std::unique_lock lock(m_load_mutex);
+        auto& chunk = m_chunks[m_next_read_chunk];
+        m_chunk_finished.wait(lock,
+                              [this, &chunk]
+                              {
+                                  return chunk.m_is_ready || m_error;
+                              });
+
+        if (m_error)
+            std::rethrow_exception(m_error);
+
+        *pBuffer = chunk.m_output_buffer;
+        *pSize = chunk.m_output_size;
+    }
+
+    void ReleaseOutput()
+    {
+        std::lock_guard lock(m_load_mutex);
+
+        m_chunks[m_next_read_chunk].m_is_ready = false;
+        m_next_read_chunk = (m_next_read_chunk + 1) % m_chunks.size();
+    }
 
-        *pBuffer = m_output_buffer;
-        *pSize = m_output_size;
+    void WaitForPendingChunks()
+    {
+        std::unique_lock lock(m_load_mutex);
+        m_chunk_finished.wait(lock,
+                              [this]
+                              {
+                                  return !m_is_scheduled;
+                              });
     }
 };
 
@@ -125,20 +228,24 @@ class ProcessorXChunks::ProcessorXChunksImpl
 {
     ProcessorXChunks* m_base;
 
-    std::vector<std::unique_ptr<DBLoadStream>> m_streams;
     size_t m_chunk_size;
     size_t m_vanilla_buffer_size;
+    unsigned m_prefetch_chunk_count;
     std::vector<std::unique_ptr<IXChunkProcessor>> m_chunk_processors;
 
+    // Declared after the chunk processors so that the worker threads are joined before the processors are destroyed
+    ThreadPool m_thread_pool;
+    std::vector<std::unique_ptr<DBLoadStream>> m_streams;
+
     bool m_initialized_streams;
-    unsigned int m_current_stream;
+    size_t m_current_chunk_index;
     const uint8_t* m_current_chunk;
     size_t m_current_chunk_size;
     size_t m_current_chunk_offset;
     size_t m_vanilla_buffer_offset;
 
     bool m_eof_reached;
-    unsigned int m_eof_stream;
+    size_t m_loaded_chunk_count;
 
     void AdvanceStream(const unsigned int streamNum)
     {
@@ -164,7 +271,6 @@ class ProcessorXChunks::ProcessorXChunksImpl
         if (readSize == 0)
         {
             m_eof_reached = true;
-            m_eof_stream = streamNum;
             return;
         }
 
@@ -174,7 +280,17 @@ class ProcessorXChunks::ProcessorXChunksImpl
         }
 
         const auto& stream = m_streams[streamNum];
-        const size_t loadedChunkSize = m_base->m_base_stream->Load(stream->GetInputBuffer(), chunkSize);
+
+        // Memory backed base streams can hand out the chunk directly which saves copying it into the input buffer
+        const uint8_t* chunkData = stream->GetInputBuffer();
+        size_t loadedChunkSize;
+        if (const auto directChunkData = m_base->m_base_stream->LoadSpan(chunkSize); !directChunkData.empty())
+        {
+            chunkData = directChunkData.data();
+            loadedChunkSize = directChunkData.size();
+        }
+        else
+            loadedChunkSize = m_base->m_base_stream->Load(stream->GetInputBuffer(), chunkSize);
 
         if (loadedChunkSize != chunkSize)
         {
@@ -186,16 +302,30 @@ class ProcessorXChunks::ProcessorXChunksImpl
             m_vanilla_buffer_offset = (m_vanilla_buffer_offset + loadedChunkSize) % m_vanilla_buffer_size;
         }
 
-        stream->StartLoading(loadedChunkSize);
+        stream->StartLoading(chunkData, loadedChunkSize);
+        m_loaded_chunk_count++;
+    }
+
+    unsigned int CurrentStream() const
+    {
+        return static_cast<unsigned int>(m_current_chunk_index % m_streams.size());
     }
 
     void NextStream()
     {
-        AdvanceStream(m_current_stream);
+        const auto currentStream = CurrentStream();
+
+        // The consumed chunk frees up its slot which is refilled with the next chunk of the same stream
+        m_streams[currentStream]->ReleaseOutput();
+        AdvanceStream(currentStream);
 
-        m_current_stream = (m_current_stream + 1) % m_streams.size();
+        m_current_chunk_index++;
         m_current_chunk_offset = 0;
-        m_streams[m_current_stream]->GetOutput(&m_current_chunk, &m_current_chunk_size);
+        m_current_chunk = nullptr;
+        m_current_chunk_size = 0;
+
+        if (!EndOfStream())
+            m_streams[CurrentStream()]->GetOutput(&m_current_chunk, &m_current_chunk_size);
     }
 
     void InitStreams()
@@ -203,59 +333,81 @@ class ProcessorXChunks::ProcessorXChunksImpl
         m_initialized_streams = true;
         m_vanilla_buffer_offset = static_cast<size_t>(m_base->m_base_stream->Pos());
 
-        const unsigned int streamCount = m_streams.size();
-        for (unsigned int streamNum = 0; streamNum < streamCount; streamNum++)
+        const auto streamCount = static_cast<unsigned int>(m_streams.size());
+        for (auto chunkNum = 0u; chunkNum < m_prefetch_chunk_count; chunkNum++)
         {
-            AdvanceStream(streamNum);
+            for (unsigned int streamNum = 0; streamNum < streamCount; streamNum++)
+            {
+                AdvanceStream(streamNum);
+            }
         }
 
-        m_current_stream = 0;
+        m_current_chunk_index = 0;
         m_current_chunk_offset = 0;
-        m_streams[0]->GetOutput(&m_current_chunk, &m_current_chunk_size);
+
+        if (!EndOfStream())
+            m_streams[0]->GetOutput(&m_current_chunk, &m_current_chunk_size);
     }
 
     bool EndOfStream() const
     {
-        return m_eof_reached && m_eof_stream == m_current_stream;
+        return m_eof_reached && m_current_chunk_index >= m_loaded_chunk_count;
     }
 
 public:
-    ProcessorXChunksImpl(ProcessorXChunks* base, const int numStreams, const size_t xChunkSize)
+    ProcessorXChunksImpl(ProcessorXChunks* base, const int numStreams, const size_t xChunkSize, const unsigned prefetchChunkCount)
+        : m_thread_pool(std::min(static_cast<unsigned>(numStreams), ThreadPool::DefaultThreadCount()))
     {
         assert(base != nullptr);
         assert(numStreams > 0);
         assert(xChunkSize > 0);
+        assert(prefetchChunkCount > 0);
 
         m_base = base;
+        m_prefetch_chunk_count = prefetchChunkCount;
 
         for (int streamIndex = 0; streamIndex < numStreams; streamIndex++)
         {
-            m_streams.emplace_back(std::make_unique<DBLoadStream>(streamIndex, xChunkSize, m_chunk_processors));
+            m_streams.emplace_back(std::make_unique<DBLoadStream>(streamIndex, xChunkSize, prefetchChunkCount, m_chunk_processors, m_thread_pool));
         }
 
         m_chunk_size = xChunkSize;
         m_vanilla_buffer_size = 0;
 
         m_initialized_streams = false;
-        m_current_stream = 0;
+        m_current_chunk_index = 0;
         m_current_chunk = nullptr;
         m_current_chunk_size = 0;
         m_current_chunk_offset = 0;
         m_vanilla_buffer_offset = 0;
 
         m_eof_reached = false;
-        m_eof_stream = 0;
+        m_loaded_chunk_count = 0;
     }
 
-    ProcessorXChunksImpl(ProcessorXChunks* base, const int numStreams, const size_t xChunkSize, const size_t vanillaBufferSize)
-        : ProcessorXChunksImpl(base, numStreams, xChunkSize)
+    ProcessorXChunksImpl(
+        ProcessorXChunks* base, const int numStreams, const size_t xChunkSize, const size_t vanillaBufferSize, const unsigned prefetchChunkCount)
+        : ProcessorXChunksImpl(base, numStreams, xChunkSize, prefetchChunkCount)
     {
         m_vanilla_buffer_size = vanillaBufferSize;
     }
 
+    ~ProcessorXChunksImpl()
+    {
+        // Chunks that are still being processed reference stream buffers, so wait for them before anything is freed
+        for (const auto& stream : m_streams)
+            stream->WaitForPendingChunks();
+    }
+
+    ProcessorXChunksImpl(const ProcessorXChunksImpl& other) = delete;
+    ProcessorXChunksImpl(ProcessorXChunksImpl&& other) noexcept = delete;
+    ProcessorXChunksImpl& operator=(const ProcessorXChunksImpl& other) = delete;
+    ProcessorXChunksImpl& operator=(ProcessorXChunksImpl&& other) noexcept = delete;
+
     void AddChunkProcessor(std::unique_ptr<IXChunkProcessor> streamProcessor)
     {
         assert(streamProcessor != nullptr);
+        assert(!m_initialized_streams);
 
         m_chunk_processors.emplace_back(std::move(streamProcessor));
     }
@@ -300,6 +452,42 @@ public:
         return loadedSize;
     }
 
+    size_t LoadNullTerminated(void* buffer, const size_t maxLength)
+    {
+        assert(buffer != nullptr);
+
+        if (!m_initialized_streams)
+        {
+            InitStreams();
+        }
+
+        size_t loadedSize = 0;
+        while (!EndOfStream() && loadedSize < maxLength)
+        {
+            auto* bufferPos = static_cast<uint8_t*>(buffer) + loadedSize;
+            const auto* chunkPos = &m_current_chunk[m_current_chunk_offset];
+            const size_t bytesLeftInCurrentChunk = m_current_chunk_size - m_current_chunk_offset;
+            const size_t sizeToScan = std::min(maxLength - loadedSize, bytesLeftInCurrentChunk);
+
+            const auto* terminator = static_cast<const uint8_t*>(memchr(chunkPos, 0, sizeToScan));
+            const size_t sizeToCopy = terminator != nullptr ? static_cast<size_t>(terminator - chunkPos) + 1u : sizeToScan;
+
+            memcpy(bufferPos, chunkPos, sizeToCopy);
+            loadedSize += sizeToCopy;
+            m_current_chunk_offset += sizeToCopy;
+
+            if (m_current_chunk_offset == m_current_chunk_size)
+            {
+                NextStream();
+            }
+
+            if (terminator != nullptr)
+                break;
+        }
+
+        return loadedSize;
+    }
+
     int64_t Pos() const
     {
         return m_base->m_base_stream->Pos();
@@ -308,12 +496,17 @@ public:
 
 ProcessorXChunks::ProcessorXChunks(const int numStreams, const size_t xChunkSize)
 {
-    m_impl = new ProcessorXChunksImpl(this, numStreams, xChunkSize);
+    m_impl = new ProcessorXChunksImpl(this, numStreams, xChunkSize, DEFAULT_PREFETCH_CHUNK_COUNT);
 }
 
 ProcessorXChunks::ProcessorXChunks(const int numStreams, const size_t xChunkSize, const size_t vanillaBufferSize)
 {
-    m_impl = new ProcessorXChunksImpl(this, numStreams, xChunkSize, vanillaBufferSize);
+    m_impl = new ProcessorXChunksImpl(this, numStreams, xChunkSize, vanillaBufferSize, DEFAULT_PREFETCH_CHUNK_COUNT);
+}
+
+ProcessorXChunks::ProcessorXChunks(const int numStreams, const size_t xChunkSize, const size_t vanillaBufferSize, const unsigned prefetchChunkCount)
+{
+    m_impl = new ProcessorXChunksImpl(this, numStreams, xChunkSize, vanillaBufferSize, prefetchChunkCount);
 }
 
 ProcessorXChunks::~ProcessorXChunks()
@@ -332,6 +525,11 @@ size_t ProcessorXChunks::Load(void* buffer, const size_t length)
     return m_impl->Load(buffer, length);
 }
 
+size_t ProcessorXChunks::LoadNullTerminated(void* buffer, const size_t maxLength)
+{
+    return m_impl->LoadNullTerminated(buffer, maxLength);
+}
+
 int64_t ProcessorXChunks::Pos()
 {
     return m_impl->Pos();
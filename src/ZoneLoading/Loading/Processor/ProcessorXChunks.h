@@ -10,11 +10,19 @@ class ProcessorXChunks : public StreamProcessor
     ProcessorXChunksImpl* m_impl;
 
 public:
+    static constexpr unsigned DEFAULT_PREFETCH_CHUNK_COUNT = 1;
+
     ProcessorXChunks(int numStreams, size_t xChunkSize);
     ProcessorXChunks(int numStreams, size_t xChunkSize, size_t vanillaBufferSize);
+
+    /**
+     * \param prefetchChunkCount The amount of chunks per stream that can be read and processed ahead of time, including the one currently being consumed.
+     */
+    ProcessorXChunks(int numStreams, size_t xChunkSize, size_t vanillaBufferSize, unsigned prefetchChunkCount);
     ~ProcessorXChunks() override;
 
     size_t Load(void* buffer, size_t length) override;
+    size_t LoadNullTerminated(void* buffer, size_t maxLength) override;
     int64_t Pos() override;
 
     void AddChunkProcessor(std::unique_ptr<IXChunkProcessor> chunkProcessor) const;
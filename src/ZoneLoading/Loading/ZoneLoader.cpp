@@ -26,6 +26,13 @@ ILoadingStream* ZoneLoader::BuildLoadingChain(ILoadingStream* rootStream)
     return currentStream;
 }
 
+void ZoneLoader::ReleaseLoadingChain()
+{
+    // Processors may still be loading from their base stream until they are destroyed, so the chain is released from its end
+    while (!m_processors.empty())
+        m_processors.pop_back();
+}
+
 void ZoneLoader::AddXBlock(std::unique_ptr<XBlock> block)
 {
     m_blocks.push_back(block.get());
@@ -66,7 +73,12 @@ void ZoneLoader::RemoveStreamProcessor(StreamProcessor* streamProcessor)
 std::unique_ptr<Zone> ZoneLoader::LoadZone(std::istream& stream)
 {
     LoadingFileStream fileStream(stream);
-    auto* endStream = BuildLoadingChain(&fileStream);
+    return LoadZone(fileStream);
+}
+
+std::unique_ptr<Zone> ZoneLoader::LoadZone(ILoadingStream& rootStream)
+{
+    auto* endStream = BuildLoadingChain(&rootStream);
 
     try
     {
@@ -76,7 +88,7 @@ std::unique_ptr<Zone> ZoneLoader::LoadZone(std::istream& stream)
 
             if (m_processor_chain_dirty)
             {
-                endStream = BuildLoadingChain(&fileStream);
+                endStream = BuildLoadingChain(&rootStream);
             }
         }
     }
@@ -85,8 +97,16 @@ std::unique_ptr<Zone> ZoneLoader::LoadZone(std::istream& stream)
         const auto detailedMessage = e.DetailedMessage();
         printf("Loading fastfile failed: %s\n", detailedMessage.c_str());
 
+        ReleaseLoadingChain();
         return nullptr;
     }
+    catch (...)
+    {
+        ReleaseLoadingChain();
+        throw;
+    }
+
+    ReleaseLoadingChain();
 
     m_zone->Register();
 
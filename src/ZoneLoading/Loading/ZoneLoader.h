@@ -21,6 +21,7 @@ class ZoneLoader
     std::unique_ptr<Zone> m_zone;
 
     ILoadingStream* BuildLoadingChain(ILoadingStream* rootStream);
+    void ReleaseLoadingChain();
 
 public:
     std::vector<XBlock*> m_blocks;
@@ -34,4 +35,5 @@ public:
     void RemoveStreamProcessor(StreamProcessor* streamProcessor);
 
     std::unique_ptr<Zone> LoadZone(std::istream& stream);
+    std::unique_ptr<Zone> LoadZone(ILoadingStream& rootStream);
 };
@@ -4,6 +4,7 @@
 #include "Loading/Exception/InvalidOffsetBlockException.h"
 #include "Loading/Exception/InvalidOffsetBlockOffsetException.h"
 #include "Loading/Exception/OutOfBlockBoundsException.h"
+#include "Loading/Exception/UnexpectedEndOfFileException.h"
 
 #include <cassert>
 #include <cstring>
@@ -171,20 +172,18 @@ void XBlockInputStream::LoadNullTerminated(void* dst)
     // Theoretically ptr should always be at the current block offset.
     assert(dst == &block->m_buffer[m_block_offsets[block->m_index]]);
 
-    uint8_t byte;
-    size_t offset = reinterpret_cast<uint8_t*>(dst) - block->m_buffer;
-    do
+    const size_t offset = static_cast<uint8_t*>(dst) - block->m_buffer;
+    const size_t loadedSize = m_stream->LoadNullTerminated(dst, block->m_buffer_size - offset);
+
+    if (loadedSize == 0 || block->m_buffer[offset + loadedSize - 1] != 0)
     {
-        if (offset >= block->m_buffer_size)
-        {
+        if (offset + loadedSize >= block->m_buffer_size)
             throw BlockOverflowException(block);
-        }
 
-        m_stream->Load(&byte, 1);
-        block->m_buffer[offset++] = byte;
-    } while (byte != 0);
+        throw UnexpectedEndOfFileException();
+    }
 
-    m_block_offsets[block->m_index] = offset;
+    m_block_offsets[block->m_index] = offset + loadedSize;
 }
 
 void** XBlockInputStream::InsertPointer()
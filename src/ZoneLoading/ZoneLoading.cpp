@@ -5,8 +5,11 @@
 #include "Game/IW5/ZoneLoaderFactoryIW5.h"
 #include "Game/T5/ZoneLoaderFactoryT5.h"
 #include "Game/T6/ZoneLoaderFactoryT6.h"
+#include "Loading/LoadingMemoryStream.h"
+#include "Utils/MemoryMappedFile.h"
 #include "Utils/ObjFileStream.h"
 
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
@@ -21,43 +24,84 @@ IZoneLoaderFactory* ZoneLoaderFactories[]{
     new T6::ZoneLoaderFactory(),
 };
 
-std::unique_ptr<Zone> ZoneLoading::LoadZone(const std::string& path)
+namespace
 {
-    auto zoneName = fs::path(path).filename().replace_extension("").string();
-    std::ifstream file(path, std::fstream::in | std::fstream::binary);
-
-    if (!file.is_open())
+    ZoneLoader* CreateLoaderForHeader(ZoneHeader& header, std::string& zoneName)
     {
-        printf("Could not open file '%s'.\n", path.c_str());
-        return nullptr;
-    }
+        for (auto* factory : ZoneLoaderFactories)
+        {
+            auto* zoneLoader = factory->CreateLoaderForHeader(header, zoneName);
 
-    ZoneHeader header{};
-    file.read(reinterpret_cast<char*>(&header), sizeof(header));
-    if (file.gcount() != sizeof(header))
-    {
-        std::cout << "Failed to read zone header from file '" << path << "'.\n";
+            if (zoneLoader != nullptr)
+                return zoneLoader;
+        }
+
+        printf("Could not create factory for zone '%s'.\n", zoneName.c_str());
         return nullptr;
     }
 
-    ZoneLoader* zoneLoader = nullptr;
-    for (auto* factory : ZoneLoaderFactories)
+    std::unique_ptr<Zone> LoadMemoryMappedZone(const MemoryMappedFile& mappedFile, const std::string& path, std::string& zoneName)
     {
-        zoneLoader = factory->CreateLoaderForHeader(header, zoneName);
+        ZoneHeader header{};
+        if (mappedFile.Size() < sizeof(header))
+        {
+            std::cout << "Failed to read zone header from file '" << path << "'.\n";
+            return nullptr;
+        }
+
+        memcpy(&header, mappedFile.Data(), sizeof(header));
+
+        auto* zoneLoader = CreateLoaderForHeader(header, zoneName);
+        if (zoneLoader == nullptr)
+            return nullptr;
+
+        // The loader is destroyed before the mapping since its processors may still reference mapped data
+        LoadingMemoryStream stream(mappedFile.Data(), mappedFile.Size(), sizeof(header));
+        auto loadedZone = zoneLoader->LoadZone(stream);
+        delete zoneLoader;
 
-        if (zoneLoader != nullptr)
-            break;
+        return loadedZone;
     }
 
-    if (zoneLoader == nullptr)
+    std::unique_ptr<Zone> LoadFileStreamZone(const std::string& path, std::string& zoneName)
     {
-        printf("Could not create factory for zone '%s'.\n", zoneName.c_str());
-        return nullptr;
+        std::ifstream file(path, std::fstream::in | std::fstream::binary);
+
+        if (!file.is_open())
+        {
+            printf("Could not open file '%s'.\n", path.c_str());
+            return nullptr;
+        }
+
+        ZoneHeader header{};
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        if (file.gcount() != sizeof(header))
+        {
+            std::cout << "Failed to read zone header from file '" << path << "'.\n";
+            return nullptr;
+        }
+
+        auto* zoneLoader = CreateLoaderForHeader(header, zoneName);
+        if (zoneLoader == nullptr)
+            return nullptr;
+
+        auto loadedZone = zoneLoader->LoadZone(file);
+        delete zoneLoader;
+
+        file.close();
+        return loadedZone;
     }
+} // namespace
+
+std::unique_ptr<Zone> ZoneLoading::LoadZone(const std::string& path)
+{
+    auto zoneName = fs::path(path).filename().replace_extension("").string();
 
-    auto loadedZone = zoneLoader->LoadZone(file);
-    delete zoneLoader;
+    // Mapping the file avoids copying all of its data through a stream buffer.
+    // Fall back to reading the file as a stream on systems or files that cannot be mapped.
+    MemoryMappedFile mappedFile;
+    if (mappedFile.Open(path))
+        return LoadMemoryMappedZone(mappedFile, path, zoneName);
 
-    file.close();
-    return std::move(loadedZone);
+    return LoadFileStreamZone(path, zoneName);
 }
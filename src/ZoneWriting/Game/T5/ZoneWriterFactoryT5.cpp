@@ -11,6 +11,7 @@
 #include "Writing/Steps/StepWriteZoneContentToMemory.h"
 #include "Writing/Steps/StepWriteZoneHeader.h"
 #include "Writing/Steps/StepWriteZoneSizes.h"
+#include "ZoneWriting.h"
 
 #include <cstring>
 
@@ -64,7 +65,10 @@ public:
         // Write zone header
         m_writer->AddWritingStep(std::make_unique<StepWriteZoneHeader>(CreateHeaderForParams()));
 
-        m_writer->AddWritingStep(std::make_unique<StepAddOutputProcessor>(std::make_unique<OutputProcessorDeflate>()));
+        auto deflateProcessor = std::make_unique<OutputProcessorDeflate>();
+        if (ZoneWriting::Configuration.CompressionLevel)
+            deflateProcessor->SetCompressionLevel(*ZoneWriting::Configuration.CompressionLevel);
+        m_writer->AddWritingStep(std::make_unique<StepAddOutputProcessor>(std::move(deflateProcessor)));
 
         // Start of the XFile struct
         m_writer->AddWritingStep(std::make_unique<StepWriteZoneSizes>(contentInMemoryPtr));
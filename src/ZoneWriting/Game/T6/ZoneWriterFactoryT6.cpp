@@ -17,6 +17,7 @@
 #include "Writing/Steps/StepWriteZoneSizes.h"
 #include "Zone/XChunk/XChunkProcessorDeflate.h"
 #include "Zone/XChunk/XChunkProcessorSalsa20Encryption.h"
+#include "ZoneWriting.h"
 
 #include <cassert>
 #include <cstring>
@@ -78,11 +79,15 @@ public:
     {
         auto xChunkProcessor = std::make_unique<OutputProcessorXChunks>(
             ZoneConstants::STREAM_COUNT, ZoneConstants::XCHUNK_SIZE, ZoneConstants::XCHUNK_MAX_WRITE_SIZE, ZoneConstants::VANILLA_BUFFER_SIZE);
+        xChunkProcessor->EnableParallelProcessing();
         if (xChunkProcessorPtr)
             *xChunkProcessorPtr = xChunkProcessor.get();
 
         // Decompress the chunks using zlib
-        xChunkProcessor->AddChunkProcessor(std::make_unique<XChunkProcessorDeflate>());
+        if (ZoneWriting::Configuration.CompressionLevel)
+            xChunkProcessor->AddChunkProcessor(std::make_unique<XChunkProcessorDeflate>(*ZoneWriting::Configuration.CompressionLevel));
+        else
+            xChunkProcessor->AddChunkProcessor(std::make_unique<XChunkProcessorDeflate>());
 
         if (isEncrypted)
         {
@@ -1,25 +1,218 @@
 #include "OutputProcessorDeflate.h"
 
 #include "Utils/ClassUtils.h"
+#include "Utils/ThreadPool.h"
 #include "Writing/WritingException.h"
 
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
 #include <cstdint>
+#include <deque>
+#include <future>
 #include <memory>
 #include <stdexcept>
+#include <vector>
 #include <zlib.h>
+#include <zutil.h>
 
 class OutputProcessorDeflate::Impl
 {
+    class Block
+    {
+    public:
+        std::vector<uint8_t> m_dictionary;
+        std::vector<uint8_t> m_input;
+        std::vector<uint8_t> m_output;
+        uLong m_adler;
+        bool m_last;
+        std::future<void> m_compression;
+
+        Block()
+            : m_adler(0),
+              m_last(false)
+        {
+        }
+    };
+
+    static constexpr size_t PARALLEL_BLOCK_SIZE = 0x20000;
+    static constexpr size_t DICTIONARY_SIZE = 0x8000;
+
     z_stream m_stream{};
     OutputProcessorDeflate* m_base;
 
     std::unique_ptr<uint8_t[]> m_buffer;
     size_t m_buffer_size;
 
+    int m_compression_level;
+    bool m_has_written;
+
+    std::unique_ptr<Block> m_current_block;
+    std::deque<std::unique_ptr<Block>> m_blocks_in_flight;
+    uLong m_adler;
+    ThreadPool* m_thread_pool;
+    std::unique_ptr<ThreadPool> m_owned_thread_pool;
+
+    void CompressBlock(Block& block) const
+    {
+        z_stream stream{};
+        stream.zalloc = Z_NULL;
+        stream.zfree = Z_NULL;
+        stream.opaque = Z_NULL;
+
+        // Blocks are deflated raw since they are joined into one zlib stream with a single header and trailer
+        if (deflateInit2(&stream, m_compression_level, Z_DEFLATED, -DEF_WBITS, DEF_MEM_LEVEL, Z_DEFAULT_STRATEGY) != Z_OK)
+            throw WritingException("Initializing deflate failed.");
+
+        if (!block.m_dictionary.empty())
+            deflateSetDictionary(&stream, block.m_dictionary.data(), static_cast<uInt>(block.m_dictionary.size()));
+
+        // Blocks that are not the last one end with a sync flush to align them to whole bytes, so they can be concatenated
+        const auto flush = block.m_last ? Z_FINISH : Z_SYNC_FLUSH;
+        block.m_output.resize(deflateBound(&stream, static_cast<uLong>(block.m_input.size())) + 16u);
+
+        stream.next_in = block.m_input.data();
+        stream.avail_in = static_cast<uInt>(block.m_input.size());
+        stream.next_out = block.m_output.data();
+        stream.avail_out = static_cast<uInt>(block.m_output.size());
+
+        const auto ret = deflate(&stream, flush);
+        const auto outputSize = block.m_output.size() - stream.avail_out;
+        const auto isComplete = block.m_last ? ret == Z_STREAM_END : ret == Z_OK && stream.avail_in == 0 && stream.avail_out > 0;
+        deflateEnd(&stream);
+
+        if (!isComplete)
+            throw WritingException("Failed to deflate memory of zone.");
+
+        block.m_output.resize(outputSize);
+        block.m_adler = adler32(adler32(0L, Z_NULL, 0), block.m_input.data(), static_cast<uInt>(block.m_input.size()));
+    }
+
+    void WriteZlibHeader() const
+    {
+        // Same header that zlib writes for a 32K window and the configured level
+        const auto level = m_compression_level == Z_DEFAULT_COMPRESSION ? 6 : m_compression_level;
+        unsigned levelFlags;
+        if (level < 2)
+            levelFlags = 0;
+        else if (level < 6)
+            levelFlags = 1;
+        else if (level == 6)
+            levelFlags = 2;
+        else
+            levelFlags = 3;
+
+        auto header = static_cast<unsigned>((Z_DEFLATED + ((DEF_WBITS - 8) << 4)) << 8);
+        header |= levelFlags << 6;
+        header += 31 - header % 31;
+
+        const uint8_t headerBytes[]{static_cast<uint8_t>(header >> 8), static_cast<uint8_t>(header)};
+        m_base->m_base_stream->Write(headerBytes, sizeof(headerBytes));
+    }
+
+    void WriteZlibTrailer() const
+    {
+        const uint8_t trailerBytes[]{
+            static_cast<uint8_t>(m_adler >> 24),
+            static_cast<uint8_t>(m_adler >> 16),
+            static_cast<uint8_t>(m_adler >> 8),
+            static_cast<uint8_t>(m_adler),
+        };
+        m_base->m_base_stream->Write(trailerBytes, sizeof(trailerBytes));
+    }
+
+    void FinishOldestBlock()
+    {
+        assert(!m_blocks_in_flight.empty());
+
+        const auto block = std::move(m_blocks_in_flight.front());
+        m_blocks_in_flight.pop_front();
+
+        // Rethrows any exception that occurred while compressing
+        block->m_compression.get();
+
+        if (!block->m_output.empty())
+            m_base->m_base_stream->Write(block->m_output.data(), block->m_output.size());
+
+        m_adler = adler32_combine(m_adler, block->m_adler, static_cast<z_off_t>(block->m_input.size()));
+    }
+
+    void SubmitCurrentBlock(const bool isLast)
+    {
+        auto block = std::move(m_current_block);
+        block->m_last = isLast;
+
+        if (!isLast)
+        {
+            m_current_block = std::make_unique<Block>();
+            m_current_block->m_input.reserve(PARALLEL_BLOCK_SIZE);
+
+            const auto dictionarySize = std::min(DICTIONARY_SIZE, block->m_input.size());
+            m_current_block->m_dictionary.assign(block->m_input.end() - static_cast<ptrdiff_t>(dictionarySize), block->m_input.end());
+        }
+
+        auto task = std::make_shared<std::packaged_task<void()>>(
+            [this, blockPtr = block.get()]
+            {
+                CompressBlock(*blockPtr);
+            });
+        block->m_compression = task->get_future();
+        m_thread_pool->Enqueue(
+            [task]
+            {
+                (*task)();
+            });
+
+        m_blocks_in_flight.emplace_back(std::move(block));
+
+        // Limits the memory of blocks that are compressed but not yet written
+        while (m_blocks_in_flight.size() > m_thread_pool->GetThreadCount() * 2u)
+            FinishOldestBlock();
+    }
+
+    void WriteParallel(const uint8_t* buffer, const size_t length)
+    {
+        if (!m_has_written)
+            WriteZlibHeader();
+
+        auto sizeRemaining = length;
+        while (sizeRemaining > 0)
+        {
+            auto& input = m_current_block->m_input;
+            const auto toWrite = std::min(PARALLEL_BLOCK_SIZE - input.size(), sizeRemaining);
+
+            input.insert(input.end(), &buffer[length - sizeRemaining], &buffer[length - sizeRemaining + toWrite]);
+            if (input.size() >= PARALLEL_BLOCK_SIZE)
+                SubmitCurrentBlock(false);
+
+            sizeRemaining -= toWrite;
+        }
+    }
+
+    void FlushParallel()
+    {
+        if (!m_current_block)
+            return;
+
+        if (!m_has_written)
+            WriteZlibHeader();
+        m_has_written = true;
+
+        SubmitCurrentBlock(true);
+        while (!m_blocks_in_flight.empty())
+            FinishOldestBlock();
+
+        WriteZlibTrailer();
+    }
+
 public:
     Impl(OutputProcessorDeflate* baseClass, const size_t bufferSize)
         : m_buffer(std::make_unique<uint8_t[]>(bufferSize)),
-          m_buffer_size(bufferSize)
+          m_buffer_size(bufferSize),
+          m_compression_level(Z_DEFAULT_COMPRESSION),
+          m_has_written(false),
+          m_adler(adler32(0L, Z_NULL, 0)),
+          m_thread_pool(nullptr)
     {
         m_base = baseClass;
 
@@ -41,6 +234,13 @@ public:
 
     ~Impl()
     {
+        // Blocks that are still in flight are referenced by their compression tasks
+        for (const auto& block : m_blocks_in_flight)
+        {
+            if (block->m_compression.valid())
+                block->m_compression.wait();
+        }
+
         deflateEnd(&m_stream);
     }
 
@@ -49,8 +249,44 @@ public:
     Impl& operator=(const Impl& other) = delete;
     Impl& operator=(Impl&& other) noexcept = default;
 
+    void SetCompressionLevel(const int compressionLevel)
+    {
+        assert(!m_has_written);
+        assert(compressionLevel >= Z_NO_COMPRESSION && compressionLevel <= Z_BEST_COMPRESSION);
+
+        m_compression_level = compressionLevel;
+        if (deflateParams(&m_stream, m_compression_level, Z_DEFAULT_STRATEGY) != Z_OK)
+            throw std::runtime_error("Setting deflate compression level failed");
+    }
+
+    void EnableParallelCompression(ThreadPool* threadPool)
+    {
+        assert(!m_has_written);
+
+        if (m_thread_pool)
+            return;
+
+        if (threadPool == nullptr)
+        {
+            m_owned_thread_pool = std::make_unique<ThreadPool>(ThreadPool::DefaultThreadCount());
+            threadPool = m_owned_thread_pool.get();
+        }
+
+        m_thread_pool = threadPool;
+        m_current_block = std::make_unique<Block>();
+        m_current_block->m_input.reserve(PARALLEL_BLOCK_SIZE);
+    }
+
     void Write(const void* buffer, const size_t length)
     {
+        if (m_thread_pool)
+        {
+            WriteParallel(static_cast<const uint8_t*>(buffer), length);
+            m_has_written = true;
+            return;
+        }
+
+        m_has_written = true;
         m_stream.next_in = static_cast<const Bytef*>(buffer);
         m_stream.avail_in = length;
 
@@ -71,6 +307,12 @@ public:
 
     void Flush()
     {
+        if (m_thread_pool)
+        {
+            FlushParallel();
+            return;
+        }
+
         m_stream.avail_in = 0;
         m_stream.next_in = Z_NULL;
         while (true)
@@ -122,6 +364,16 @@ OutputProcessorDeflate::~OutputProcessorDeflate()
     m_impl = nullptr;
 }
 
+void OutputProcessorDeflate::SetCompressionLevel(const int compressionLevel)
+{
+    m_impl->SetCompressionLevel(compressionLevel);
+}
+
+void OutputProcessorDeflate::EnableParallelCompression(ThreadPool* threadPool)
+{
+    m_impl->EnableParallelCompression(threadPool);
+}
+
 void OutputProcessorDeflate::Write(const void* buffer, const size_t length)
 {
     m_impl->Write(buffer, length);
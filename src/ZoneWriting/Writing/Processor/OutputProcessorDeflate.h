@@ -1,4 +1,5 @@
 #pragma once
+#include "Utils/ThreadPool.h"
 #include "Writing/OutputStreamProcessor.h"
 
 #include <cstddef>
@@ -20,6 +21,19 @@ public:
     OutputProcessorDeflate& operator=(const OutputProcessorDeflate& other) = delete;
     OutputProcessorDeflate& operator=(OutputProcessorDeflate&& other) noexcept = default;
 
+    /**
+     * \brief Sets the zlib compression level from 0 to 9. Must be called before any data is written.
+     */
+    void SetCompressionLevel(int compressionLevel);
+
+    /**
+     * \brief Splits the data into blocks that are deflated on worker threads and joined into a single zlib stream.
+     * Every block uses the end of the previous block as dictionary, so the result is only slightly larger than deflating serially.
+     * Must be called before any data is written.
+     * \param threadPool The thread pool to deflate the blocks on. If not specified, the processor creates its own one.
+     */
+    void EnableParallelCompression(ThreadPool* threadPool = nullptr);
+
     void Write(const void* buffer, size_t length) override;
     void Flush() override;
     int64_t Pos() override;
@@ -4,8 +4,20 @@
 #include "Zone/XChunk/XChunkException.h"
 #include "Zone/ZoneTypes.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <utility>
+
+OutputProcessorXChunks::ChunkSlot::ChunkSlot(const size_t chunkSize)
+{
+    for (auto& buffer : m_buffers)
+        buffer = std::make_unique<uint8_t[]>(chunkSize);
+
+    m_input_buffer = m_buffers[0].get();
+    m_output_buffer = m_buffers[1].get();
+    m_input_size = 0;
+}
 
 void OutputProcessorXChunks::Init()
 {
@@ -15,45 +27,92 @@ void OutputProcessorXChunks::Init()
     m_initialized = true;
 }
 
-void OutputProcessorXChunks::WriteChunk()
+OutputProcessorXChunks::ChunkSlot& OutputProcessorXChunks::CurrentSlot()
 {
-    if (m_vanilla_buffer_size > 0)
-    {
-        if (m_vanilla_buffer_offset + sizeof(xchunk_size_t) > m_vanilla_buffer_size)
-        {
-            xchunk_size_t zeroMem = 0;
-            m_base_stream->Write(&zeroMem, m_vanilla_buffer_size - m_vanilla_buffer_offset);
-            m_vanilla_buffer_offset = 0;
-        }
-    }
+    return m_slots[static_cast<size_t>(m_current_stream) % m_slots.size()];
+}
 
+void OutputProcessorXChunks::ProcessChunk(ChunkSlot& slot, const int streamNumber) const
+{
     try
     {
         for (const auto& processor : m_chunk_processors)
         {
-            m_input_size = processor->Process(m_current_stream, m_input_buffer, m_input_size, m_output_buffer, m_chunk_size);
-            auto* swap = m_input_buffer;
-            m_input_buffer = m_output_buffer;
-            m_output_buffer = swap;
+            slot.m_input_size = processor->Process(streamNumber, slot.m_input_buffer, slot.m_input_size, slot.m_output_buffer, m_chunk_size);
+            std::swap(slot.m_input_buffer, slot.m_output_buffer);
         }
     }
     catch (XChunkException& e)
     {
         throw WritingException(e.Message());
     }
+}
+
+void OutputProcessorXChunks::EmitChunk(ChunkSlot& slot)
+{
+    if (m_vanilla_buffer_size > 0)
+    {
+        if (m_vanilla_buffer_offset + sizeof(xchunk_size_t) > m_vanilla_buffer_size)
+        {
+            xchunk_size_t zeroMem = 0;
+            m_base_stream->Write(&zeroMem, m_vanilla_buffer_size - m_vanilla_buffer_offset);
+            m_vanilla_buffer_offset = 0;
+        }
+    }
 
-    auto chunkSize = static_cast<xchunk_size_t>(m_input_size);
+    auto chunkSize = static_cast<xchunk_size_t>(slot.m_input_size);
     m_base_stream->Write(&chunkSize, sizeof(chunkSize));
-    m_base_stream->Write(m_input_buffer, m_input_size);
+    m_base_stream->Write(slot.m_input_buffer, slot.m_input_size);
 
     if (m_vanilla_buffer_size > 0)
     {
-        m_vanilla_buffer_offset += sizeof(chunkSize) + m_input_size;
+        m_vanilla_buffer_offset += sizeof(chunkSize) + slot.m_input_size;
         m_vanilla_buffer_offset %= m_vanilla_buffer_size;
     }
 
+    slot.m_input_size = 0;
+}
+
+void OutputProcessorXChunks::FinishChunk(ChunkSlot& slot)
+{
+    if (!slot.m_processing.valid())
+        return;
+
+    // Rethrows any exception that occurred while processing
+    slot.m_processing.get();
+    EmitChunk(slot);
+}
+
+void OutputProcessorXChunks::WriteChunk()
+{
+    auto& slot = CurrentSlot();
+
+    if (m_thread_pool)
+    {
+        // Chunks of the same stream are never in flight at the same time,
+        // so stateful processors like Salsa20 see the chunks of a stream in order
+        auto task = std::make_shared<std::packaged_task<void()>>(
+            [this, &slot, streamNumber = m_current_stream]
+            {
+                ProcessChunk(slot, streamNumber);
+            });
+        slot.m_processing = task->get_future();
+        m_thread_pool->Enqueue(
+            [task]
+            {
+                (*task)();
+            });
+    }
+    else
+    {
+        ProcessChunk(slot, m_current_stream);
+        EmitChunk(slot);
+    }
+
     m_current_stream = (m_current_stream + 1) % m_stream_count;
-    m_input_size = 0;
+
+    // The next slot holds the oldest chunk that is still in flight which has to be written before the slot can be reused
+    FinishChunk(CurrentSlot());
 }
 
 OutputProcessorXChunks::OutputProcessorXChunks(const int numStreams, const size_t xChunkSize, const size_t xChunkWriteSize)
@@ -63,20 +122,13 @@ OutputProcessorXChunks::OutputProcessorXChunks(const int numStreams, const size_
       m_vanilla_buffer_size(0),
       m_initialized(false),
       m_current_stream(0),
-      m_vanilla_buffer_offset(0),
-      m_input_buffer(nullptr),
-      m_output_buffer(nullptr),
-      m_input_size(0)
+      m_vanilla_buffer_offset(0)
 {
     assert(numStreams > 0);
     assert(xChunkSize > 0);
     assert(m_chunk_size >= m_chunk_write_size);
 
-    for (auto i = 0u; i < 2u; i++)
-        m_buffers.emplace_back(std::make_unique<uint8_t[]>(xChunkSize));
-
-    m_input_buffer = m_buffers[0].get();
-    m_output_buffer = m_buffers[1].get();
+    m_slots.emplace_back(xChunkSize);
 }
 
 OutputProcessorXChunks::OutputProcessorXChunks(const int numStreams, const size_t xChunkSize, const size_t xChunkWriteSize, const size_t vanillaBufferSize)
@@ -85,6 +137,16 @@ OutputProcessorXChunks::OutputProcessorXChunks(const int numStreams, const size_
     m_vanilla_buffer_size = vanillaBufferSize;
 }
 
+OutputProcessorXChunks::~OutputProcessorXChunks()
+{
+    // Chunks that are still in flight reference the slots and the chunk processors
+    for (const auto& slot : m_slots)
+    {
+        if (slot.m_processing.valid())
+            slot.m_processing.wait();
+    }
+}
+
 void OutputProcessorXChunks::AddChunkProcessor(std::unique_ptr<IXChunkProcessor> chunkProcessor)
 {
     assert(chunkProcessor != nullptr);
@@ -92,6 +154,19 @@ void OutputProcessorXChunks::AddChunkProcessor(std::unique_ptr<IXChunkProcessor>
     m_chunk_processors.emplace_back(std::move(chunkProcessor));
 }
 
+void OutputProcessorXChunks::EnableParallelProcessing()
+{
+    assert(!m_initialized);
+
+    if (m_thread_pool)
+        return;
+
+    m_thread_pool = std::make_unique<ThreadPool>(std::min(static_cast<unsigned>(m_stream_count), ThreadPool::DefaultThreadCount()));
+
+    while (m_slots.size() < static_cast<size_t>(m_stream_count))
+        m_slots.emplace_back(m_chunk_size);
+}
+
 void OutputProcessorXChunks::Write(const void* buffer, const size_t length)
 {
     assert(buffer != nullptr);
@@ -102,11 +177,12 @@ void OutputProcessorXChunks::Write(const void* buffer, const size_t length)
     auto sizeRemaining = length;
     while (sizeRemaining > 0)
     {
-        const auto toWrite = std::min(m_chunk_write_size - m_input_size, sizeRemaining);
+        auto& slot = CurrentSlot();
+        const auto toWrite = std::min(m_chunk_write_size - slot.m_input_size, sizeRemaining);
 
-        memcpy(&m_input_buffer[m_input_size], &static_cast<const char*>(buffer)[length - sizeRemaining], toWrite);
-        m_input_size += toWrite;
-        if (m_input_size >= m_chunk_write_size)
+        memcpy(&slot.m_input_buffer[slot.m_input_size], &static_cast<const char*>(buffer)[length - sizeRemaining], toWrite);
+        slot.m_input_size += toWrite;
+        if (slot.m_input_size >= m_chunk_write_size)
             WriteChunk();
 
         sizeRemaining -= toWrite;
@@ -115,9 +191,15 @@ void OutputProcessorXChunks::Write(const void* buffer, const size_t length)
 
 void OutputProcessorXChunks::Flush()
 {
-    if (m_input_size)
+    if (CurrentSlot().m_input_size)
         WriteChunk();
 
+    // Write all chunks that are still in flight, starting with the oldest one
+    const auto slotCount = m_slots.size();
+    const auto currentSlotIndex = static_cast<size_t>(m_current_stream) % slotCount;
+    for (auto i = 0u; i < slotCount; i++)
+        FinishChunk(m_slots[(currentSlotIndex + i) % slotCount]);
+
     m_base_stream->Flush();
 }
 
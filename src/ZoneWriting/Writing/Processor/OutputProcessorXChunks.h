@@ -1,14 +1,28 @@
 #pragma once
+#include "Utils/ThreadPool.h"
 #include "Writing/OutputStreamProcessor.h"
 #include "Zone/XChunk/IXChunkProcessor.h"
 
 #include <cstddef>
 #include <cstdint>
+#include <future>
 #include <memory>
 #include <vector>
 
 class OutputProcessorXChunks final : public OutputStreamProcessor
 {
+    class ChunkSlot
+    {
+    public:
+        std::unique_ptr<uint8_t[]> m_buffers[2];
+        uint8_t* m_input_buffer;
+        uint8_t* m_output_buffer;
+        size_t m_input_size;
+        std::future<void> m_processing;
+
+        explicit ChunkSlot(size_t chunkSize);
+    };
+
     std::vector<std::unique_ptr<IXChunkProcessor>> m_chunk_processors;
 
     int m_stream_count;
@@ -20,26 +34,36 @@ class OutputProcessorXChunks final : public OutputStreamProcessor
     int m_current_stream;
     size_t m_vanilla_buffer_offset;
 
-    std::vector<std::unique_ptr<uint8_t[]>> m_buffers;
-    uint8_t* m_input_buffer;
-    uint8_t* m_output_buffer;
-    size_t m_input_size;
+    // One slot when processing serially, otherwise one in-flight chunk per stream
+    std::vector<ChunkSlot> m_slots;
+    std::unique_ptr<ThreadPool> m_thread_pool;
 
     void Init();
+    ChunkSlot& CurrentSlot();
+    void ProcessChunk(ChunkSlot& slot, int streamNumber) const;
+    void EmitChunk(ChunkSlot& slot);
+    void FinishChunk(ChunkSlot& slot);
     void WriteChunk();
 
 public:
     OutputProcessorXChunks(int numStreams, size_t xChunkSize, size_t xChunkWriteSize);
     OutputProcessorXChunks(int numStreams, size_t xChunkSize, size_t xChunkWriteSize, size_t vanillaBufferSize);
-    ~OutputProcessorXChunks() override = default;
+    ~OutputProcessorXChunks() override;
 
     OutputProcessorXChunks(const OutputProcessorXChunks& other) = delete;
-    OutputProcessorXChunks(OutputProcessorXChunks&& other) noexcept = default;
+    OutputProcessorXChunks(OutputProcessorXChunks&& other) noexcept = delete;
     OutputProcessorXChunks& operator=(const OutputProcessorXChunks& other) = delete;
-    OutputProcessorXChunks& operator=(OutputProcessorXChunks&& other) noexcept = default;
+    OutputProcessorXChunks& operator=(OutputProcessorXChunks&& other) noexcept = delete;
 
     void AddChunkProcessor(std::unique_ptr<IXChunkProcessor> chunkProcessor);
 
+    /**
+     * \brief Runs the chunk processors of every stream on worker threads.
+     * Chunks are still written in order, so the output is identical to processing them serially.
+     * Must be called before any data is written.
+     */
+    void EnableParallelProcessing();
+
     void Write(const void* buffer, size_t length) override;
     void Flush() override;
     int64_t Pos() override;
@@ -1,7 +1,9 @@
 #include "InMemoryZoneOutputStream.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <iterator>
 
 InMemoryZoneOutputStream::InMemoryZoneOutputStream(InMemoryZoneData* zoneData, std::vector<XBlock*> blocks, const int blockBitCount, const block_t insertBlock)
     : m_zone_data(zoneData),
@@ -20,6 +22,12 @@ InMemoryZoneOutputStream::ReusableEntry::ReusableEntry(void* startPtr, const siz
 {
 }
 
+InMemoryZoneOutputStream::ReusableRange::ReusableRange(const uintptr_t end, const ReusableEntry& entry)
+    : m_end(end),
+      m_entry(entry)
+{
+}
+
 void InMemoryZoneOutputStream::PushBlock(const block_t block)
 {
     assert(block >= 0 && block < static_cast<block_t>(m_blocks.size()));
@@ -179,23 +187,28 @@ bool InMemoryZoneOutputStream::ReusableShouldWrite(void** pPtr, const size_t ent
     if (*pPtr == nullptr)
         return false;
 
-    const auto foundEntriesForType = m_reusable_entries.find(type);
-    if (foundEntriesForType == m_reusable_entries.end())
+    const auto foundRangesForType = m_reusable_ranges.find(type);
+    if (foundRangesForType == m_reusable_ranges.end())
     {
         return true;
     }
 
-    for (const auto& entry : foundEntriesForType->second)
-    {
-        if (*pPtr >= entry.m_start_ptr && *pPtr < entry.m_end_ptr)
-        {
-            assert((reinterpret_cast<uintptr_t>(*pPtr) - reinterpret_cast<uintptr_t>(entry.m_start_ptr)) % entrySize == 0);
-            *pPtr = reinterpret_cast<void*>(entry.m_start_zone_ptr + (reinterpret_cast<uintptr_t>(*pPtr) - reinterpret_cast<uintptr_t>(entry.m_start_ptr)));
-            return false;
-        }
-    }
+    const auto& ranges = foundRangesForType->second;
+    const auto ptr = reinterpret_cast<uintptr_t>(*pPtr);
+
+    // Find the last range that starts at or before the pointer
+    auto foundRange = ranges.upper_bound(ptr);
+    if (foundRange == ranges.begin())
+        return true;
+    --foundRange;
 
-    return true;
+    if (ptr >= foundRange->second.m_end)
+        return true;
+
+    const auto& entry = foundRange->second.m_entry;
+    assert((ptr - reinterpret_cast<uintptr_t>(entry.m_start_ptr)) % entrySize == 0);
+    *pPtr = reinterpret_cast<void*>(entry.m_start_zone_ptr + (ptr - reinterpret_cast<uintptr_t>(entry.m_start_ptr)));
+    return false;
 }
 
 void InMemoryZoneOutputStream::ReusableAddOffset(void* ptr, size_t size, size_t count, std::type_index type)
@@ -204,15 +217,30 @@ void InMemoryZoneOutputStream::ReusableAddOffset(void* ptr, size_t size, size_t
 
     const auto inTemp = m_block_stack.top()->m_type == XBlock::Type::BLOCK_TYPE_TEMP;
     auto zoneOffset = inTemp ? InsertPointer() : GetCurrentZonePointer();
-    const auto foundEntriesForType = m_reusable_entries.find(type);
-    if (foundEntriesForType == m_reusable_entries.end())
+    const ReusableEntry entry(ptr, size, count, zoneOffset);
+    auto& ranges = m_reusable_ranges[type];
+
+    auto rangeStart = reinterpret_cast<uintptr_t>(entry.m_start_ptr);
+    const auto entryEnd = reinterpret_cast<uintptr_t>(entry.m_end_ptr);
+
+    // Entries that were added earlier take precedence, so only the parts that are not yet covered are added
+    auto nextRange = ranges.upper_bound(rangeStart);
+    if (nextRange != ranges.begin())
     {
-        std::vector<ReusableEntry> entries;
-        entries.emplace_back(ptr, size, count, zoneOffset);
-        m_reusable_entries.emplace(std::make_pair(type, std::move(entries)));
+        const auto previousRange = std::prev(nextRange);
+        rangeStart = std::max(rangeStart, previousRange->second.m_end);
     }
-    else
+
+    while (rangeStart < entryEnd)
     {
-        foundEntriesForType->second.emplace_back(ptr, size, count, zoneOffset);
+        const auto rangeEnd = nextRange != ranges.end() ? std::min(entryEnd, nextRange->first) : entryEnd;
+        if (rangeStart < rangeEnd)
+            ranges.emplace_hint(nextRange, rangeStart, ReusableRange(rangeEnd, entry));
+
+        if (nextRange == ranges.end())
+            break;
+
+        rangeStart = nextRange->second.m_end;
+        ++nextRange;
     }
 }
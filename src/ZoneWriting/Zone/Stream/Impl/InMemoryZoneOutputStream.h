@@ -3,6 +3,7 @@
 #include "Zone/Stream/IZoneOutputStream.h"
 #include "Zone/XBlock.h"
 
+#include <map>
 #include <stack>
 #include <unordered_map>
 #include <vector>
@@ -21,6 +22,17 @@ class InMemoryZoneOutputStream final : public IZoneOutputStream
         ReusableEntry(void* startPtr, size_t entrySize, size_t entryCount, uintptr_t startZonePtr);
     };
 
+    // A part of the address range of a reusable entry that is not covered by any entry that was added before it.
+    // The ranges of a type never overlap, so a pointer can be looked up by the range with the closest start address.
+    class ReusableRange
+    {
+    public:
+        uintptr_t m_end;
+        ReusableEntry m_entry;
+
+        ReusableRange(uintptr_t end, const ReusableEntry& entry);
+    };
+
     InMemoryZoneData* m_zone_data;
     std::vector<XBlock*> m_blocks;
 
@@ -30,7 +42,7 @@ class InMemoryZoneOutputStream final : public IZoneOutputStream
     int m_block_bit_count;
     XBlock* m_insert_block;
 
-    std::unordered_map<std::type_index, std::vector<ReusableEntry>> m_reusable_entries;
+    std::unordered_map<std::type_index, std::map<uintptr_t, ReusableRange>> m_reusable_ranges;
 
     uintptr_t GetCurrentZonePointer();
     uintptr_t InsertPointer();
@@ -7,6 +7,8 @@
 #include "Game/T6/ZoneWriterFactoryT6.h"
 #include "Writing/IZoneWriterFactory.h"
 
+ZoneWriting::Configuration_t ZoneWriting::Configuration;
+
 IZoneWriterFactory* ZoneWriterFactories[]{
     new IW3::ZoneWriterFactory(),
     new IW4::ZoneWriterFactory(),
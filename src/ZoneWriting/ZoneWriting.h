@@ -1,11 +1,28 @@
 #pragma once
+#include "Utils/ThreadPool.h"
 #include "Zone/Zone.h"
 
+#include <optional>
 #include <ostream>
 #include <string>
 
 class ZoneWriting
 {
 public:
+    static class Configuration_t
+    {
+    public:
+        /**
+         * \brief The zlib compression level from 0 to 9 that zones are deflated with. Lower levels compress faster but result in larger zones.
+         * If not set, zones are deflated with the level their game uses.
+         */
+        std::optional<int> CompressionLevel;
+
+        /**
+         * \brief The thread pool that zones which are deflated in parallel share. If not set, every zone creates its own one while it is written.
+         */
+        ThreadPool* CompressionThreadPool = nullptr;
+    } Configuration;
+
     static bool WriteZone(std::ostream& stream, Zone* zone);
 };
@@ -0,0 +1,59 @@
+LinkerTests = {}
+
+function LinkerTests:include(includes)
+	if includes:handle(self:name()) then
+		includedirs {
+			path.join(TestFolder(), "LinkerTests")
+		}
+	end
+end
+
+function LinkerTests:link(links)
+	
+end
+
+function LinkerTests:use()
+	
+end
+
+function LinkerTests:name()
+    return "LinkerTests"
+end
+
+function LinkerTests:project()
+	local folder = TestFolder()
+	local includes = Includes:create()
+	local links = Links:create()
+
+	project(self:name())
+        targetdir(TargetDirectoryTest)
+		location "%{wks.location}/test/%{prj.name}"
+		kind "ConsoleApp"
+		language "C++"
+		
+		-- The Linker is an executable, so the sources under test are built into the test project
+		files {
+			path.join(folder, "LinkerTests/**.h"), 
+			path.join(folder, "LinkerTests/**.cpp"),
+			path.join(ProjectFolder(), "Linker/BuildCache/**.h"), 
+			path.join(ProjectFolder(), "Linker/BuildCache/**.cpp")
+		}
+		
+        vpaths {
+			["*"] = {
+				path.join(folder, "LinkerTests"),
+				path.join(ProjectFolder(), "Linker")
+			}
+		}
+		
+		self:include(includes)
+		Linker:include(includes)
+		Crypto:include(includes)
+		ObjLoading:include(includes)
+		catch2:include(includes)
+
+		links:linkto(Crypto)
+		links:linkto(ObjLoading)
+		links:linkto(catch2)
+		links:linkall()
+end
@@ -0,0 +1,197 @@
+#include "BuildCache/BuildManifest.h"
+#include "SearchPath/SearchPathFilesystem.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace fs = std::filesystem;
+
+namespace build_cache::build_manifest
+{
+    class TempFolder
+    {
+    public:
+        fs::path m_path;
+
+        TempFolder()
+            : m_path(fs::temp_directory_path() / "oat_build_manifest_tests")
+        {
+            fs::remove_all(m_path);
+            fs::create_directories(m_path);
+        }
+
+        ~TempFolder()
+        {
+            std::error_code ec;
+            fs::remove_all(m_path, ec);
+        }
+
+        TempFolder(const TempFolder& other) = delete;
+        TempFolder(TempFolder&& other) noexcept = delete;
+        TempFolder& operator=(const TempFolder& other) = delete;
+        TempFolder& operator=(TempFolder&& other) noexcept = delete;
+
+        void WriteFile(const std::string& fileName, const std::string& data) const
+        {
+            std::ofstream stream(m_path / fileName, std::ios::binary);
+            stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+        }
+
+        void TouchFile(const std::string& fileName) const
+        {
+            const auto filePath = m_path / fileName;
+            fs::last_write_time(filePath, fs::last_write_time(filePath) + std::chrono::seconds(1));
+        }
+    };
+
+    BuildManifest CreateManifest(const std::vector<std::string>& fileNames, const build_search_paths_t& searchPaths)
+    {
+        BuildDependencyRecorder recorder;
+        for (const auto& fileName : fileNames)
+            recorder.RecordOpen(BuildDependencyType::ASSET, fileName, searchPaths[static_cast<size_t>(BuildDependencyType::ASSET)]->Open(fileName));
+
+        BuildManifest manifest;
+        manifest.m_options_hash = BuildManifest::HashOptions("options");
+        REQUIRE(recorder.CreateManifest(manifest, searchPaths));
+
+        return manifest;
+    }
+
+    TEST_CASE("BuildManifest: Reads back all written entries", "[linker][buildcache]")
+    {
+        BuildManifest manifest;
+        manifest.m_options_hash = BuildManifest::HashOptions("options");
+        manifest.m_outputs.emplace_back("out/zone.ff");
+        manifest.m_outputs.emplace_back("out/zone.sabs");
+
+        BuildDependency foundDependency(BuildDependencyType::GDT, "gdt/weapons with spaces.gdt");
+        foundDependency.m_found = true;
+        foundDependency.m_disk_path = "raw/gdt/weapons with spaces.gdt";
+        foundDependency.m_size = 1234;
+        foundDependency.m_last_write_time = 5678;
+        foundDependency.m_hash = "0123456789abcdef0123456789abcdef";
+        manifest.m_dependencies.emplace_back(foundDependency);
+        manifest.m_dependencies.emplace_back(BuildDependencyType::ASSET, "images/missing.iwi");
+
+        std::stringstream stream;
+        manifest.Write(stream);
+
+        std::string header, options;
+        std::getline(stream, header);
+        std::getline(stream, options);
+        REQUIRE(header == "OpenAssetTools build manifest 1");
+        REQUIRE(options == "options\t" + manifest.m_options_hash);
+
+        stream.seekg(0, std::ios::beg);
+        BuildManifest readManifest;
+        REQUIRE(readManifest.Read(stream));
+
+        REQUIRE(readManifest.m_options_hash == manifest.m_options_hash);
+        REQUIRE(readManifest.m_outputs == manifest.m_outputs);
+        REQUIRE(readManifest.m_dependencies.size() == 2u);
+
+        const auto& readFoundDependency = readManifest.m_dependencies[0];
+        REQUIRE(readFoundDependency.m_type == BuildDependencyType::GDT);
+        REQUIRE(readFoundDependency.m_file_name == foundDependency.m_file_name);
+        REQUIRE(readFoundDependency.m_found);
+        REQUIRE(readFoundDependency.m_disk_path == foundDependency.m_disk_path);
+        REQUIRE(readFoundDependency.m_size == foundDependency.m_size);
+        REQUIRE(readFoundDependency.m_last_write_time == foundDependency.m_last_write_time);
+        REQUIRE(readFoundDependency.m_hash == foundDependency.m_hash);
+
+        const auto& readMissingDependency = readManifest.m_dependencies[1];
+        REQUIRE(readMissingDependency.m_type == BuildDependencyType::ASSET);
+        REQUIRE(readMissingDependency.m_file_name == "images/missing.iwi");
+        REQUIRE(!readMissingDependency.m_found);
+    }
+
+    TEST_CASE("BuildManifest: Rejects malformed manifests", "[linker][buildcache]")
+    {
+        const std::string header = "OpenAssetTools build manifest 1\n";
+        const std::string options = "options\t0123\n";
+        const std::string malformedManifests[]{
+            "",
+            "OpenAssetTools build manifest 2\n" + options,
+            header,
+            header + options + "unknown\tvalue\n",
+            header + options + "output\n",
+            header + options + "dependency\t1\t1\t10\t20\thash\tpath\n",
+            header + options + "dependency\tone\t1\t10\t20\thash\tpath\tfile\n",
+            header + options + "dependency\t3\t1\t10\t20\thash\tpath\tfile\n",
+            header + options + "dependency\t1\t1\tten\t20\thash\tpath\tfile\n",
+        };
+
+        for (const auto& malformedManifest : malformedManifests)
+        {
+            std::istringstream stream(malformedManifest);
+            BuildManifest manifest;
+
+            INFO(malformedManifest);
+            REQUIRE(!manifest.Read(stream));
+        }
+    }
+
+    TEST_CASE("BuildManifest: Does not hash files with the same size and modification time again", "[linker][buildcache]")
+    {
+        TempFolder folder;
+        folder.WriteFile("a.txt", "content");
+
+        SearchPathFilesystem searchPath(folder.m_path.string(), false);
+        const build_search_paths_t searchPaths{&searchPath, &searchPath, &searchPath};
+
+        auto manifest = CreateManifest({"a.txt"}, searchPaths);
+        REQUIRE(manifest.IsUpToDate("options", searchPaths));
+        REQUIRE(!manifest.IsUpToDate("other options", searchPaths));
+
+        // A hash that does not match the file is only noticed when the file is hashed again
+        const auto hash = manifest.m_dependencies[0].m_hash;
+        manifest.m_dependencies[0].m_hash = "mismatch";
+        REQUIRE(manifest.IsUpToDate("options", searchPaths));
+
+        folder.TouchFile("a.txt");
+        REQUIRE(!manifest.IsUpToDate("options", searchPaths));
+
+        manifest.m_dependencies[0].m_hash = hash;
+        REQUIRE(manifest.IsUpToDate("options", searchPaths));
+
+        folder.WriteFile("a.txt", "changed");
+        folder.TouchFile("a.txt");
+        REQUIRE(!manifest.IsUpToDate("options", searchPaths));
+    }
+
+    TEST_CASE("BuildManifest: Is outdated when a file that was not found before is found", "[linker][buildcache]")
+    {
+        TempFolder folder;
+
+        SearchPathFilesystem searchPath(folder.m_path.string(), false);
+        const build_search_paths_t searchPaths{&searchPath, &searchPath, &searchPath};
+
+        const auto manifest = CreateManifest({"missing.txt"}, searchPaths);
+        REQUIRE(manifest.m_dependencies.size() == 1u);
+        REQUIRE(!manifest.m_dependencies[0].m_found);
+        REQUIRE(manifest.IsUpToDate("options", searchPaths));
+
+        folder.WriteFile("missing.txt", "content");
+        REQUIRE(!manifest.IsUpToDate("options", searchPaths));
+    }
+
+    TEST_CASE("BuildManifest: Is outdated when an output is missing", "[linker][buildcache]")
+    {
+        TempFolder folder;
+        folder.WriteFile("zone.ff", "zone");
+
+        SearchPathFilesystem searchPath(folder.m_path.string(), false);
+        const build_search_paths_t searchPaths{&searchPath, &searchPath, &searchPath};
+
+        auto manifest = CreateManifest({}, searchPaths);
+        manifest.m_outputs.emplace_back((folder.m_path / "zone.ff").string());
+        REQUIRE(manifest.IsUpToDate("options", searchPaths));
+
+        manifest.m_outputs.emplace_back((folder.m_path / "zone.sabs").string());
+        REQUIRE(!manifest.IsUpToDate("options", searchPaths));
+    }
+} // namespace build_cache::build_manifest
@@ -0,0 +1,95 @@
+#include "Csv/CsvStream.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace csv::csv_stream
+{
+    TEST_CASE("CsvInputStream: Ensure can read simple rows", "[csv]")
+    {
+        std::istringstream ss("test,data,lol\n"
+                              "lorem,,ipsum\n"
+                              "\n"
+                              "last");
+        CsvInputStream csv(ss);
+        std::vector<std::string> row;
+
+        REQUIRE(csv.NextRow(row));
+        REQUIRE(row == std::vector<std::string>{"test", "data", "lol"});
+
+        REQUIRE(csv.NextRow(row));
+        REQUIRE(row == std::vector<std::string>{"lorem", "", "ipsum"});
+
+        REQUIRE(csv.NextRow(row));
+        REQUIRE(row == std::vector<std::string>{""});
+
+        REQUIRE(csv.NextRow(row));
+        REQUIRE(row == std::vector<std::string>{"last"});
+
+        REQUIRE(!csv.NextRow(row));
+    }
+
+    TEST_CASE("CsvInputStream: Ensure only carriage returns before line breaks end rows", "[csv]")
+    {
+        std::istringstream ss("a,b\r\n"
+                              "c\rd,e\r\r\n"
+                              "f\r");
+        CsvInputStream csv(ss);
+        std::vector<std::string> row;
+
+        REQUIRE(csv.NextRow(row));
+        REQUIRE(row == std::vector<std::string>{"a", "b"});
+
+        REQUIRE(csv.NextRow(row));
+        REQUIRE(row == std::vector<std::string>{"c\rd", "e\r"});
+
+        REQUIRE(csv.NextRow(row));
+        REQUIRE(row == std::vector<std::string>{"f\r"});
+
+        REQUIRE(!csv.NextRow(row));
+    }
+
+    TEST_CASE("CsvInputStream: Ensure can read rows across buffer boundaries", "[csv]")
+    {
+        const std::string longCell(150000, 'x');
+        std::ostringstream input;
+        for (auto i = 0; i < 20000; i++)
+            input << "row" << i << ",value" << i << "\n";
+        input << longCell << "," << longCell << "\n";
+        input << "end";
+
+        std::istringstream ss(input.str());
+        CsvInputStream csv(ss);
+        std::vector<std::string_view> row;
+
+        for (auto i = 0; i < 20000; i++)
+        {
+            REQUIRE(csv.NextRow(row));
+            REQUIRE(row.size() == 2u);
+            REQUIRE(row[0] == "row" + std::to_string(i));
+            REQUIRE(row[1] == "value" + std::to_string(i));
+        }
+
+        REQUIRE(csv.NextRow(row));
+        REQUIRE(row.size() == 2u);
+        REQUIRE(row[0] == longCell);
+        REQUIRE(row[1] == longCell);
+
+        REQUIRE(csv.NextRow(row));
+        REQUIRE(row.size() == 1u);
+        REQUIRE(row[0] == "end");
+
+        REQUIRE(!csv.NextRow(row));
+    }
+
+    TEST_CASE("CsvInputStream: Ensure empty stream has no rows", "[csv]")
+    {
+        std::istringstream ss("");
+        CsvInputStream csv(ss);
+        std::vector<std::string> row;
+
+        REQUIRE(!csv.NextRow(row));
+    }
+} // namespace csv::csv_stream
@@ -0,0 +1,113 @@
+#include "Image/TextureConverter.h"
+#include "Utils/ThreadPool.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+namespace image::texture_converter
+{
+    TEST_CASE("TextureConverter: Converts every mip level with and without a thread pool", "[image]")
+    {
+        Texture2D texture(&ImageFormat::FORMAT_R8_G8_B8_A8, 301, 157, true);
+        texture.Allocate();
+
+        const auto mipCount = texture.GetMipMapCount();
+        for (auto mipLevel = 0; mipLevel < mipCount; mipLevel++)
+        {
+            auto* buffer = texture.GetBufferForMipLevel(mipLevel, 0);
+            const auto size = texture.GetSizeOfMipLevel(mipLevel);
+            for (auto i = 0u; i < size; i++)
+                buffer[i] = static_cast<uint8_t>(i * 7 + mipLevel);
+        }
+
+        ThreadPool threadPool(4);
+        TextureConverter sequentialConverter(&texture, &ImageFormat::FORMAT_B8_G8_R8_X8);
+        TextureConverter parallelConverter(&texture, &ImageFormat::FORMAT_B8_G8_R8_X8, &threadPool);
+        const std::unique_ptr<Texture> sequential(sequentialConverter.Convert());
+        const std::unique_ptr<Texture> parallel(parallelConverter.Convert());
+
+        for (auto mipLevel = 0; mipLevel < mipCount; mipLevel++)
+        {
+            const auto* input = texture.GetBufferForMipLevel(mipLevel, 0);
+            const auto* output = sequential->GetBufferForMipLevel(mipLevel, 0);
+            const auto size = texture.GetSizeOfMipLevel(mipLevel);
+
+            for (auto i = 0u; i < size; i += 4)
+            {
+                REQUIRE(output[i + 0] == input[i + 2]);
+                REQUIRE(output[i + 1] == input[i + 1]);
+                REQUIRE(output[i + 2] == input[i + 0]);
+                REQUIRE(output[i + 3] == 0);
+            }
+
+            REQUIRE(std::memcmp(output, parallel->GetBufferForMipLevel(mipLevel, 0), size) == 0);
+        }
+    }
+
+    TEST_CASE("TextureConverter: Expands channels without alpha to opaque pixels", "[image]")
+    {
+        Texture2D texture(&ImageFormat::FORMAT_R8_A8, 2, 1);
+        texture.Allocate();
+        const uint8_t pixels[]{0x12, 0x34, 0xFF, 0x00};
+        std::memcpy(texture.GetBufferForMipLevel(0, 0), pixels, sizeof(pixels));
+
+        TextureConverter converter(&texture, &ImageFormat::FORMAT_B8_G8_R8_A8);
+        const std::unique_ptr<Texture> converted(converter.Convert());
+
+        const uint8_t expected[]{0x00, 0x00, 0x12, 0x34, 0x00, 0x00, 0xFF, 0x00};
+        REQUIRE(std::memcmp(converted->GetBufferForMipLevel(0, 0), expected, sizeof(expected)) == 0);
+
+        Texture2D rgbTexture(&ImageFormat::FORMAT_R8_G8_B8, 1, 1);
+        rgbTexture.Allocate();
+        const uint8_t rgbPixel[]{0x10, 0x20, 0x30};
+        std::memcpy(rgbTexture.GetBufferForMipLevel(0, 0), rgbPixel, sizeof(rgbPixel));
+
+        TextureConverter rgbConverter(&rgbTexture, &ImageFormat::FORMAT_R8_G8_B8_A8);
+        const std::unique_ptr<Texture> rgbConverted(rgbConverter.Convert());
+
+        const uint8_t expectedRgba[]{0x10, 0x20, 0x30, 0xFF};
+        REQUIRE(std::memcmp(rgbConverted->GetBufferForMipLevel(0, 0), expectedRgba, sizeof(expectedRgba)) == 0);
+    }
+
+    TEST_CASE("TextureConverter: Decodes block compressed textures", "[image]")
+    {
+        // 6x5 pixels cover 2x2 blocks that are partially outside of the texture
+        Texture2D texture(&ImageFormat::FORMAT_BC3, 6, 5);
+        texture.Allocate();
+
+        // Alpha endpoints 255 and 0 with all indices 0, color endpoints pure red and pure blue with all indices 1
+        const uint8_t block[]{0xFF, 0x00, 0, 0, 0, 0, 0, 0, 0x00, 0xF8, 0x1F, 0x00, 0x55, 0x55, 0x55, 0x55};
+        auto* buffer = texture.GetBufferForMipLevel(0, 0);
+        for (auto i = 0u; i < 4; i++)
+            std::memcpy(&buffer[i * sizeof(block)], block, sizeof(block));
+
+        TextureConverter converter(&texture, &ImageFormat::FORMAT_R8_G8_B8_A8);
+        const std::unique_ptr<Texture> converted(converter.Convert());
+        const auto* output = converted->GetBufferForMipLevel(0, 0);
+
+        REQUIRE(converted->GetSizeOfMipLevel(0) == 6 * 5 * 4);
+        for (auto i = 0u; i < 6 * 5; i++)
+        {
+            REQUIRE(output[i * 4 + 0] == 0x00);
+            REQUIRE(output[i * 4 + 1] == 0x00);
+            REQUIRE(output[i * 4 + 2] == 0xFF);
+            REQUIRE(output[i * 4 + 3] == 0xFF);
+        }
+
+        Texture2D bc1Texture(&ImageFormat::FORMAT_BC1, 4, 4);
+        bc1Texture.Allocate();
+
+        // color0 <= color1 selects the mode with a transparent fourth color
+        const uint8_t bc1Block[]{0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+        std::memcpy(bc1Texture.GetBufferForMipLevel(0, 0), bc1Block, sizeof(bc1Block));
+
+        TextureConverter bc1Converter(&bc1Texture, &ImageFormat::FORMAT_R8_G8_B8_A8);
+        const std::unique_ptr<Texture> bc1Converted(bc1Converter.Convert());
+        const auto* bc1Output = bc1Converted->GetBufferForMipLevel(0, 0);
+
+        for (auto i = 0u; i < 16 * 4; i++)
+            REQUIRE(bc1Output[i] == 0);
+    }
+} // namespace image::texture_converter
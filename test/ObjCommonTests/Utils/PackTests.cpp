@@ -0,0 +1,108 @@
+#include "Utils/Pack.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace utils::pack
+{
+    /**
+     * \brief Creates values that cover every half float in both halves and a spread of byte and 10 bit components.
+     * The count is not a multiple of four, so the batched functions also have to unpack a remainder.
+     */
+    std::vector<uint32_t> CreatePackedValues()
+    {
+        std::vector<uint32_t> values;
+        values.reserve(0x10000u + 0x1003u);
+        for (auto i = 0u; i < 0x10000u; i++)
+            values.emplace_back(i << 16 | (0xFFFFu - i));
+
+        auto seed = 1u;
+        for (auto i = 0u; i < 0x1003u; i++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            values.emplace_back(seed);
+        }
+
+        return values;
+    }
+
+    bool AreBitwiseEqual(const float a, const float b)
+    {
+        return memcmp(&a, &b, sizeof(float)) == 0;
+    }
+
+    TEST_CASE("Pack32: Unpacks tex coords in batches like one by one", "[pack]")
+    {
+        const auto values = CreatePackedValues();
+        std::vector<float> u(values.size());
+        std::vector<float> v(values.size());
+
+        Pack32::Vec2UnpackTexCoordsUV(values.data(), u.data(), v.data(), values.size());
+        for (auto i = 0u; i < values.size(); i++)
+        {
+            float expected[2];
+            Pack32::Vec2UnpackTexCoordsUV(values[i], expected);
+            REQUIRE(AreBitwiseEqual(u[i], expected[0]));
+            REQUIRE(AreBitwiseEqual(v[i], expected[1]));
+        }
+
+        Pack32::Vec2UnpackTexCoordsVU(values.data(), u.data(), v.data(), values.size());
+        for (auto i = 0u; i < values.size(); i++)
+        {
+            float expected[2];
+            Pack32::Vec2UnpackTexCoordsVU(values[i], expected);
+            REQUIRE(AreBitwiseEqual(u[i], expected[0]));
+            REQUIRE(AreBitwiseEqual(v[i], expected[1]));
+        }
+    }
+
+    TEST_CASE("Pack32: Unpacks unit vectors in batches like one by one", "[pack]")
+    {
+        const auto values = CreatePackedValues();
+        std::vector<float> x(values.size());
+        std::vector<float> y(values.size());
+        std::vector<float> z(values.size());
+
+        Pack32::Vec3UnpackUnitVecScaleBased(values.data(), x.data(), y.data(), z.data(), values.size());
+        for (auto i = 0u; i < values.size(); i++)
+        {
+            float expected[3];
+            Pack32::Vec3UnpackUnitVecScaleBased(values[i], expected);
+            REQUIRE(AreBitwiseEqual(x[i], expected[0]));
+            REQUIRE(AreBitwiseEqual(y[i], expected[1]));
+            REQUIRE(AreBitwiseEqual(z[i], expected[2]));
+        }
+
+        Pack32::Vec3UnpackUnitVecThirdBased(values.data(), x.data(), y.data(), z.data(), values.size());
+        for (auto i = 0u; i < values.size(); i++)
+        {
+            float expected[3];
+            Pack32::Vec3UnpackUnitVecThirdBased(values[i], expected);
+            REQUIRE(AreBitwiseEqual(x[i], expected[0]));
+            REQUIRE(AreBitwiseEqual(y[i], expected[1]));
+            REQUIRE(AreBitwiseEqual(z[i], expected[2]));
+        }
+    }
+
+    TEST_CASE("Pack32: Unpacks colors in batches like one by one", "[pack]")
+    {
+        const auto values = CreatePackedValues();
+        std::vector<float> r(values.size());
+        std::vector<float> g(values.size());
+        std::vector<float> b(values.size());
+        std::vector<float> a(values.size());
+
+        Pack32::Vec4UnpackGfxColor(values.data(), r.data(), g.data(), b.data(), a.data(), values.size());
+        for (auto i = 0u; i < values.size(); i++)
+        {
+            float expected[4];
+            Pack32::Vec4UnpackGfxColor(values[i], expected);
+            REQUIRE(AreBitwiseEqual(r[i], expected[0]));
+            REQUIRE(AreBitwiseEqual(g[i], expected[1]));
+            REQUIRE(AreBitwiseEqual(b[i], expected[2]));
+            REQUIRE(AreBitwiseEqual(a[i], expected[3]));
+        }
+    }
+} // namespace utils::pack
@@ -0,0 +1,81 @@
+#include "AssetLoading/RawAssetPreparer.h"
+#include "Utils/ThreadPool.h"
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace asset_loading::raw_asset_preparer
+{
+    class PreparedValue final : public IPreparedRawAsset
+    {
+    public:
+        std::string m_value;
+
+        explicit PreparedValue(std::string value)
+            : m_value(std::move(value))
+        {
+        }
+    };
+
+    TEST_CASE("RawAssetPreparer: Prepares every asset once with and without a thread pool", "[assetloading]")
+    {
+        ThreadPool threadPool(2);
+        RawAssetPreparer sequentialPreparer(nullptr);
+        RawAssetPreparer parallelPreparer(&threadPool);
+
+        REQUIRE(!sequentialPreparer.IsEnabled());
+        REQUIRE(parallelPreparer.IsEnabled());
+
+        for (auto* preparer : {&sequentialPreparer, &parallelPreparer})
+        {
+            std::atomic_int prepareCount = 0;
+            const auto prepare = [&prepareCount](const int index)
+            {
+                return [&prepareCount, index]
+                {
+                    ++prepareCount;
+                    return std::make_unique<PreparedValue>("asset" + std::to_string(index));
+                };
+            };
+
+            for (auto i = 0; i < 8; i++)
+                preparer->Prepare(0, "asset" + std::to_string(i), prepare(i));
+            preparer->Prepare(0, "asset0", prepare(0));
+
+            for (auto i = 0; i < 8; i++)
+            {
+                const auto result = preparer->Take(0, "asset" + std::to_string(i), prepare(i));
+
+                REQUIRE(result);
+                REQUIRE(dynamic_cast<PreparedValue&>(*result).m_value == "asset" + std::to_string(i));
+            }
+
+            REQUIRE(prepareCount == 8);
+        }
+    }
+
+    TEST_CASE("RawAssetPreparer: Rethrows errors of preparations when taking the asset", "[assetloading]")
+    {
+        ThreadPool threadPool(1);
+        RawAssetPreparer preparer(&threadPool);
+
+        std::atomic_bool started = false;
+        preparer.Prepare(0,
+                         "broken",
+                         [&started]() -> std::unique_ptr<IPreparedRawAsset>
+                         {
+                             started = true;
+                             throw std::runtime_error("broken");
+                         });
+
+        // Assets that did not start preparing yet are prepared by the caller of Take instead
+        while (!started)
+            std::this_thread::yield();
+
+        REQUIRE_THROWS_AS(preparer.Take(0, "broken", [] { return std::make_unique<PreparedValue>("inline"); }), std::runtime_error);
+    }
+} // namespace asset_loading::raw_asset_preparer
@@ -0,0 +1,224 @@
+#include "Image/IwiFileCache.h"
+#include "Image/IwiLoader.h"
+#include "Image/IwiTypes.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <zlib.h>
+
+namespace fs = std::filesystem;
+
+namespace image::iwi_file_cache
+{
+    std::string CreateIwi27(const uint16_t width, const uint16_t height)
+    {
+        constexpr auto BYTES_PER_PIXEL = 4u;
+        const auto dataSize = static_cast<uint32_t>(width * height * BYTES_PER_PIXEL);
+
+        IwiVersion version{};
+        version.tag[0] = 'I';
+        version.tag[1] = 'W';
+        version.tag[2] = 'i';
+        version.version = 27;
+
+        iwi27::IwiHeader header{};
+        header.format = static_cast<int8_t>(iwi27::IwiFormat::IMG_FORMAT_BITMAP_RGBA);
+        header.flags = static_cast<int8_t>(iwi27::IwiFlags::IMG_FLAG_NOMIPMAPS);
+        header.dimensions[0] = width;
+        header.dimensions[1] = height;
+        header.dimensions[2] = 1;
+        for (auto& fileSize : header.fileSizeForPicmip)
+            fileSize = static_cast<uint32_t>(sizeof(IwiVersion) + sizeof(iwi27::IwiHeader) + dataSize);
+
+        std::string data(reinterpret_cast<const char*>(&version), sizeof(version));
+        data.append(reinterpret_cast<const char*>(&header), sizeof(header));
+        for (auto i = 0u; i < dataSize; i++)
+            data.push_back(static_cast<char>(i * 7));
+
+        return data;
+    }
+
+    SearchPathOpenFile OpenInMemory(const std::string& data)
+    {
+        return SearchPathOpenFile(std::make_unique<std::istringstream>(data), static_cast<int64_t>(data.size()));
+    }
+
+    SearchPathOpenFile OpenOnDisk(const fs::path& path)
+    {
+        return SearchPathOpenFile(std::make_unique<std::ifstream>(path, std::ios::binary), static_cast<int64_t>(fs::file_size(path)), path.string());
+    }
+
+    SearchPathOpenFile OpenUnreadable(const fs::path& path)
+    {
+        // Claims to be the file on disk but cannot be probed, so only a cache hit can succeed
+        return SearchPathOpenFile(std::make_unique<std::istringstream>(), static_cast<int64_t>(fs::file_size(path)), path.string());
+    }
+
+    /**
+     * \brief A stream buffer that, like the ones of deflated iwd entries, can only be read forwards and counts how much data was read from it.
+     */
+    class ForwardOnlyStreamBuffer final : public std::streambuf
+    {
+        std::string m_data;
+
+    public:
+        size_t m_read_size;
+        size_t m_seek_count;
+
+        explicit ForwardOnlyStreamBuffer(std::string data)
+            : m_data(std::move(data)),
+              m_read_size(0u),
+              m_seek_count(0u)
+        {
+        }
+
+    protected:
+        int_type underflow() override
+        {
+            if (m_read_size >= m_data.size())
+                return traits_type::eof();
+
+            setg(&m_data[m_read_size], &m_data[m_read_size], &m_data[m_read_size] + 1);
+            m_read_size++;
+
+            return traits_type::to_int_type(*gptr());
+        }
+
+        pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode mode) override
+        {
+            m_seek_count++;
+            return pos_type(off_type(-1));
+        }
+
+        pos_type seekpos(pos_type pos, std::ios_base::openmode mode) override
+        {
+            m_seek_count++;
+            return pos_type(off_type(-1));
+        }
+    };
+
+    void WriteFile(const fs::path& path, const std::string& data)
+    {
+        std::ofstream stream(path, std::ios::binary);
+        stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+    }
+
+    TEST_CASE("IwiLoader: Header probe reads same layout as full load", "[image][iwi]")
+    {
+        const auto data = CreateIwi27(16, 8);
+        MemoryManager memory;
+        IwiLoader loader(&memory);
+
+        std::istringstream fullStream(data);
+        const auto* fullTexture = loader.LoadIwi(fullStream);
+        REQUIRE(fullTexture != nullptr);
+
+        std::istringstream headerStream(data);
+        const auto* headerTexture = loader.LoadIwiHeader(headerStream);
+        REQUIRE(headerTexture != nullptr);
+
+        REQUIRE(headerTexture->Empty());
+        REQUIRE(headerTexture->GetWidth() == fullTexture->GetWidth());
+        REQUIRE(headerTexture->GetHeight() == fullTexture->GetHeight());
+        REQUIRE(headerTexture->GetDepth() == fullTexture->GetDepth());
+        REQUIRE(headerTexture->HasMipMaps() == fullTexture->HasMipMaps());
+    }
+
+    TEST_CASE("IwiLoader: Header probe rejects truncated iwi", "[image][iwi]")
+    {
+        auto data = CreateIwi27(16, 8);
+        data.resize(data.size() - 1);
+
+        MemoryManager memory;
+        IwiLoader loader(&memory);
+        std::istringstream stream(data);
+
+        REQUIRE(loader.LoadIwiHeader(stream) == nullptr);
+    }
+
+    TEST_CASE("IwiFileCache: Gets header and hash of whole file", "[image][iwi]")
+    {
+        const auto data = CreateIwi27(32, 4);
+        const auto expectedHash = static_cast<unsigned>(crc32(0u, reinterpret_cast<const Bytef*>(data.data()), static_cast<uInt>(data.size())));
+
+        IwiFileCache cache;
+        IwiFileInfo info;
+        REQUIRE(cache.GetFileInfo(OpenInMemory(data), info));
+
+        REQUIRE(info.m_width == 32u);
+        REQUIRE(info.m_height == 4u);
+        REQUIRE(info.m_depth == 1u);
+        REQUIRE(!info.m_has_mip_maps);
+        REQUIRE(info.m_data_hash == expectedHash);
+
+        REQUIRE(cache.GetDataHash(OpenInMemory(data), data.data(), data.size()) == expectedHash);
+    }
+
+    TEST_CASE("IwiFileCache: Reads files only once to probe and hash them", "[image][iwi]")
+    {
+        const auto data = CreateIwi27(64, 64);
+        const auto expectedHash = static_cast<unsigned>(crc32(0u, reinterpret_cast<const Bytef*>(data.data()), static_cast<uInt>(data.size())));
+
+        auto streamBuffer = std::make_unique<ForwardOnlyStreamBuffer>(data);
+        auto* streamBufferPtr = streamBuffer.get();
+        const SearchPathOpenFile file(std::make_unique<std::istream>(streamBufferPtr), static_cast<int64_t>(data.size()));
+
+        IwiFileInfo info;
+        REQUIRE(IwiFileCache::ReadFileInfo(file, info));
+        REQUIRE(info.m_width == 64u);
+        REQUIRE(info.m_height == 64u);
+        REQUIRE(info.m_data_hash == expectedHash);
+
+        REQUIRE(streamBufferPtr->m_read_size == data.size());
+        REQUIRE(streamBufferPtr->m_seek_count == 0u);
+    }
+
+    TEST_CASE("IwiFileCache: Does not accept truncated files without a cache", "[image][iwi]")
+    {
+        auto data = CreateIwi27(16, 8);
+        data.resize(data.size() - 1);
+
+        IwiFileInfo info;
+        REQUIRE(!IwiFileCache::ReadFileInfo(OpenInMemory(data), info));
+    }
+
+    TEST_CASE("IwiFileCache: Caches files on disk until they are rewritten", "[image][iwi]")
+    {
+        const auto path = fs::temp_directory_path() / "oat_iwi_file_cache_test.iwi";
+        const auto firstData = CreateIwi27(16, 8);
+        const auto secondData = CreateIwi27(8, 16);
+        REQUIRE(firstData.size() == secondData.size());
+
+        WriteFile(path, firstData);
+
+        IwiFileCache cache;
+        IwiFileInfo info;
+        REQUIRE(cache.GetFileInfo(OpenOnDisk(path), info));
+        REQUIRE(info.m_width == 16u);
+
+        IwiFileInfo cachedInfo;
+        REQUIRE(cache.GetFileInfo(OpenUnreadable(path), cachedInfo));
+        REQUIRE(cachedInfo.m_width == 16u);
+        REQUIRE(cachedInfo.m_data_hash == info.m_data_hash);
+
+        // Files of the same size rewritten in quick succession may otherwise end up with the same last write time
+        const auto firstWriteTime = fs::last_write_time(path);
+        WriteFile(path, secondData);
+        fs::last_write_time(path, firstWriteTime + std::chrono::seconds(1));
+
+        IwiFileInfo refreshedInfo;
+        REQUIRE(!cache.GetFileInfo(OpenUnreadable(path), refreshedInfo));
+        REQUIRE(cache.GetFileInfo(OpenOnDisk(path), refreshedInfo));
+        REQUIRE(refreshedInfo.m_width == 8u);
+        REQUIRE(refreshedInfo.m_height == 16u);
+        REQUIRE(refreshedInfo.m_data_hash != info.m_data_hash);
+
+        fs::remove(path);
+    }
+} // namespace image::iwi_file_cache
@@ -0,0 +1,115 @@
+#include "ObjContainer/IWD/IWD.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <zlib.h>
+
+namespace obj_container::iwd
+{
+    class ZipBuilder
+    {
+        std::string m_data;
+
+        void Write16(const uint16_t value)
+        {
+            m_data.push_back(static_cast<char>(value & 0xFF));
+            m_data.push_back(static_cast<char>(value >> 8));
+        }
+
+        void Write32(const uint32_t value)
+        {
+            Write16(static_cast<uint16_t>(value & 0xFFFF));
+            Write16(static_cast<uint16_t>(value >> 16));
+        }
+
+    public:
+        /**
+         * \brief Creates a zip archive that contains a single uncompressed file.
+         */
+        std::string CreateStored(const std::string& fileName, const std::string& fileData)
+        {
+            const auto crc = static_cast<uint32_t>(crc32(0L, reinterpret_cast<const Bytef*>(fileData.data()), static_cast<uInt>(fileData.size())));
+            const auto size = static_cast<uint32_t>(fileData.size());
+            const auto nameLength = static_cast<uint16_t>(fileName.size());
+
+            // Local file header
+            Write32(0x04034b50);
+            Write16(20);
+            Write16(0);
+            Write16(0);
+            Write16(0);
+            Write16(0);
+            Write32(crc);
+            Write32(size);
+            Write32(size);
+            Write16(nameLength);
+            Write16(0);
+            m_data += fileName;
+            m_data += fileData;
+
+            // Central directory
+            const auto centralDirectoryOffset = static_cast<uint32_t>(m_data.size());
+            Write32(0x02014b50);
+            Write16(20);
+            Write16(20);
+            Write16(0);
+            Write16(0);
+            Write16(0);
+            Write16(0);
+            Write32(crc);
+            Write32(size);
+            Write32(size);
+            Write16(nameLength);
+            Write16(0);
+            Write16(0);
+            Write16(0);
+            Write16(0);
+            Write32(0);
+            Write32(0);
+            m_data += fileName;
+            const auto centralDirectorySize = static_cast<uint32_t>(m_data.size()) - centralDirectoryOffset;
+
+            // End of central directory
+            Write32(0x06054b50);
+            Write16(0);
+            Write16(0);
+            Write16(1);
+            Write16(1);
+            Write32(centralDirectorySize);
+            Write32(centralDirectoryOffset);
+            Write16(0);
+
+            return std::move(m_data);
+        }
+    };
+
+    TEST_CASE("IWD: Seeking back after reading past the buffer returns the data at the target position", "[iwd]")
+    {
+        std::string fileData(0x30000, '\0');
+        for (auto i = 0u; i < fileData.size(); i++)
+            fileData[i] = static_cast<char>(i * 7 + (i >> 16));
+
+        IWD iwd("test.iwd", std::make_unique<std::istringstream>(ZipBuilder().CreateStored("test.bin", fileData)));
+        REQUIRE(iwd.Initialize());
+
+        const auto file = iwd.Open("test.bin");
+        REQUIRE(file.IsOpen());
+
+        // A small read fills the buffer, the large one is read into the target directly
+        std::vector<char> buffer(0x20000);
+        file.m_stream->read(buffer.data(), 0x10);
+        REQUIRE(std::memcmp(buffer.data(), fileData.data(), 0x10) == 0);
+        file.m_stream->read(buffer.data(), 0x20000);
+        REQUIRE(std::memcmp(buffer.data(), &fileData[0x10], 0x20000) == 0);
+
+        file.m_stream->seekg(-0x100, std::ios::cur);
+        file.m_stream->read(buffer.data(), 0x100);
+        REQUIRE(file.m_stream->gcount() == 0x100);
+        REQUIRE(std::memcmp(buffer.data(), &fileData[0x20010 - 0x100], 0x100) == 0);
+    }
+} // namespace obj_container::iwd
@@ -0,0 +1,113 @@
+#include "Parsing/Menu/MenuFileReader.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+#include <string>
+
+using namespace menu;
+
+namespace test::parsing::menu::menu_file_reader
+{
+    std::string CreateMenuCorpus(const unsigned menuCount, const unsigned itemCount)
+    {
+        std::ostringstream ss;
+        ss << "{\n";
+
+        for (auto menuIndex = 0u; menuIndex < menuCount; menuIndex++)
+        {
+            ss << "    menuDef\n"
+                  "    {\n"
+                  "        name \"menu_"
+               << menuIndex
+               << "\"\n"
+                  "        fullscreen 1\n"
+                  "        rect 0 0 640 480\n"
+                  "        style 1\n"
+                  "        forecolor 1 1 1 1\n"
+                  "        onOpen\n"
+                  "        {\n"
+                  "            fadein \"item_0\";\n"
+                  "            open \"other_menu\";\n"
+                  "            setColor backColor 1 1 1 1;\n"
+                  "        }\n";
+
+            for (auto itemIndex = 0u; itemIndex < itemCount; itemIndex++)
+            {
+                ss << "        itemDef\n"
+                      "        {\n"
+                      "            name \"item_"
+                   << itemIndex
+                   << "\"\n"
+                      "            rect 10 "
+                   << itemIndex * 20
+                   << " 100 20 1 1\n"
+                      "            style 1\n"
+                      "            type 1\n"
+                      "            border 1\n"
+                      "            visible 1\n"
+                      "            text \"Item text\"\n"
+                      "            textfont 1\n"
+                      "            textscale 0.55\n"
+                      "            forecolor 1 0.5 0.5 1\n"
+                      "            exp text(\"Item \" + "
+                   << itemIndex
+                   << ")\n"
+                      "            action\n"
+                      "            {\n"
+                      "                fadein \"item_0\";\n"
+                      "            }\n"
+                      "        }\n";
+            }
+
+            ss << "    }\n";
+        }
+
+        ss << "}\n";
+        return ss.str();
+    }
+
+    TEST_CASE("MenuFileReader: Can read menus with many properties", "[parsing][menu]")
+    {
+        std::istringstream stream(CreateMenuCorpus(3, 5));
+        const MenuAssetZoneState zoneState;
+        MenuFileReader reader(stream, "corpus.menu", FeatureLevel::IW4);
+        reader.IncludeZoneState(&zoneState);
+
+        const auto result = reader.ReadMenuFile();
+        REQUIRE(result);
+        REQUIRE(result->m_menus.size() == 3u);
+
+        const auto& menu = *result->m_menus[1];
+        REQUIRE(menu.m_name == "menu_1");
+        REQUIRE(menu.m_full_screen);
+        REQUIRE(menu.m_style == 1);
+        REQUIRE(menu.m_on_open);
+        REQUIRE(menu.m_items.size() == 5u);
+
+        const auto& item = *menu.m_items[4];
+        REQUIRE(item.m_name == "item_4");
+        REQUIRE(item.m_rect.y == 80.0);
+        REQUIRE(item.m_rect.horizontalAlign == 1);
+        REQUIRE(item.m_text == "Item text");
+        REQUIRE(item.m_text_scale == 0.55);
+        REQUIRE(item.m_fore_color.g == 0.5);
+        REQUIRE(item.m_text_expression);
+        REQUIRE(item.m_on_action);
+    }
+
+    TEST_CASE("MenuFileReader: Benchmark reading a large menu corpus", "[parsing][menu][.benchmark]")
+    {
+        const auto corpus = CreateMenuCorpus(50, 40);
+        const MenuAssetZoneState zoneState;
+
+        BENCHMARK("Read 50 menus with 40 items each")
+        {
+            std::istringstream stream(corpus);
+            MenuFileReader reader(stream, "corpus.menu", FeatureLevel::IW4);
+            reader.IncludeZoneState(&zoneState);
+
+            return reader.ReadMenuFile();
+        };
+    }
+} // namespace test::parsing::menu::menu_file_reader
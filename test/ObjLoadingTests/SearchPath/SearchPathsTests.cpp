@@ -0,0 +1,199 @@
+#include "SearchPath/SearchPathIndex.h"
+#include "SearchPath/SearchPaths.h"
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <map>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    class CountingSearchPath final : public ISearchPath
+    {
+        std::map<std::string, std::string> m_file_data_map;
+        bool m_indexed;
+
+    public:
+        std::atomic_uint m_open_count;
+
+        explicit CountingSearchPath(const bool indexed)
+            : m_indexed(indexed),
+              m_open_count(0u)
+        {
+        }
+
+        void AddFileData(std::string fileName, std::string fileData)
+        {
+            m_file_data_map.emplace(std::move(fileName), std::move(fileData));
+        }
+
+        SearchPathOpenFile Open(const std::string& fileName) override
+        {
+            m_open_count++;
+
+            const auto foundFileData = m_file_data_map.find(fileName);
+            if (foundFileData == m_file_data_map.end())
+                return {};
+
+            return {std::make_unique<std::istringstream>(foundFileData->second), static_cast<int64_t>(foundFileData->second.size())};
+        }
+
+        std::string GetPath() override
+        {
+            return "CountingFiles";
+        }
+
+        void Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback) override {}
+
+        bool ListIndexedFiles(const std::function<void(const std::string&)>& callback) override
+        {
+            if (!m_indexed)
+                return false;
+
+            for (const auto& fileName : m_file_data_map | std::views::keys)
+                callback(fileName);
+
+            return true;
+        }
+    };
+
+    std::string ReadAll(const SearchPathOpenFile& file)
+    {
+        std::ostringstream ss;
+        ss << file.m_stream->rdbuf();
+        return ss.str();
+    }
+
+    TEST_CASE("SearchPaths: Indexed lookup keeps the order of search paths", "[searchpath]")
+    {
+        CountingSearchPath first(true);
+        CountingSearchPath unindexed(false);
+        CountingSearchPath last(true);
+        first.AddFileData("a.txt", "first");
+        unindexed.AddFileData("b.txt", "unindexed");
+        last.AddFileData("a.txt", "last");
+        last.AddFileData("b.txt", "last");
+        last.AddFileData("sub/c.txt", "last");
+
+        SearchPaths searchPaths;
+        searchPaths.SetUseIndex(true);
+        searchPaths.IncludeSearchPath(&first);
+        searchPaths.IncludeSearchPath(&unindexed);
+        searchPaths.IncludeSearchPath(&last);
+
+        const auto a = searchPaths.Open("a.txt");
+        REQUIRE(a.IsOpen());
+        REQUIRE(ReadAll(a) == "first");
+
+        const auto b = searchPaths.Open("b.txt");
+        REQUIRE(b.IsOpen());
+        REQUIRE(ReadAll(b) == "unindexed");
+
+        const auto c = searchPaths.Open("sub/c.txt");
+        REQUIRE(c.IsOpen());
+        REQUIRE(ReadAll(c) == "last");
+    }
+
+    TEST_CASE("SearchPaths: Indexed lookup only asks search paths that may contain the file", "[searchpath]")
+    {
+        CountingSearchPath indexed(true);
+        CountingSearchPath unindexed(false);
+        indexed.AddFileData("a.txt", "indexed");
+
+        SearchPaths searchPaths;
+        searchPaths.SetUseIndex(true);
+        searchPaths.IncludeSearchPath(&indexed);
+        searchPaths.IncludeSearchPath(&unindexed);
+
+        REQUIRE(!searchPaths.Open("missing.txt").IsOpen());
+        REQUIRE(indexed.m_open_count == 0u);
+        REQUIRE(unindexed.m_open_count == 1u);
+
+        REQUIRE(searchPaths.Open("a.txt").IsOpen());
+        REQUIRE(indexed.m_open_count == 1u);
+        REQUIRE(unindexed.m_open_count == 1u);
+    }
+
+    TEST_CASE("SearchPaths: Indexed lookup finds files of search paths that were added later", "[searchpath]")
+    {
+        CountingSearchPath first(true);
+        CountingSearchPath second(true);
+        second.AddFileData("a.txt", "second");
+
+        SearchPaths searchPaths;
+        searchPaths.SetUseIndex(true);
+        searchPaths.IncludeSearchPath(&first);
+
+        REQUIRE(!searchPaths.Open("a.txt").IsOpen());
+
+        searchPaths.IncludeSearchPath(&second);
+        REQUIRE(searchPaths.Open("a.txt").IsOpen());
+
+        first.AddFileData("b.txt", "first");
+        REQUIRE(!searchPaths.Open("b.txt").IsOpen());
+
+        searchPaths.InvalidateIndex();
+        REQUIRE(searchPaths.Open("b.txt").IsOpen());
+    }
+
+    TEST_CASE("SearchPaths: Indexed lookup finds files while the index is invalidated concurrently", "[searchpath]")
+    {
+        CountingSearchPath indexed(true);
+        indexed.AddFileData("a.txt", "indexed");
+
+        SearchPaths searchPaths;
+        searchPaths.SetUseIndex(true);
+        searchPaths.IncludeSearchPath(&indexed);
+
+        std::atomic_bool done = false;
+        std::thread invalidatingThread(
+            [&searchPaths, &done]
+            {
+                while (!done)
+                    searchPaths.InvalidateIndex();
+            });
+
+        std::atomic_uint missingCount = 0;
+        std::vector<std::thread> lookupThreads;
+        for (auto i = 0; i < 4; i++)
+        {
+            lookupThreads.emplace_back(
+                [&searchPaths, &missingCount]
+                {
+                    for (auto j = 0; j < 2000; j++)
+                    {
+                        if (!searchPaths.Open("a.txt").IsOpen())
+                            ++missingCount;
+                    }
+                });
+        }
+
+        for (auto& lookupThread : lookupThreads)
+            lookupThread.join();
+        done = true;
+        invalidatingThread.join();
+
+        REQUIRE(missingCount == 0u);
+    }
+
+    TEST_CASE("SearchPathIndex: Normalizes file names to index keys", "[searchpath]")
+    {
+        std::string key;
+
+        REQUIRE(search_path_index::MakeKey("Images/Test.IWI", key));
+        REQUIRE(key == "images/test.iwi");
+
+        REQUIRE(search_path_index::MakeKey("./images\\\\sub/./test.iwi", key));
+        REQUIRE(key == "images/sub/test.iwi");
+
+        REQUIRE(!search_path_index::MakeKey("", key));
+        REQUIRE(!search_path_index::MakeKey("/images/test.iwi", key));
+        REQUIRE(!search_path_index::MakeKey("C:/images/test.iwi", key));
+        REQUIRE(!search_path_index::MakeKey("images/../test.iwi", key));
+        REQUIRE(!search_path_index::MakeKey("images/", key));
+    }
+} // namespace
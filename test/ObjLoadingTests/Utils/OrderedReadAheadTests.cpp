@@ -0,0 +1,128 @@
+#include "Utils/OrderedReadAhead.h"
+#include "Utils/ThreadPool.h"
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+#include <string>
+
+namespace utils::ordered_read_ahead
+{
+    class Item
+    {
+    public:
+        size_t m_index = 0u;
+        std::string m_value;
+    };
+
+    TEST_CASE("OrderedReadAhead: Returns all items in order", "[utils]")
+    {
+        ThreadPool threadPool(4);
+        OrderedReadAhead<Item> readAhead(
+            threadPool,
+            16u,
+            4u,
+            1024u,
+            [](const size_t index, Item& item)
+            {
+                item.m_index = index;
+                return 16u;
+            },
+            [](Item& item)
+            {
+                item.m_value = "item" + std::to_string(item.m_index);
+            });
+
+        for (auto i = 0u; i < 16u; i++)
+        {
+            const auto item = readAhead.Next();
+
+            REQUIRE(item);
+            REQUIRE(item->m_value == "item" + std::to_string(i));
+        }
+
+        REQUIRE(!readAhead.Next());
+    }
+
+    TEST_CASE("OrderedReadAhead: Does not queue reads exceeding the expected data size", "[utils]")
+    {
+        ThreadPool threadPool(1);
+        std::atomic_uint readCount = 0u;
+        OrderedReadAhead<Item> readAhead(
+            threadPool,
+            8u,
+            8u,
+            25u,
+            [](const size_t index, Item& item)
+            {
+                item.m_index = index;
+                return 10u;
+            },
+            [&readCount](Item&)
+            {
+                ++readCount;
+            });
+
+        // The taken item counts towards the limit until the next one is taken
+        REQUIRE(readAhead.Next()->m_index == 0u);
+        threadPool.WaitForIdle();
+        REQUIRE(readCount == 2u);
+
+        REQUIRE(readAhead.Next()->m_index == 1u);
+        threadPool.WaitForIdle();
+        REQUIRE(readCount == 3u);
+    }
+
+    TEST_CASE("OrderedReadAhead: Reads items exceeding the expected data size by themselves", "[utils]")
+    {
+        ThreadPool threadPool(2);
+        std::atomic_uint readCount = 0u;
+        OrderedReadAhead<Item> readAhead(
+            threadPool,
+            3u,
+            2u,
+            25u,
+            [](const size_t index, Item& item)
+            {
+                item.m_index = index;
+                return 100u;
+            },
+            [&readCount](Item&)
+            {
+                ++readCount;
+            });
+
+        for (auto i = 0u; i < 3u; i++)
+        {
+            const auto item = readAhead.Next();
+
+            REQUIRE(item);
+            REQUIRE(item->m_index == i);
+            REQUIRE(readCount == i + 1u);
+        }
+    }
+
+    TEST_CASE("OrderedReadAhead: Rethrows errors when taking the item that failed to read", "[utils]")
+    {
+        ThreadPool threadPool(2);
+        OrderedReadAhead<Item> readAhead(
+            threadPool,
+            3u,
+            2u,
+            1024u,
+            [](const size_t index, Item& item)
+            {
+                item.m_index = index;
+                return 1u;
+            },
+            [](const Item& item)
+            {
+                if (item.m_index == 1u)
+                    throw std::runtime_error("read failed");
+            });
+
+        REQUIRE(readAhead.Next()->m_index == 0u);
+        REQUIRE_THROWS_AS(readAhead.Next(), std::runtime_error);
+        REQUIRE(readAhead.Next()->m_index == 2u);
+    }
+} // namespace utils::ordered_read_ahead
@@ -0,0 +1,95 @@
+#include "Dumping/AssetDumpingContext.h"
+#include "Game/IW4/GameAssetPoolIW4.h"
+#include "Game/IW4/GameIW4.h"
+#include "Game/IW4/ZoneDumperIW4.h"
+#include "Obj/Gdt/GdtStream.h"
+#include "Utils/ThreadPool.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace IW4;
+
+namespace game::iw4::zone_dumper
+{
+    constexpr auto ASSET_COUNT = 200u;
+
+    class TestZone
+    {
+    public:
+        Zone m_zone;
+        std::vector<std::string> m_names;
+        std::vector<PhysPreset> m_phys_presets;
+        std::vector<TracerDef> m_tracers;
+
+        TestZone()
+            : m_zone("test_zone", 0, &g_GameIW4),
+              m_phys_presets(ASSET_COUNT),
+              m_tracers(ASSET_COUNT)
+        {
+            auto pools = std::make_unique<GameAssetPoolIW4>(&m_zone, 0, false);
+            pools->InitPoolDynamic(ASSET_TYPE_PHYSPRESET);
+            pools->InitPoolDynamic(ASSET_TYPE_TRACER);
+            m_zone.m_pools = std::move(pools);
+
+            m_names.reserve(ASSET_COUNT * 2u);
+            for (auto i = 0u; i < ASSET_COUNT; i++)
+            {
+                const auto& physPresetName = m_names.emplace_back("phys_preset_" + std::to_string(i));
+                auto& physPreset = m_phys_presets[i];
+                physPreset = {};
+                physPreset.name = physPresetName.c_str();
+                physPreset.mass = static_cast<float>(i);
+                physPreset.sndAliasPrefix = "";
+                m_zone.m_pools->AddAsset(ASSET_TYPE_PHYSPRESET, physPresetName, &physPreset, {}, {}, {});
+
+                const auto& tracerName = m_names.emplace_back("tracer_" + std::to_string(i));
+                auto& tracer = m_tracers[i];
+                tracer = {};
+                tracer.name = tracerName.c_str();
+                tracer.speed = static_cast<float>(i);
+                m_zone.m_pools->AddAsset(ASSET_TYPE_TRACER, tracerName, &tracer, {}, {}, {});
+            }
+        }
+    };
+
+    std::string DumpGdt(Zone& zone, ThreadPool* threadPool)
+    {
+        std::ostringstream stream;
+
+        AssetDumpingContext context;
+        context.m_zone = &zone;
+        context.m_thread_pool = threadPool;
+        context.m_gdt = std::make_unique<GdtOutputStream>(stream);
+
+        context.m_gdt->BeginStream();
+        REQUIRE(ZoneDumper().DumpZone(context));
+        context.m_gdt->EndStream();
+
+        return stream.str();
+    }
+
+    TEST_CASE("ZoneDumper(IW4): Dumps the same gdt regardless of the amount of threads", "[iw4][dumping][gdt]")
+    {
+        TestZone zone;
+
+        const auto serialGdt = DumpGdt(zone.m_zone, nullptr);
+
+        // Entries are written in the order of the pools and their assets
+        const auto firstPhysPreset = serialGdt.find("\"phys_preset_0\"");
+        const auto lastPhysPreset = serialGdt.find("\"phys_preset_" + std::to_string(ASSET_COUNT - 1u) + "\"");
+        const auto firstTracer = serialGdt.find("\"tracer_0\"");
+        REQUIRE(firstPhysPreset != std::string::npos);
+        REQUIRE(lastPhysPreset != std::string::npos);
+        REQUIRE(firstTracer != std::string::npos);
+        REQUIRE(firstPhysPreset < lastPhysPreset);
+        REQUIRE(lastPhysPreset < firstTracer);
+
+        ThreadPool threadPool(8);
+        for (auto i = 0; i < 5; i++)
+            REQUIRE(DumpGdt(zone.m_zone, &threadPool) == serialGdt);
+    }
+} // namespace game::iw4::zone_dumper
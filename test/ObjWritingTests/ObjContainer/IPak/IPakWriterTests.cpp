@@ -0,0 +1,306 @@
+#include "Game/T6/CommonT6.h"
+#include "ObjContainer/IPak/IPakTypes.h"
+#include "ObjContainer/IPak/IPakWriter.h"
+#include "ObjWriting.h"
+#include "Utils/ThreadPool.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <minilzo.h>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <zlib.h>
+
+namespace fs = std::filesystem;
+
+namespace obj_container::ipak_writer
+{
+    class InMemorySearchPath final : public ISearchPath
+    {
+        std::map<std::string, std::string> m_files;
+
+    public:
+        void AddFile(std::string fileName, std::string data)
+        {
+            m_files.emplace(std::move(fileName), std::move(data));
+        }
+
+        SearchPathOpenFile Open(const std::string& fileName) override
+        {
+            const auto foundFile = m_files.find(fileName);
+            if (foundFile == m_files.end())
+                return {};
+
+            return {std::make_unique<std::istringstream>(foundFile->second), static_cast<int64_t>(foundFile->second.size())};
+        }
+
+        std::string GetPath() override
+        {
+            return "InMemory";
+        }
+
+        void Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback) override {}
+    };
+
+    class TestImage
+    {
+    public:
+        std::string m_name;
+        std::string m_data;
+    };
+
+    std::string CreateRandomData(const size_t size, uint32_t seed)
+    {
+        std::string data(size, '\0');
+        for (auto& c : data)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            c = static_cast<char>(seed >> 24);
+        }
+
+        return data;
+    }
+
+    std::string CreateCompressibleData(const size_t size)
+    {
+        static const std::string PATTERN = "The quick brown fox jumps over the lazy dog. ";
+
+        std::string data;
+        data.reserve(size);
+        for (auto i = 0u; data.size() < size; i++)
+            data += PATTERN + std::to_string(i);
+        data.resize(size);
+
+        return data;
+    }
+
+    /**
+     * \brief Creates data that alternates between runs that compress well and ones that do not, so that commands end up with varying compressed sizes.
+     */
+    std::string CreateMixedData(const size_t size)
+    {
+        std::string data;
+        data.reserve(size);
+        for (auto i = 0u; data.size() < size; i++)
+        {
+            const auto runSize = 0x1000u + (i * 0x2E3u) % 0x6000u;
+            data += i % 2u == 0u ? CreateRandomData(runSize, i) : std::string(runSize, static_cast<char>(i));
+        }
+        data.resize(size);
+
+        return data;
+    }
+
+    std::vector<TestImage> CreateTestImages()
+    {
+        return {
+            {"compressible", CreateCompressibleData(700u * 1024u)},
+            {"random",       CreateRandomData(300u * 1024u, 1u)  },
+            {"mixed",        CreateMixedData(900u * 1024u)       },
+            {"small",        CreateCompressibleData(100u)        },
+        };
+    }
+
+    std::string WriteIPak(const std::vector<TestImage>& images, ThreadPool* threadPool)
+    {
+        InMemorySearchPath searchPath;
+        for (const auto& image : images)
+            searchPath.AddFile("images/" + image.m_name + ".iwi", image.m_data);
+
+        // The writer seeks past the end of the data it has written so far, which string streams do not support
+        const auto path = fs::temp_directory_path() / "oat_ipak_writer_test.ipak";
+        {
+            std::ofstream stream(path, std::ios::out | std::ios::binary);
+            REQUIRE(stream.is_open());
+
+            ObjWriting::Configuration.IPakThreadPool = threadPool;
+            const auto writer = IPakWriter::Create(stream, &searchPath);
+            ObjWriting::Configuration.IPakThreadPool = nullptr;
+
+            for (const auto& image : images)
+                writer->AddImage(image.m_name);
+
+            REQUIRE(writer->Write());
+        }
+
+        std::ifstream stream(path, std::ios::in | std::ios::binary);
+        std::ostringstream data;
+        data << stream.rdbuf();
+        stream.close();
+
+        fs::remove(path);
+
+        return data.str();
+    }
+
+    std::string CompressSerially(const char* data, const size_t dataSize)
+    {
+        const auto workBuffer = std::make_unique<char[]>(LZO1X_1_MEM_COMPRESS);
+        std::string output(dataSize + dataSize / 16u + 64u + 3u, '\0');
+
+        auto outLen = static_cast<lzo_uint>(0u);
+        REQUIRE(lzo1x_1_compress(reinterpret_cast<const unsigned char*>(data),
+                                 dataSize,
+                                 reinterpret_cast<unsigned char*>(output.data()),
+                                 &outLen,
+                                 workBuffer.get())
+                == LZO_E_OK);
+        output.resize(outLen);
+
+        return output;
+    }
+
+    /**
+     * \brief Walks all blocks of an entry and requires every command to hold exactly the data that compressing it on the calling thread results in.
+     */
+    void VerifyEntryData(const std::string& ipak, const size_t entryOffset, const size_t entrySize, const std::string& imageData)
+    {
+        std::string decompressed(ipak_consts::IPAK_COMMAND_DEFAULT_SIZE, '\0');
+        const auto entryEnd = entryOffset + entrySize;
+        REQUIRE(entryEnd <= ipak.size());
+
+        auto offset = entryOffset;
+        auto dataOffset = 0u;
+        while (offset < entryEnd)
+        {
+            REQUIRE(offset % sizeof(IPakDataBlockHeader) == 0u);
+
+            IPakDataBlockHeader blockHeader;
+            memcpy(&blockHeader, &ipak[offset], sizeof(blockHeader));
+            offset += sizeof(blockHeader);
+
+            const auto commandCount = blockHeader.countAndOffset.count;
+            REQUIRE(commandCount > 0u);
+            REQUIRE(commandCount <= std::extent_v<decltype(IPakDataBlockHeader::commands)>);
+
+            if (blockHeader.commands[0].compressed != ipak_consts::IPAK_COMMAND_SKIP)
+                REQUIRE(blockHeader.countAndOffset.offset == dataOffset);
+
+            for (auto commandIndex = 0u; commandIndex < commandCount; commandIndex++)
+            {
+                const auto& command = blockHeader.commands[commandIndex];
+                REQUIRE(offset + command.size <= ipak.size());
+
+                const auto* commandData = &ipak[offset];
+                offset += command.size;
+
+                if (command.compressed == ipak_consts::IPAK_COMMAND_SKIP)
+                    continue;
+
+                if (command.compressed == ipak_consts::IPAK_COMMAND_COMPRESSED)
+                {
+                    auto outLen = static_cast<lzo_uint>(decompressed.size());
+                    REQUIRE(lzo1x_decompress_safe(reinterpret_cast<const unsigned char*>(commandData),
+                                                  command.size,
+                                                  reinterpret_cast<unsigned char*>(decompressed.data()),
+                                                  &outLen,
+                                                  nullptr)
+                            == LZO_E_OK);
+                    REQUIRE(dataOffset + outLen <= imageData.size());
+                    REQUIRE(memcmp(decompressed.data(), &imageData[dataOffset], outLen) == 0);
+
+                    const auto serialOutput = CompressSerially(&imageData[dataOffset], outLen);
+                    REQUIRE(serialOutput == std::string(commandData, command.size));
+
+                    dataOffset += outLen;
+                }
+                else
+                {
+                    REQUIRE(command.compressed == ipak_consts::IPAK_COMMAND_UNCOMPRESSED);
+                    REQUIRE(dataOffset + command.size <= imageData.size());
+                    REQUIRE(memcmp(commandData, &imageData[dataOffset], command.size) == 0);
+
+                    // Data is only stored uncompressed when compressing it does not make it smaller
+                    REQUIRE(CompressSerially(&imageData[dataOffset], command.size).size() >= command.size);
+
+                    dataOffset += command.size;
+                }
+            }
+
+            offset = (offset + sizeof(IPakDataBlockHeader) - 1u) / sizeof(IPakDataBlockHeader) * sizeof(IPakDataBlockHeader);
+        }
+
+        REQUIRE(dataOffset == imageData.size());
+    }
+
+    void VerifyIPak(const std::string& ipak, const std::vector<TestImage>& images)
+    {
+        REQUIRE(ipak.size() >= sizeof(IPakHeader) + sizeof(IPakSection) * 3u);
+
+        IPakHeader header;
+        memcpy(&header, ipak.data(), sizeof(header));
+        REQUIRE(header.magic == ipak_consts::IPAK_MAGIC);
+        REQUIRE(header.version == ipak_consts::IPAK_VERSION);
+        REQUIRE(header.size == ipak.size());
+        REQUIRE(header.sectionCount == 3u);
+
+        IPakSection dataSection{};
+        IPakSection indexSection{};
+        for (auto sectionIndex = 0u; sectionIndex < header.sectionCount; sectionIndex++)
+        {
+            IPakSection section;
+            memcpy(&section, &ipak[sizeof(header) + sizeof(section) * sectionIndex], sizeof(section));
+
+            if (section.type == ipak_consts::IPAK_DATA_SECTION)
+                dataSection = section;
+            else if (section.type == ipak_consts::IPAK_INDEX_SECTION)
+                indexSection = section;
+        }
+
+        REQUIRE(indexSection.itemCount == images.size());
+        REQUIRE(indexSection.offset + indexSection.size <= ipak.size());
+
+        for (auto entryIndex = 0u; entryIndex < indexSection.itemCount; entryIndex++)
+        {
+            IPakIndexEntry entry;
+            memcpy(&entry, &ipak[indexSection.offset + sizeof(entry) * entryIndex], sizeof(entry));
+
+            const TestImage* entryImage = nullptr;
+            for (const auto& image : images)
+            {
+                if (T6::Common::R_HashString(image.m_name.c_str(), 0) == entry.key.nameHash)
+                    entryImage = &image;
+            }
+
+            REQUIRE(entryImage != nullptr);
+
+            const auto dataHash = static_cast<uint32_t>(crc32(0u, reinterpret_cast<const Bytef*>(entryImage->m_data.data()), static_cast<uInt>(entryImage->m_data.size())));
+            REQUIRE(entry.key.dataHash == (dataHash & 0x1FFFFFFF));
+
+            VerifyEntryData(ipak, dataSection.offset + entry.offset, entry.size, entryImage->m_data);
+        }
+    }
+
+    TEST_CASE("IPakWriter: Writes the same commands as compressing them on the writing thread", "[ipak]")
+    {
+        REQUIRE(lzo_init() == LZO_E_OK);
+
+        const auto images = CreateTestImages();
+
+        ThreadPool threadPool(8);
+        const auto ipak = WriteIPak(images, &threadPool);
+
+        VerifyIPak(ipak, images);
+    }
+
+    TEST_CASE("IPakWriter: Output does not depend on the thread pool", "[ipak]")
+    {
+        const auto images = CreateTestImages();
+
+        ThreadPool singleThreadPool(1);
+        const auto expectedIPak = WriteIPak(images, &singleThreadPool);
+
+        ThreadPool threadPool(8);
+        REQUIRE(WriteIPak(images, &threadPool) == expectedIPak);
+
+        // Without a thread pool to share, the writer creates its own one
+        REQUIRE(WriteIPak(images, nullptr) == expectedIPak);
+    }
+} // namespace obj_container::ipak_writer
@@ -0,0 +1,196 @@
+#include "Parsing/Impl/CommentRemovingStreamProxy.h"
+#include "Parsing/Impl/DefinesStreamProxy.h"
+#include "Parsing/Impl/IncludingStreamProxy.h"
+#include "Parsing/Impl/ParserMultiInputStream.h"
+#include "Parsing/Impl/PreprocessedIncludeCache.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace test::parsing::impl::preprocessed_include_cache
+{
+    class PreprocessedLine
+    {
+    public:
+        std::string m_filename;
+        int m_line_number;
+        std::string m_line;
+
+        friend bool operator==(const PreprocessedLine& lhs, const PreprocessedLine& rhs)
+        {
+            return lhs.m_filename == rhs.m_filename && lhs.m_line_number == rhs.m_line_number && lhs.m_line == rhs.m_line;
+        }
+    };
+
+    std::vector<PreprocessedLine>
+        Preprocess(const std::string& content, const std::map<std::string, std::string>& includes, PreprocessedIncludeCache* cache, unsigned& includeCount)
+    {
+        std::istringstream mainStream(content);
+        DefinesStreamProxy* definesProxy = nullptr;
+
+        ParserMultiInputStream baseStream(mainStream,
+                                          "main.menu",
+                                          [&](const std::string& filename, const std::string& sourceFile) -> std::unique_ptr<std::istream>
+                                          {
+                                              const auto foundInclude = includes.find(filename);
+                                              if (foundInclude == includes.end())
+                                                  return nullptr;
+
+                                              includeCount++;
+                                              std::istringstream includeStream(foundInclude->second);
+                                              if (cache)
+                                                  return cache->OpenInclude(includeStream, *definesProxy);
+                                              return std::make_unique<std::istringstream>(foundInclude->second);
+                                          });
+        CommentRemovingStreamProxy commentProxy(&baseStream);
+        IncludingStreamProxy includingProxy(&commentProxy);
+        DefinesStreamProxy proxy(&includingProxy);
+        definesProxy = &proxy;
+
+        proxy.AddDefine(DefinesStreamProxy::Define("PC", "1"));
+
+        std::vector<PreprocessedLine> result;
+        while (!proxy.Eof())
+        {
+            auto line = proxy.NextLine();
+            if (line.IsEof())
+                break;
+
+            result.emplace_back(*line.m_filename, line.m_line_number, line.m_line);
+        }
+
+        return result;
+    }
+
+    const std::map<std::string, std::string> INCLUDES{
+        {"ui/menudefinition.h",
+         "// Shared menu definitions\n"
+         "#define ITEM_TYPE_TEXT 0\n"
+         "#define ITEM_TYPE_BUTTON 1\n"
+         "#define COLOR(r, g, b) r g b 1\n"
+         "#ifdef PC\n"
+         "#define PLATFORM \"pc\"\n"
+         "#else\n"
+         "#define PLATFORM \"console\"\n"
+         "#endif\n"
+         "/* block\n"
+         "   comment */\n"
+         "shared ITEM_TYPE_BUTTON\n"},
+        {"ui/nested.h",
+         "#include \"ui/menudefinition.h\"\n"
+         "#define NESTED 1\n"},
+        {"ui/first.h",
+         "#define FIRST 1\n"
+         "first FIRST\n"},
+        {"ui/second.h",
+         "#define SECOND 2\n"
+         "second SECOND\n"},
+        {"ui/lines.h", "lines\n"},
+    };
+
+    TEST_CASE("PreprocessedIncludeCache: Seeds later readers from snapshot of included file", "[parsing][parsingstream]")
+    {
+        const std::string menuFile = "#include \"ui/menudefinition.h\"\n"
+                                     "type ITEM_TYPE_TEXT\n"
+                                     "backcolor COLOR(1, 0, 0)\n"
+                                     "platform PLATFORM\n";
+
+        unsigned includeCount = 0;
+        const auto expected = Preprocess(menuFile, INCLUDES, nullptr, includeCount);
+
+        PreprocessedIncludeCache cache;
+        const auto first = Preprocess(menuFile, INCLUDES, &cache, includeCount);
+        REQUIRE(cache.GetSnapshotCount() == 1u);
+
+        const auto second = Preprocess(menuFile, INCLUDES, &cache, includeCount);
+        REQUIRE(cache.GetSnapshotCount() == 1u);
+
+        REQUIRE(first == expected);
+        REQUIRE(second == expected);
+        REQUIRE(expected.back().m_line == "platform \"pc\"");
+    }
+
+    TEST_CASE("PreprocessedIncludeCache: Takes separate snapshots for different define states", "[parsing][parsingstream]")
+    {
+        const std::string firstMenuFile = "#include \"ui/menudefinition.h\"\n"
+                                          "platform PLATFORM\n";
+        const std::string secondMenuFile = "#undef PC\n"
+                                           "#include \"ui/menudefinition.h\"\n"
+                                           "platform PLATFORM\n";
+
+        unsigned includeCount = 0;
+        PreprocessedIncludeCache cache;
+        const auto first = Preprocess(firstMenuFile, INCLUDES, &cache, includeCount);
+        const auto second = Preprocess(secondMenuFile, INCLUDES, &cache, includeCount);
+
+        REQUIRE(cache.GetSnapshotCount() == 2u);
+        REQUIRE(first.back().m_line == "platform \"pc\"");
+        REQUIRE(second.back().m_line == "platform \"console\"");
+    }
+
+    TEST_CASE("PreprocessedIncludeCache: Does not take snapshots of files including other files", "[parsing][parsingstream]")
+    {
+        const std::string menuFile = "#include \"ui/nested.h\"\n"
+                                     "value NESTED ITEM_TYPE_BUTTON\n";
+
+        unsigned includeCount = 0;
+        const auto expected = Preprocess(menuFile, INCLUDES, nullptr, includeCount);
+
+        PreprocessedIncludeCache cache;
+        const auto first = Preprocess(menuFile, INCLUDES, &cache, includeCount);
+        const auto second = Preprocess(menuFile, INCLUDES, &cache, includeCount);
+
+        REQUIRE(cache.GetSnapshotCount() == 1u);
+        REQUIRE(first == expected);
+        REQUIRE(second == expected);
+        REQUIRE(expected.back().m_line == "value 1 1");
+    }
+
+    TEST_CASE("PreprocessedIncludeCache: Takes snapshots of includes following each other", "[parsing][parsingstream]")
+    {
+        const std::string menuFile = "#include \"ui/first.h\"\n"
+                                     "#include \"ui/second.h\"\n"
+                                     "value FIRST SECOND\n";
+
+        unsigned includeCount = 0;
+        const auto expected = Preprocess(menuFile, INCLUDES, nullptr, includeCount);
+
+        PreprocessedIncludeCache cache;
+        const auto first = Preprocess(menuFile, INCLUDES, &cache, includeCount);
+        REQUIRE(cache.GetSnapshotCount() == 2u);
+
+        const auto second = Preprocess(menuFile, INCLUDES, &cache, includeCount);
+        REQUIRE(cache.GetSnapshotCount() == 2u);
+
+        REQUIRE(first == expected);
+        REQUIRE(second == expected);
+        REQUIRE(expected.back().m_line == "value 1 2");
+    }
+
+    TEST_CASE("PreprocessedIncludeCache: Does not record defines of a cached include into the snapshot of the previous include", "[parsing][parsingstream]")
+    {
+        const std::string secondOnlyMenuFile = "#include \"ui/second.h\"\n";
+        const std::string bothMenuFile = "#include \"ui/lines.h\"\n"
+                                         "#include \"ui/second.h\"\n"
+                                         "value SECOND\n";
+        const std::string linesOnlyMenuFile = "#include \"ui/lines.h\"\n"
+                                              "value SECOND\n";
+
+        unsigned includeCount = 0;
+        const auto expected = Preprocess(linesOnlyMenuFile, INCLUDES, nullptr, includeCount);
+
+        PreprocessedIncludeCache cache;
+        Preprocess(secondOnlyMenuFile, INCLUDES, &cache, includeCount);
+        const auto both = Preprocess(bothMenuFile, INCLUDES, &cache, includeCount);
+        REQUIRE(cache.GetSnapshotCount() == 2u);
+
+        const auto linesOnly = Preprocess(linesOnlyMenuFile, INCLUDES, &cache, includeCount);
+
+        REQUIRE(both.back().m_line == "value 2");
+        REQUIRE(linesOnly == expected);
+        REQUIRE(expected.back().m_line == "value SECOND");
+    }
+} // namespace test::parsing::impl::preprocessed_include_cache
@@ -0,0 +1,70 @@
+#include "Parsing/Mock/MockSequence.h"
+#include "Parsing/Sequence/SequenceDispatchTable.h"
+#include "Parsing/Simple/Matcher/SimpleMatcherFactory.h"
+#include "Parsing/Simple/SimpleParserValue.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <vector>
+
+namespace test::parsing::sequence::sequence_dispatch_table
+{
+    typedef MockSequence<SimpleParserValue> sequence_t;
+    typedef SequenceDispatchTable<SimpleParserValue, MockSequenceState> dispatch_table_t;
+
+    class DispatchTableTestsHelper
+    {
+    public:
+        std::vector<std::unique_ptr<sequence_t>> m_all_sequences;
+        std::vector<dispatch_table_t::sequence_t*> m_sequences;
+
+        sequence_t* AddSequence(std::initializer_list<Movable<std::unique_ptr<AbstractMatcher<SimpleParserValue>>>> matchers)
+        {
+            auto sequence = std::make_unique<sequence_t>();
+            sequence->AddMockMatchers(matchers);
+
+            auto* result = sequence.get();
+            m_sequences.emplace_back(result);
+            m_all_sequences.emplace_back(std::move(sequence));
+
+            return result;
+        }
+    };
+
+    TEST_CASE("SequenceDispatchTable: Dispatches on the leading matcher of sequences", "[parsing][sequence]")
+    {
+        DispatchTableTestsHelper helper;
+        const SimpleMatcherFactory create(nullptr);
+        const TokenPos pos;
+
+        auto* keyword = helper.AddSequence({create.Keyword("rect"), create.Integer()});
+        auto* keywordIgnoreCase = helper.AddSequence({create.KeywordIgnoreCase("Name"), create.String()});
+        auto* anyIdentifier = helper.AddSequence({create.Identifier()});
+        auto* character = helper.AddSequence({create.Char('{')});
+        auto* either = helper.AddSequence({create.Or({create.Char('}'), create.Keyword("end")})});
+        auto* undispatched = helper.AddSequence({create.Optional(create.Char(';')), create.Identifier()});
+
+        const dispatch_table_t table(helper.m_sequences);
+
+        const auto rectToken = SimpleParserValue::Identifier(pos, new std::string("rect"));
+        REQUIRE(table.GetCandidates(rectToken) == std::vector<dispatch_table_t::sequence_t*>{keyword, anyIdentifier, undispatched});
+
+        const auto nameToken = SimpleParserValue::Identifier(pos, new std::string("NAME"));
+        REQUIRE(table.GetCandidates(nameToken) == std::vector<dispatch_table_t::sequence_t*>{keywordIgnoreCase, anyIdentifier, undispatched});
+
+        const auto otherToken = SimpleParserValue::Identifier(pos, new std::string("other"));
+        REQUIRE(table.GetCandidates(otherToken) == std::vector<dispatch_table_t::sequence_t*>{anyIdentifier, undispatched});
+
+        const auto openToken = SimpleParserValue::Character(pos, '{');
+        REQUIRE(table.GetCandidates(openToken) == std::vector<dispatch_table_t::sequence_t*>{character, undispatched});
+
+        const auto closeToken = SimpleParserValue::Character(pos, '}');
+        REQUIRE(table.GetCandidates(closeToken) == std::vector<dispatch_table_t::sequence_t*>{either, undispatched});
+
+        const auto endToken = SimpleParserValue::Identifier(pos, new std::string("end"));
+        REQUIRE(table.GetCandidates(endToken) == std::vector<dispatch_table_t::sequence_t*>{anyIdentifier, either, undispatched});
+
+        const auto integerToken = SimpleParserValue::Integer(pos, 5);
+        REQUIRE(table.GetCandidates(integerToken) == std::vector<dispatch_table_t::sequence_t*>{undispatched});
+    }
+} // namespace test::parsing::sequence::sequence_dispatch_table
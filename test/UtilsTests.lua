@@ -0,0 +1,52 @@
+UtilsTests = {}
+
+function UtilsTests:include(includes)
+	if includes:handle(self:name()) then
+		includedirs {
+			path.join(TestFolder(), "UtilsTests")
+		}
+	end
+end
+
+function UtilsTests:link(links)
+	
+end
+
+function UtilsTests:use()
+	
+end
+
+function UtilsTests:name()
+    return "UtilsTests"
+end
+
+function UtilsTests:project()
+	local folder = TestFolder()
+	local includes = Includes:create()
+	local links = Links:create()
+
+	project(self:name())
+        targetdir(TargetDirectoryTest)
+		location "%{wks.location}/test/%{prj.name}"
+		kind "ConsoleApp"
+		language "C++"
+		
+		files {
+			path.join(folder, "UtilsTests/**.h"), 
+			path.join(folder, "UtilsTests/**.cpp")
+		}
+		
+        vpaths {
+			["*"] = {
+				path.join(folder, "UtilsTests")
+			}
+		}
+		
+		self:include(includes)
+		Utils:include(includes)
+		catch2:include(includes)
+
+		links:linkto(Utils)
+		links:linkto(catch2)
+		links:linkall()
+end
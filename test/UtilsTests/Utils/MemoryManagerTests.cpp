@@ -0,0 +1,183 @@
+#include "Utils/MemoryManager.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace utils::memory_manager
+{
+    class DestructionRecorder
+    {
+    public:
+        std::vector<int>& m_destroyed;
+        int m_id;
+
+        DestructionRecorder(std::vector<int>& destroyed, const int id)
+            : m_destroyed(destroyed),
+              m_id(id)
+        {
+        }
+
+        ~DestructionRecorder()
+        {
+            m_destroyed.emplace_back(m_id);
+        }
+
+        DestructionRecorder(const DestructionRecorder& other) = delete;
+        DestructionRecorder(DestructionRecorder&& other) noexcept = delete;
+        DestructionRecorder& operator=(const DestructionRecorder& other) = delete;
+        DestructionRecorder& operator=(DestructionRecorder&& other) noexcept = delete;
+    };
+
+    bool IsZeroed(const void* data, const size_t size)
+    {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        for (auto i = 0u; i < size; i++)
+        {
+            if (bytes[i] != 0u)
+                return false;
+        }
+
+        return true;
+    }
+
+    TEST_CASE("MemoryManager: Destroys created objects in the order they were created in", "[utils]")
+    {
+        std::vector<int> destroyed;
+
+        {
+            MemoryManager memory;
+            for (auto i = 0; i < 64; i++)
+            {
+                auto* recorder = memory.Create<DestructionRecorder>(destroyed, i);
+                if (i % 3 == 1)
+                    memory.Delete(recorder);
+            }
+
+            std::vector<int> deleted;
+            for (auto i = 1; i < 64; i += 3)
+                deleted.emplace_back(i);
+            REQUIRE(destroyed == deleted);
+            destroyed.clear();
+        }
+
+        std::vector<int> expected;
+        for (auto i = 0; i < 64; i++)
+        {
+            if (i % 3 != 1)
+                expected.emplace_back(i);
+        }
+        REQUIRE(destroyed == expected);
+    }
+
+    TEST_CASE("MemoryManager: Reserves exactly the requested memory without an arena", "[utils]")
+    {
+        MemoryManager memory;
+
+        auto* first = memory.AllocRaw(100u);
+        auto* second = memory.Dup("string");
+        auto* third = memory.Alloc<uint32_t>(4u);
+
+        REQUIRE(IsZeroed(first, 100u));
+        REQUIRE(std::string(second) == "string");
+        REQUIRE(IsZeroed(third, sizeof(uint32_t) * 4u));
+
+        const auto& statistics = memory.GetStatistics();
+        REQUIRE(statistics.m_allocation_count == 3u);
+        REQUIRE(statistics.m_bytes_requested == 100u + 7u + 16u);
+        REQUIRE(statistics.m_bytes_reserved == statistics.m_bytes_requested);
+
+        memory.Free(first);
+        memory.Free(second);
+        memory.Free(third);
+        REQUIRE(statistics.m_allocation_count == 3u);
+        REQUIRE(statistics.m_bytes_reserved == 0u);
+    }
+
+    TEST_CASE("MemoryManager: Serves small allocations from arena chunks", "[utils]")
+    {
+        constexpr size_t chunkSize = 1024u;
+        MemoryManager memory(chunkSize);
+        const auto& statistics = memory.GetStatistics();
+
+        std::vector<void*> allocations;
+        for (const auto size : {1u, 3u, 17u, 40u, 0u, 255u, 64u})
+        {
+            auto* allocation = memory.AllocRaw(size);
+            REQUIRE(reinterpret_cast<uintptr_t>(allocation) % MemoryManager::ARENA_ALIGNMENT == 0u);
+            REQUIRE(IsZeroed(allocation, size));
+
+            // Writing to every allocation must not touch any other one
+            memset(allocation, 0xFF, size);
+            allocations.emplace_back(allocation);
+        }
+
+        REQUIRE(statistics.m_allocation_count == 7u);
+        REQUIRE(statistics.m_bytes_requested == 1u + 3u + 17u + 40u + 0u + 255u + 64u);
+        REQUIRE(statistics.m_bytes_reserved == chunkSize);
+
+        // Arena allocations are only released with the memory manager
+        memory.Free(allocations[2]);
+        REQUIRE(statistics.m_bytes_reserved == chunkSize);
+
+        // Filling the chunk starts a new one
+        for (auto i = 0u; i < 8u; i++)
+            memory.AllocRaw(chunkSize / 4u);
+        REQUIRE(statistics.m_bytes_reserved == chunkSize * 3u);
+    }
+
+    TEST_CASE("MemoryManager: Allocates memory that would waste a large part of an arena chunk individually", "[utils]")
+    {
+        constexpr size_t chunkSize = 1024u;
+        MemoryManager memory(chunkSize);
+        const auto& statistics = memory.GetStatistics();
+
+        auto* small = memory.AllocRaw(chunkSize / 4u);
+        REQUIRE(statistics.m_bytes_reserved == chunkSize);
+
+        auto* large = memory.AllocRaw(chunkSize / 4u + 1u);
+        REQUIRE(IsZeroed(large, chunkSize / 4u + 1u));
+        REQUIRE(statistics.m_bytes_reserved == chunkSize + chunkSize / 4u + 1u);
+
+        auto* huge = memory.AllocRaw(chunkSize * 8u);
+        REQUIRE(IsZeroed(huge, chunkSize * 8u));
+        REQUIRE(statistics.m_bytes_reserved == chunkSize + chunkSize / 4u + 1u + chunkSize * 8u);
+
+        memory.Free(large);
+        memory.Free(huge);
+        memory.Free(small);
+        REQUIRE(statistics.m_bytes_requested == chunkSize / 4u + chunkSize / 4u + 1u + chunkSize * 8u);
+        REQUIRE(statistics.m_bytes_reserved == chunkSize);
+    }
+
+    TEST_CASE("MemoryManager: Frees and deletes many allocations in the order they were made in", "[utils]")
+    {
+        // Releasing the oldest allocation first was the worst case when allocations were searched linearly
+        constexpr auto allocationCount = 200000u;
+        MemoryManager memory;
+        const auto& statistics = memory.GetStatistics();
+
+        std::vector<void*> allocations;
+        std::vector<int*> objects;
+        allocations.reserve(allocationCount);
+        objects.reserve(allocationCount);
+        for (auto i = 0u; i < allocationCount; i++)
+        {
+            allocations.emplace_back(memory.AllocRaw(8u));
+            objects.emplace_back(memory.Create<int>(static_cast<int>(i)));
+        }
+
+        auto objectsIntact = true;
+        for (auto i = 0u; i < allocationCount; i++)
+        {
+            objectsIntact = objectsIntact && *objects[i] == static_cast<int>(i);
+            memory.Free(allocations[i]);
+            memory.Delete(objects[i]);
+        }
+
+        REQUIRE(objectsIntact);
+        REQUIRE(statistics.m_bytes_reserved == 0u);
+    }
+} // namespace utils::memory_manager
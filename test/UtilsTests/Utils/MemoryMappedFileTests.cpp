@@ -0,0 +1,106 @@
+#include "Utils/MemoryMappedFile.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace fs = std::filesystem;
+
+namespace utils::memory_mapped_file
+{
+    class TempFolder
+    {
+    public:
+        fs::path m_path;
+
+        TempFolder()
+            : m_path(fs::temp_directory_path() / "oat_memory_mapped_file_tests")
+        {
+            fs::remove_all(m_path);
+            fs::create_directories(m_path);
+        }
+
+        ~TempFolder()
+        {
+            std::error_code ec;
+            fs::remove_all(m_path, ec);
+        }
+
+        TempFolder(const TempFolder& other) = delete;
+        TempFolder(TempFolder&& other) noexcept = delete;
+        TempFolder& operator=(const TempFolder& other) = delete;
+        TempFolder& operator=(TempFolder&& other) noexcept = delete;
+
+        std::string WriteFile(const std::string& fileName, const std::string& data) const
+        {
+            const auto filePath = m_path / fileName;
+            std::ofstream stream(filePath, std::ios::binary);
+            stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+
+            return filePath.string();
+        }
+    };
+
+    TEST_CASE("MemoryMappedFile: Maps the whole file", "[utils]")
+    {
+        const TempFolder folder;
+        const std::string data("Some data\0with a null byte", 26);
+        const auto path = folder.WriteFile("file.bin", data);
+
+        MemoryMappedFile mappedFile;
+        REQUIRE(mappedFile.Open(path));
+        REQUIRE(mappedFile.IsOpen());
+        REQUIRE(mappedFile.Size() == data.size());
+        REQUIRE(memcmp(mappedFile.Data(), data.data(), data.size()) == 0);
+    }
+
+    TEST_CASE("MemoryMappedFile: Cannot map empty files", "[utils]")
+    {
+        const TempFolder folder;
+        const auto path = folder.WriteFile("empty.bin", std::string());
+
+        MemoryMappedFile mappedFile;
+        REQUIRE(!mappedFile.Open(path));
+        REQUIRE(!mappedFile.IsOpen());
+        REQUIRE(mappedFile.Data() == nullptr);
+        REQUIRE(mappedFile.Size() == 0u);
+    }
+
+    TEST_CASE("MemoryMappedFile: Cannot map files that do not exist", "[utils]")
+    {
+        const TempFolder folder;
+
+        MemoryMappedFile mappedFile;
+        REQUIRE(!mappedFile.Open((folder.m_path / "missing.bin").string()));
+        REQUIRE(!mappedFile.IsOpen());
+        REQUIRE(mappedFile.Data() == nullptr);
+        REQUIRE(mappedFile.Size() == 0u);
+    }
+
+    TEST_CASE("MemoryMappedFile: Closes the previous mapping when opening another file", "[utils]")
+    {
+        const TempFolder folder;
+        const auto firstPath = folder.WriteFile("first.bin", "First file");
+        const auto secondPath = folder.WriteFile("second.bin", "Second");
+        const auto emptyPath = folder.WriteFile("empty.bin", std::string());
+
+        MemoryMappedFile mappedFile;
+        REQUIRE(mappedFile.Open(firstPath));
+        REQUIRE(mappedFile.Open(secondPath));
+        REQUIRE(mappedFile.Size() == 6u);
+        REQUIRE(memcmp(mappedFile.Data(), "Second", 6u) == 0);
+
+        REQUIRE(!mappedFile.Open(emptyPath));
+        REQUIRE(!mappedFile.IsOpen());
+        REQUIRE(mappedFile.Size() == 0u);
+
+        REQUIRE(mappedFile.Open(firstPath));
+        mappedFile.Close();
+        REQUIRE(!mappedFile.IsOpen());
+        REQUIRE(mappedFile.Data() == nullptr);
+        REQUIRE(mappedFile.Size() == 0u);
+    }
+} // namespace utils::memory_mapped_file
@@ -0,0 +1,120 @@
+#include "Utils/TaskGroup.h"
+#include "Utils/ThreadPool.h"
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+#include <thread>
+
+namespace utils::task_group
+{
+    TEST_CASE("TaskGroup: Executes tasks on the calling thread without a thread pool", "[utils]")
+    {
+        TaskGroup group(nullptr);
+
+        std::thread::id executingThread;
+        group.Run(
+            [&executingThread]
+            {
+                executingThread = std::this_thread::get_id();
+            });
+
+        // Tasks are executed immediately, so they are done before waiting
+        REQUIRE(executingThread == std::this_thread::get_id());
+        group.Wait();
+    }
+
+    TEST_CASE("TaskGroup: Waits for all tasks of the group", "[utils]")
+    {
+        ThreadPool threadPool(4);
+        TaskGroup group(&threadPool);
+        std::atomic_uint executedCount = 0u;
+
+        for (auto i = 0u; i < 500u; i++)
+        {
+            group.Run(
+                [&executedCount]
+                {
+                    ++executedCount;
+                });
+        }
+
+        group.Wait();
+        REQUIRE(executedCount == 500u);
+    }
+
+    TEST_CASE("TaskGroup: Nested groups do not exhaust the thread pool", "[utils]")
+    {
+        // Every worker waits for a nested group, so nested tasks are only executed because waiting threads help
+        ThreadPool threadPool(2);
+        TaskGroup outerGroup(&threadPool);
+        std::atomic_uint executedCount = 0u;
+
+        for (auto i = 0u; i < 8u; i++)
+        {
+            outerGroup.Run(
+                [&threadPool, &executedCount]
+                {
+                    TaskGroup innerGroup(&threadPool);
+                    for (auto j = 0u; j < 8u; j++)
+                    {
+                        innerGroup.Run(
+                            [&executedCount]
+                            {
+                                ++executedCount;
+                            });
+                    }
+
+                    innerGroup.Wait();
+                });
+        }
+
+        outerGroup.Wait();
+        REQUIRE(executedCount == 64u);
+    }
+
+    TEST_CASE("TaskGroup: Rethrows exceptions of tasks when waiting", "[utils]")
+    {
+        ThreadPool threadPool(2);
+        TaskGroup group(&threadPool);
+        std::atomic_uint executedCount = 0u;
+
+        for (auto i = 0u; i < 10u; i++)
+        {
+            group.Run(
+                [i, &executedCount]
+                {
+                    if (i == 5u)
+                        throw std::runtime_error("Task failed");
+
+                    ++executedCount;
+                });
+        }
+
+        REQUIRE_THROWS_AS(group.Wait(), std::runtime_error);
+
+        // The other tasks still ran and the error was only thrown once
+        REQUIRE(executedCount == 9u);
+        REQUIRE_NOTHROW(group.Wait());
+    }
+
+    TEST_CASE("TaskGroup: Rethrows exceptions of nested groups", "[utils]")
+    {
+        ThreadPool threadPool(2);
+        TaskGroup outerGroup(&threadPool);
+
+        outerGroup.Run(
+            [&threadPool]
+            {
+                TaskGroup innerGroup(&threadPool);
+                innerGroup.Run(
+                    []
+                    {
+                        throw std::runtime_error("Nested task failed");
+                    });
+                innerGroup.Wait();
+            });
+
+        REQUIRE_THROWS_AS(outerGroup.Wait(), std::runtime_error);
+    }
+} // namespace utils::task_group
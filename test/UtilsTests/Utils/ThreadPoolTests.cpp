@@ -0,0 +1,106 @@
+#include "Utils/ThreadPool.h"
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace utils::thread_pool
+{
+    TEST_CASE("ThreadPool: Executes all tasks before it is destroyed", "[utils]")
+    {
+        std::atomic_uint executedCount = 0u;
+
+        {
+            ThreadPool threadPool(4);
+            REQUIRE(threadPool.GetThreadCount() == 4u);
+
+            for (auto i = 0u; i < 1000u; i++)
+            {
+                threadPool.Enqueue(
+                    [&executedCount]
+                    {
+                        ++executedCount;
+                    });
+            }
+        }
+
+        REQUIRE(executedCount == 1000u);
+    }
+
+    TEST_CASE("ThreadPool: Waits until queued and running tasks are done", "[utils]")
+    {
+        ThreadPool threadPool(2);
+        std::atomic_uint executedCount = 0u;
+
+        for (auto i = 0u; i < 100u; i++)
+        {
+            threadPool.Enqueue(
+                [&executedCount]
+                {
+                    std::this_thread::yield();
+                    ++executedCount;
+                });
+        }
+
+        threadPool.WaitForIdle();
+        REQUIRE(executedCount == 100u);
+    }
+
+    TEST_CASE("ThreadPool: Runs pending tasks on the calling thread", "[utils]")
+    {
+        ThreadPool threadPool(1);
+
+        // Keep the only worker busy so that the following task stays queued
+        std::mutex mutex;
+        std::condition_variable condition;
+        auto workerBlocked = false;
+        auto releaseWorker = false;
+        threadPool.Enqueue(
+            [&]
+            {
+                std::unique_lock lock(mutex);
+                workerBlocked = true;
+                condition.notify_all();
+                condition.wait(lock,
+                               [&releaseWorker]
+                               {
+                                   return releaseWorker;
+                               });
+            });
+
+        {
+            std::unique_lock lock(mutex);
+            condition.wait(lock,
+                           [&workerBlocked]
+                           {
+                               return workerBlocked;
+                           });
+        }
+
+        std::thread::id executingThread;
+        threadPool.Enqueue(
+            [&executingThread]
+            {
+                executingThread = std::this_thread::get_id();
+            });
+
+        REQUIRE(threadPool.RunPendingTask());
+        REQUIRE(executingThread == std::this_thread::get_id());
+        REQUIRE(!threadPool.RunPendingTask());
+
+        {
+            std::lock_guard lock(mutex);
+            releaseWorker = true;
+        }
+        condition.notify_all();
+        threadPool.WaitForIdle();
+    }
+
+    TEST_CASE("ThreadPool: Has at least one thread by default", "[utils]")
+    {
+        REQUIRE(ThreadPool::DefaultThreadCount() >= 1u);
+    }
+} // namespace utils::thread_pool
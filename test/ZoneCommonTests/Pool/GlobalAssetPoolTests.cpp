@@ -0,0 +1,77 @@
+#include "Pool/AssetPoolDynamic.h"
+#include "Pool/GlobalAssetPool.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <string>
+
+namespace pool::global_asset_pool
+{
+    struct TestAsset
+    {
+        int m_value;
+    };
+
+    XAssetInfo<TestAsset>* AddTestAsset(AssetPool<TestAsset>& pool, const std::string& name, const int value)
+    {
+        TestAsset asset{value};
+        return pool.AddAsset(std::make_unique<XAssetInfo<TestAsset>>(0, name, &asset));
+    }
+
+    TEST_CASE("GlobalAssetPool: Finds assets of linked pools by normalized name", "[zonecommon][pool]")
+    {
+        AssetPoolDynamic<TestAsset> pool(0, 0);
+        AddTestAsset(pool, "Some\\Asset", 1);
+
+        const auto* asset = GlobalAssetPool<TestAsset>::GetAssetByName("some/asset");
+        REQUIRE(asset != nullptr);
+        REQUIRE(asset->Asset()->m_value == 1);
+        REQUIRE(GlobalAssetPool<TestAsset>::GetAssetByName("other") == nullptr);
+    }
+
+    TEST_CASE("GlobalAssetPool: Prefers assets of pools with higher priority", "[zonecommon][pool]")
+    {
+        AssetPoolDynamic<TestAsset> lowPriorityPool(0, 0);
+        AssetPoolDynamic<TestAsset> highPriorityPool(1, 0);
+
+        AddTestAsset(highPriorityPool, "asset", 2);
+        AddTestAsset(lowPriorityPool, "asset", 1);
+
+        REQUIRE(GlobalAssetPool<TestAsset>::GetAssetByName("asset")->Asset()->m_value == 2);
+    }
+
+    TEST_CASE("GlobalAssetPool: Falls back to remaining pools when unlinking a pool", "[zonecommon][pool]")
+    {
+        auto lowPriorityPool = std::make_unique<AssetPoolDynamic<TestAsset>>(0, 0);
+        auto highPriorityPool = std::make_unique<AssetPoolDynamic<TestAsset>>(1, 0);
+
+        AddTestAsset(*lowPriorityPool, "asset", 1);
+        AddTestAsset(*highPriorityPool, "asset", 2);
+        AddTestAsset(*highPriorityPool, "other_asset", 3);
+
+        highPriorityPool.reset();
+
+        const auto* asset = GlobalAssetPool<TestAsset>::GetAssetByName("asset");
+        REQUIRE(asset != nullptr);
+        REQUIRE(asset->Asset()->m_value == 1);
+        REQUIRE(GlobalAssetPool<TestAsset>::GetAssetByName("other_asset") == nullptr);
+
+        lowPriorityPool.reset();
+
+        REQUIRE(GlobalAssetPool<TestAsset>::GetAssetByName("asset") == nullptr);
+    }
+
+    TEST_CASE("GlobalAssetPool: Does not find assets of pools that are not linked globally", "[zonecommon][pool]")
+    {
+        AssetPoolDynamic<TestAsset> unlinkedPool(1, 0, false);
+        AddTestAsset(unlinkedPool, "asset", 1);
+
+        REQUIRE(unlinkedPool.GetAsset("asset") != nullptr);
+        REQUIRE(GlobalAssetPool<TestAsset>::GetAssetByName("asset") == nullptr);
+
+        AssetPoolDynamic<TestAsset> linkedPool(0, 0);
+        AddTestAsset(linkedPool, "asset", 2);
+
+        REQUIRE(GlobalAssetPool<TestAsset>::GetAssetByName("asset")->Asset()->m_value == 2);
+    }
+} // namespace pool::global_asset_pool
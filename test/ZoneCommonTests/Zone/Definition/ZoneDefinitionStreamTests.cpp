@@ -0,0 +1,53 @@
+#include "Zone/Definition/ZoneDefinitionStream.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace zone_definition::zone_definition_stream
+{
+    std::unique_ptr<ZoneDefinition> ReadDefinition(const std::string& definition)
+    {
+        std::istringstream stream(definition);
+        ZoneDefinitionInputStream inputStream(stream, "test.zone", false);
+
+        return inputStream.ReadDefinition();
+    }
+
+    TEST_CASE("ZoneDefinitionInputStream: Reads referenced targets to build", "[zonedefinition]")
+    {
+        const auto definition = ReadDefinition(">type,none\n"
+                                               "build,first\n"
+                                               "build,second\n");
+        REQUIRE(definition);
+
+        REQUIRE(definition->m_targets_to_build.size() == 2u);
+        REQUIRE(definition->m_targets_to_build[0].m_name == "first");
+        REQUIRE(definition->m_targets_to_build[0].m_build_after.empty());
+        REQUIRE(definition->m_targets_to_build[1].m_name == "second");
+        REQUIRE(definition->m_targets_to_build[1].m_build_after.empty());
+    }
+
+    TEST_CASE("ZoneDefinitionInputStream: Reads targets that referenced targets are built after", "[zonedefinition]")
+    {
+        const auto definition = ReadDefinition(">type,none\n"
+                                               "build,first\n"
+                                               "build,second,after,first\n"
+                                               "build,third,after,first,after,second\n"
+                                               "rawfile,after\n");
+        REQUIRE(definition);
+
+        REQUIRE(definition->m_targets_to_build.size() == 3u);
+        REQUIRE(definition->m_targets_to_build[0].m_name == "first");
+        REQUIRE(definition->m_targets_to_build[0].m_build_after.empty());
+        REQUIRE(definition->m_targets_to_build[1].m_name == "second");
+        REQUIRE(definition->m_targets_to_build[1].m_build_after == std::vector<std::string>({"first"}));
+        REQUIRE(definition->m_targets_to_build[2].m_name == "third");
+        REQUIRE(definition->m_targets_to_build[2].m_build_after == std::vector<std::string>({"first", "second"}));
+
+        REQUIRE(definition->m_assets.size() == 1u);
+        REQUIRE(definition->m_assets[0].m_asset_type == "rawfile");
+        REQUIRE(definition->m_assets[0].m_asset_name == "after");
+    }
+} // namespace zone_definition::zone_definition_stream
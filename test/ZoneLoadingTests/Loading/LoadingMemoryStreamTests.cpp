@@ -0,0 +1,94 @@
+#include "Loading/LoadingMemoryStream.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace loading::loading_memory_stream
+{
+    std::vector<uint8_t> CreateData(const size_t size)
+    {
+        std::vector<uint8_t> data(size);
+        for (auto i = 0u; i < size; i++)
+            data[i] = static_cast<uint8_t>(i + 1u);
+
+        return data;
+    }
+
+    TEST_CASE("LoadingMemoryStream: Loads data and advances the position", "[zoneloading][stream]")
+    {
+        const auto data = CreateData(16u);
+        LoadingMemoryStream stream(data.data(), data.size(), 4u);
+        REQUIRE(stream.Pos() == 4);
+
+        uint8_t buffer[8]{};
+        REQUIRE(stream.Load(buffer, sizeof(buffer)) == sizeof(buffer));
+        REQUIRE(memcmp(buffer, &data[4], sizeof(buffer)) == 0);
+        REQUIRE(stream.Pos() == 12);
+
+        const auto span = stream.LoadSpan(2u);
+        REQUIRE(span.size() == 2u);
+        REQUIRE(span.data() == &data[12]);
+        REQUIRE(stream.Pos() == 14);
+    }
+
+    TEST_CASE("LoadingMemoryStream: Loads only the remaining data at the end", "[zoneloading][stream]")
+    {
+        const auto data = CreateData(10u);
+        LoadingMemoryStream stream(data.data(), data.size(), 6u);
+
+        uint8_t buffer[8]{};
+        REQUIRE(stream.Load(buffer, sizeof(buffer)) == 4u);
+        REQUIRE(memcmp(buffer, &data[6], 4u) == 0);
+        REQUIRE(stream.Pos() == 10);
+
+        REQUIRE(stream.Load(buffer, sizeof(buffer)) == 0u);
+        REQUIRE(stream.LoadSpan(sizeof(buffer)).empty());
+        REQUIRE(stream.LoadNullTerminated(buffer, sizeof(buffer)) == 0u);
+        REQUIRE(stream.Pos() == 10);
+    }
+
+    TEST_CASE("LoadingMemoryStream: Clamps offsets past the end of the data", "[zoneloading][stream]")
+    {
+        const auto data = CreateData(4u);
+        LoadingMemoryStream stream(data.data(), data.size(), 8u);
+        REQUIRE(stream.Pos() == 4);
+
+        uint8_t buffer[4]{};
+        REQUIRE(stream.Load(buffer, sizeof(buffer)) == 0u);
+        REQUIRE(stream.Pos() == 4);
+    }
+
+    TEST_CASE("LoadingMemoryStream: Loads nothing from empty data", "[zoneloading][stream]")
+    {
+        LoadingMemoryStream stream(nullptr, 0u, 0u);
+        REQUIRE(stream.Pos() == 0);
+
+        uint8_t buffer[4]{};
+        REQUIRE(stream.Load(buffer, sizeof(buffer)) == 0u);
+        REQUIRE(stream.LoadSpan(sizeof(buffer)).empty());
+        REQUIRE(stream.LoadNullTerminated(buffer, sizeof(buffer)) == 0u);
+        REQUIRE(stream.Pos() == 0);
+    }
+
+    TEST_CASE("LoadingMemoryStream: Loads null terminated strings up to and including the terminator", "[zoneloading][stream]")
+    {
+        const uint8_t data[]{'a', 'b', 0, 'c', 'd', 'e', 'f'};
+        LoadingMemoryStream stream(data, sizeof(data), 0u);
+
+        char buffer[8]{};
+        REQUIRE(stream.LoadNullTerminated(buffer, sizeof(buffer)) == 3u);
+        REQUIRE(memcmp(buffer, "ab", 3u) == 0);
+        REQUIRE(stream.Pos() == 3);
+
+        REQUIRE(stream.LoadNullTerminated(buffer, 2u) == 2u);
+        REQUIRE(memcmp(buffer, "cd", 2u) == 0);
+        REQUIRE(stream.Pos() == 5);
+
+        // Without a terminator the string ends with the data
+        REQUIRE(stream.LoadNullTerminated(buffer, sizeof(buffer)) == 2u);
+        REQUIRE(memcmp(buffer, "ef", 2u) == 0);
+        REQUIRE(stream.Pos() == 7);
+    }
+} // namespace loading::loading_memory_stream
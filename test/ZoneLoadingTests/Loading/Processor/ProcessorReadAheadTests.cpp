@@ -0,0 +1,165 @@
+#include "Loading/ILoadingStream.h"
+#include "Loading/Processor/ProcessorReadAhead.h"
+
+#include <algorithm>
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace loading::processor::processor_read_ahead
+{
+    class FakeLoadingStream final : public ILoadingStream
+    {
+    public:
+        std::vector<uint8_t> m_data;
+        size_t m_max_load_size;
+        size_t m_fail_offset;
+        std::atomic_size_t m_pos;
+
+        explicit FakeLoadingStream(std::vector<uint8_t> data, const size_t maxLoadSize = SIZE_MAX, const size_t failOffset = SIZE_MAX)
+            : m_data(std::move(data)),
+              m_max_load_size(maxLoadSize),
+              m_fail_offset(failOffset),
+              m_pos(0u)
+        {
+        }
+
+        size_t Load(void* buffer, const size_t length) override
+        {
+            const size_t pos = m_pos;
+            if (pos >= m_fail_offset)
+                throw std::runtime_error("Failed to load");
+
+            // Loads less than requested before reaching the end, but never past the offset that fails
+            const auto sizeToLoad = std::min({length, m_max_load_size, m_data.size() - pos, m_fail_offset - pos});
+            memcpy(buffer, &m_data[pos], sizeToLoad);
+            m_pos = pos + sizeToLoad;
+
+            return sizeToLoad;
+        }
+
+        int64_t Pos() override
+        {
+            return static_cast<int64_t>(m_pos.load());
+        }
+    };
+
+    std::vector<uint8_t> CreateData(const size_t size)
+    {
+        std::vector<uint8_t> data(size);
+        for (auto i = 0u; i < size; i++)
+            data[i] = static_cast<uint8_t>(i * 7u + 3u);
+
+        return data;
+    }
+
+    std::vector<uint8_t> CreateData(const std::string& str)
+    {
+        return std::vector<uint8_t>(str.begin(), str.end());
+    }
+
+    TEST_CASE("ProcessorReadAhead: Loads all data of streams that load less than requested", "[zoneloading][processor]")
+    {
+        const auto data = CreateData(1000u);
+        FakeLoadingStream stream(data, 3u);
+        ProcessorReadAhead readAhead(16u, 3u);
+        readAhead.SetBaseStream(&stream);
+
+        std::vector<uint8_t> loadedData(data.size());
+        size_t loadedSize = 0u;
+        size_t chunkSize = 1u;
+        while (loadedSize < loadedData.size())
+        {
+            const auto sizeToLoad = std::min(chunkSize, loadedData.size() - loadedSize);
+            REQUIRE(readAhead.Load(&loadedData[loadedSize], sizeToLoad) == sizeToLoad);
+            loadedSize += sizeToLoad;
+            REQUIRE(readAhead.Pos() >= static_cast<int64_t>(loadedSize));
+
+            chunkSize = chunkSize % 37u + 1u;
+        }
+
+        REQUIRE(loadedData == data);
+
+        uint8_t remainingData;
+        REQUIRE(readAhead.Load(&remainingData, sizeof(remainingData)) == 0u);
+    }
+
+    TEST_CASE("ProcessorReadAhead: Stops at the end of streams that are a multiple of the buffer size", "[zoneloading][processor]")
+    {
+        const auto data = CreateData(64u);
+        FakeLoadingStream stream(data);
+        ProcessorReadAhead readAhead(16u, 2u);
+        readAhead.SetBaseStream(&stream);
+
+        std::vector<uint8_t> loadedData(data.size() + 16u);
+        REQUIRE(readAhead.Load(loadedData.data(), loadedData.size()) == data.size());
+        loadedData.resize(data.size());
+        REQUIRE(loadedData == data);
+        REQUIRE(readAhead.Pos() == static_cast<int64_t>(data.size()));
+
+        uint8_t remainingData;
+        REQUIRE(readAhead.Load(&remainingData, sizeof(remainingData)) == 0u);
+        REQUIRE(readAhead.LoadNullTerminated(&remainingData, sizeof(remainingData)) == 0u);
+    }
+
+    TEST_CASE("ProcessorReadAhead: Loads null terminated data across buffers", "[zoneloading][processor]")
+    {
+        const std::string str("abcdefghij\0xyz\0", 15u);
+        FakeLoadingStream stream(CreateData(str), 3u);
+        ProcessorReadAhead readAhead(4u, 2u);
+        readAhead.SetBaseStream(&stream);
+
+        char loadedData[32];
+        REQUIRE(readAhead.LoadNullTerminated(loadedData, sizeof(loadedData)) == 11u);
+        REQUIRE(std::string(loadedData) == "abcdefghij");
+
+        REQUIRE(readAhead.LoadNullTerminated(loadedData, 2u) == 2u);
+        REQUIRE(std::string(loadedData, 2u) == "xy");
+
+        REQUIRE(readAhead.LoadNullTerminated(loadedData, sizeof(loadedData)) == 2u);
+        REQUIRE(std::string(loadedData) == "z");
+
+        REQUIRE(readAhead.LoadNullTerminated(loadedData, sizeof(loadedData)) == 0u);
+    }
+
+    TEST_CASE("ProcessorReadAhead: Throws errors of the base stream when the data that failed to load is consumed", "[zoneloading][processor]")
+    {
+        const auto data = CreateData(64u);
+        FakeLoadingStream stream(data, 3u, 10u);
+        ProcessorReadAhead readAhead(4u, 4u);
+        readAhead.SetBaseStream(&stream);
+
+        // The buffers before the one that failed to load are consumed normally
+        std::vector<uint8_t> loadedData(8u);
+        REQUIRE(readAhead.Load(loadedData.data(), loadedData.size()) == loadedData.size());
+        REQUIRE(std::equal(loadedData.begin(), loadedData.end(), data.begin()));
+
+        uint8_t failedData;
+        REQUIRE_THROWS_AS(readAhead.Load(&failedData, sizeof(failedData)), std::runtime_error);
+    }
+
+    TEST_CASE("ProcessorReadAhead: Stops loading ahead when destroyed while all buffers are loaded", "[zoneloading][processor]")
+    {
+        FakeLoadingStream stream(CreateData(1000u));
+
+        {
+            ProcessorReadAhead readAhead(4u, 2u);
+            readAhead.SetBaseStream(&stream);
+
+            uint8_t loadedData;
+            REQUIRE(readAhead.Load(&loadedData, sizeof(loadedData)) == 1u);
+
+            // The first buffer is still consumed, so loading ahead waits for it after loading the second one
+            while (stream.m_pos < 8u)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        REQUIRE(stream.m_pos == 8u);
+    }
+} // namespace loading::processor::processor_read_ahead
@@ -0,0 +1,165 @@
+#include "Loading/ILoadingStream.h"
+#include "Loading/Processor/ProcessorXChunks.h"
+#include "Writing/IWritingStream.h"
+#include "Writing/Processor/OutputProcessorXChunks.h"
+#include "Zone/XChunk/XChunkProcessorDeflate.h"
+#include "Zone/XChunk/XChunkProcessorInflate.h"
+#include "Zone/XChunk/XChunkProcessorSalsa20Decryption.h"
+#include "Zone/XChunk/XChunkProcessorSalsa20Encryption.h"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace loading::processor::processor_xchunks
+{
+    constexpr int STREAM_COUNT = 4;
+    constexpr size_t XCHUNK_SIZE = 0x8000;
+    constexpr size_t XCHUNK_MAX_WRITE_SIZE = XCHUNK_SIZE - 0x40;
+    constexpr size_t VANILLA_BUFFER_SIZE = 0x80000;
+
+    constexpr uint8_t SALSA20_KEY[]{
+        0x64, 0x1D, 0x8A, 0x2F, 0xE3, 0x1D, 0x3A, 0xA6, 0x36, 0x22, 0xBB, 0xC9, 0xCE, 0x85, 0x87, 0x22,
+        0x9D, 0x42, 0xB0, 0xF8, 0xED, 0x9B, 0x92, 0x41, 0x30, 0xBF, 0x88, 0xB6, 0x5E, 0xDC, 0x50, 0xBE,
+    };
+
+    class MemoryWritingStream final : public IWritingStream
+    {
+    public:
+        std::vector<uint8_t> m_data;
+
+        void Write(const void* buffer, const size_t length) override
+        {
+            const auto* bytes = static_cast<const uint8_t*>(buffer);
+            m_data.insert(m_data.end(), bytes, bytes + length);
+        }
+
+        void Flush() override {}
+
+        int64_t Pos() override
+        {
+            return static_cast<int64_t>(m_data.size());
+        }
+    };
+
+    class MemoryLoadingStream final : public ILoadingStream
+    {
+    public:
+        const std::vector<uint8_t>& m_data;
+        size_t m_pos;
+
+        explicit MemoryLoadingStream(const std::vector<uint8_t>& data)
+            : m_data(data),
+              m_pos(0u)
+        {
+        }
+
+        size_t Load(void* buffer, const size_t length) override
+        {
+            const auto sizeToLoad = std::min(length, m_data.size() - m_pos);
+            memcpy(buffer, &m_data[m_pos], sizeToLoad);
+            m_pos += sizeToLoad;
+
+            return sizeToLoad;
+        }
+
+        int64_t Pos() override
+        {
+            return static_cast<int64_t>(m_pos);
+        }
+    };
+
+    std::vector<uint8_t> CreateCompressibleData(const size_t size)
+    {
+        std::vector<uint8_t> data(size);
+        uint32_t state = 0x87654321u;
+        for (auto i = 0u; i < size; i++)
+        {
+            state = state * 1103515245u + 12345u;
+            data[i] = static_cast<uint8_t>(i % 89 < 50 ? i % 11 : state >> 24);
+        }
+
+        return data;
+    }
+
+    std::vector<uint8_t> WriteXChunks(const std::vector<uint8_t>& data, const bool encrypt, const bool parallel)
+    {
+        std::string zoneName = "test_zone";
+        MemoryWritingStream output;
+
+        {
+            OutputProcessorXChunks xChunks(STREAM_COUNT, XCHUNK_SIZE, XCHUNK_MAX_WRITE_SIZE, VANILLA_BUFFER_SIZE);
+            xChunks.SetBaseStream(&output);
+            xChunks.AddChunkProcessor(std::make_unique<XChunkProcessorDeflate>());
+            if (encrypt)
+                xChunks.AddChunkProcessor(std::make_unique<XChunkProcessorSalsa20Encryption>(STREAM_COUNT, zoneName, SALSA20_KEY, sizeof(SALSA20_KEY)));
+            if (parallel)
+                xChunks.EnableParallelProcessing();
+
+            // Uneven writes to cross chunk boundaries at different offsets
+            size_t offset = 0;
+            size_t writeSize = 1;
+            while (offset < data.size())
+            {
+                const auto toWrite = std::min(writeSize, data.size() - offset);
+                xChunks.Write(&data[offset], toWrite);
+                offset += toWrite;
+                writeSize = writeSize * 5 % 50000 + 1;
+            }
+            xChunks.Flush();
+        }
+
+        return output.m_data;
+    }
+
+    std::vector<uint8_t> LoadXChunks(const std::vector<uint8_t>& xChunkData, const bool decrypt, const unsigned prefetchChunkCount)
+    {
+        std::string zoneName = "test_zone";
+        MemoryLoadingStream input(xChunkData);
+
+        ProcessorXChunks xChunks(STREAM_COUNT, XCHUNK_SIZE, VANILLA_BUFFER_SIZE, prefetchChunkCount);
+        xChunks.SetBaseStream(&input);
+        if (decrypt)
+            xChunks.AddChunkProcessor(std::make_unique<XChunkProcessorSalsa20Decryption>(STREAM_COUNT, zoneName, SALSA20_KEY, sizeof(SALSA20_KEY)));
+        xChunks.AddChunkProcessor(std::make_unique<XChunkProcessorInflate>());
+
+        std::vector<uint8_t> data;
+        uint8_t buffer[0x3001];
+        while (true)
+        {
+            const auto loadedSize = xChunks.Load(buffer, sizeof(buffer));
+            if (loadedSize == 0)
+                break;
+
+            data.insert(data.end(), buffer, buffer + loadedSize);
+        }
+
+        return data;
+    }
+
+    TEST_CASE("ProcessorXChunks: Loads chunks that were written with and without worker threads", "[zoneloading][processor]")
+    {
+        const auto data = CreateCompressibleData(0x234567);
+
+        for (const auto encrypt : {false, true})
+        {
+            INFO("Encrypted: " << encrypt);
+
+            const auto serial = WriteXChunks(data, encrypt, false);
+            const auto parallel = WriteXChunks(data, encrypt, true);
+
+            // Chunks are written in order, so processing them on worker threads does not change the output
+            REQUIRE(serial == parallel);
+
+            for (const auto prefetchChunkCount : {1u, 4u})
+            {
+                INFO("Prefetched chunks: " << prefetchChunkCount);
+
+                REQUIRE(LoadXChunks(serial, encrypt, prefetchChunkCount) == data);
+            }
+        }
+    }
+} // namespace loading::processor::processor_xchunks
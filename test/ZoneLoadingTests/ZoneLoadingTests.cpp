@@ -0,0 +1,101 @@
+#include "Utils/MemoryMappedFile.h"
+#include "ZoneLoading.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace fs = std::filesystem;
+
+namespace zone_loading
+{
+    class TempFolder
+    {
+    public:
+        fs::path m_path;
+
+        TempFolder()
+            : m_path(fs::temp_directory_path() / "oat_zone_loading_tests")
+        {
+            fs::remove_all(m_path);
+            fs::create_directories(m_path);
+        }
+
+        ~TempFolder()
+        {
+            std::error_code ec;
+            fs::remove_all(m_path, ec);
+        }
+
+        TempFolder(const TempFolder& other) = delete;
+        TempFolder(TempFolder&& other) noexcept = delete;
+        TempFolder& operator=(const TempFolder& other) = delete;
+        TempFolder& operator=(TempFolder&& other) noexcept = delete;
+
+        std::string WriteFile(const std::string& fileName, const std::string& data) const
+        {
+            const auto filePath = m_path / fileName;
+            std::ofstream stream(filePath, std::ios::binary);
+            stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+
+            return filePath.string();
+        }
+    };
+
+    class OutputCapture
+    {
+    public:
+        std::ostringstream m_output;
+
+    private:
+        std::streambuf* m_previous_buffer;
+
+    public:
+        OutputCapture()
+            : m_previous_buffer(std::cout.rdbuf(m_output.rdbuf()))
+        {
+        }
+
+        ~OutputCapture()
+        {
+            std::cout.rdbuf(m_previous_buffer);
+        }
+
+        OutputCapture(const OutputCapture& other) = delete;
+        OutputCapture(OutputCapture&& other) noexcept = delete;
+        OutputCapture& operator=(const OutputCapture& other) = delete;
+        OutputCapture& operator=(OutputCapture&& other) noexcept = delete;
+    };
+
+    TEST_CASE("ZoneLoading: Falls back to reading files that cannot be mapped as a stream", "[zoneloading]")
+    {
+        const TempFolder folder;
+        const auto path = folder.WriteFile("empty.ff", std::string());
+
+        MemoryMappedFile mappedFile;
+        REQUIRE(!mappedFile.Open(path));
+
+        OutputCapture capture;
+        REQUIRE(ZoneLoading::LoadZone(path) == nullptr);
+
+        // The file could only have been opened and read by the file stream fallback
+        REQUIRE(capture.m_output.str().find("Failed to read zone header") != std::string::npos);
+    }
+
+    TEST_CASE("ZoneLoading: Does not load mapped files that are shorter than a zone header", "[zoneloading]")
+    {
+        const TempFolder folder;
+        const auto path = folder.WriteFile("short.ff", "IWff");
+
+        MemoryMappedFile mappedFile;
+        REQUIRE(mappedFile.Open(path));
+        mappedFile.Close();
+
+        OutputCapture capture;
+        REQUIRE(ZoneLoading::LoadZone(path) == nullptr);
+        REQUIRE(capture.m_output.str().find("Failed to read zone header") != std::string::npos);
+    }
+} // namespace zone_loading
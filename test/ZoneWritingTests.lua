@@ -0,0 +1,52 @@
+ZoneWritingTests = {}
+
+function ZoneWritingTests:include(includes)
+	if includes:handle(self:name()) then
+		includedirs {
+			path.join(TestFolder(), "ZoneWritingTests")
+		}
+	end
+end
+
+function ZoneWritingTests:link(links)
+	
+end
+
+function ZoneWritingTests:use()
+	
+end
+
+function ZoneWritingTests:name()
+    return "ZoneWritingTests"
+end
+
+function ZoneWritingTests:project()
+	local folder = TestFolder()
+	local includes = Includes:create()
+	local links = Links:create()
+
+	project(self:name())
+        targetdir(TargetDirectoryTest)
+		location "%{wks.location}/test/%{prj.name}"
+		kind "ConsoleApp"
+		language "C++"
+		
+		files {
+			path.join(folder, "ZoneWritingTests/**.h"), 
+			path.join(folder, "ZoneWritingTests/**.cpp")
+		}
+		
+        vpaths {
+			["*"] = {
+				path.join(folder, "ZoneWritingTests")
+			}
+		}
+		
+		self:include(includes)
+		ZoneWriting:include(includes)
+		catch2:include(includes)
+
+		links:linkto(ZoneWriting)
+		links:linkto(catch2)
+		links:linkall()
+end
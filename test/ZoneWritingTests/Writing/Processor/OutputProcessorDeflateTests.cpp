@@ -0,0 +1,139 @@
+#include "Writing/IWritingStream.h"
+#include "Writing/Processor/OutputProcessorDeflate.h"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <vector>
+#include <zlib.h>
+
+namespace writing::processor::output_processor_deflate
+{
+    class MemoryWritingStream final : public IWritingStream
+    {
+    public:
+        std::vector<uint8_t> m_data;
+
+        void Write(const void* buffer, const size_t length) override
+        {
+            const auto* bytes = static_cast<const uint8_t*>(buffer);
+            m_data.insert(m_data.end(), bytes, bytes + length);
+        }
+
+        void Flush() override {}
+
+        int64_t Pos() override
+        {
+            return static_cast<int64_t>(m_data.size());
+        }
+    };
+
+    std::vector<uint8_t> CreateCompressibleData(const size_t size)
+    {
+        std::vector<uint8_t> data(size);
+        uint32_t state = 0x12345678u;
+        for (auto i = 0u; i < size; i++)
+        {
+            state = state * 1103515245u + 12345u;
+            data[i] = static_cast<uint8_t>(i % 97 < 60 ? i % 13 : state >> 24);
+        }
+
+        return data;
+    }
+
+    std::vector<uint8_t> Deflate(const std::vector<uint8_t>& data, const int compressionLevel, const bool parallel)
+    {
+        MemoryWritingStream output;
+        OutputProcessorDeflate deflate;
+        deflate.SetBaseStream(&output);
+        deflate.SetCompressionLevel(compressionLevel);
+        if (parallel)
+            deflate.EnableParallelCompression();
+
+        // Uneven writes to cross block boundaries at different offsets
+        size_t offset = 0;
+        size_t writeSize = 1;
+        while (offset < data.size())
+        {
+            const auto toWrite = std::min(writeSize, data.size() - offset);
+            deflate.Write(&data[offset], toWrite);
+            offset += toWrite;
+            writeSize = writeSize * 7 % 100000 + 1;
+        }
+        deflate.Flush();
+
+        return output.m_data;
+    }
+
+    bool InflatesTo(const std::vector<uint8_t>& compressed, const std::vector<uint8_t>& expected)
+    {
+        // Inflating an extra byte verifies that the stream does not contain more data than expected
+        std::vector<uint8_t> inflated(expected.size() + 1);
+        auto inflatedSize = static_cast<uLongf>(inflated.size());
+        if (uncompress(inflated.data(), &inflatedSize, compressed.data(), static_cast<uLong>(compressed.size())) != Z_OK)
+            return false;
+
+        inflated.resize(inflatedSize);
+        return inflated == expected;
+    }
+
+    TEST_CASE("OutputProcessorDeflate: Parallel compression results in a single valid zlib stream", "[writing][deflate]")
+    {
+        const auto data = CreateCompressibleData(0x123456);
+
+        for (const auto compressionLevel : {0, 1, 6, 9})
+        {
+            const auto serial = Deflate(data, compressionLevel, false);
+            const auto parallel = Deflate(data, compressionLevel, true);
+
+            REQUIRE(InflatesTo(serial, data));
+            REQUIRE(InflatesTo(parallel, data));
+
+            // Only the zlib header and the adler32 checksum must be the same
+            REQUIRE(serial[0] == parallel[0]);
+            REQUIRE(serial[1] == parallel[1]);
+            REQUIRE(std::equal(serial.end() - 4, serial.end(), parallel.end() - 4));
+        }
+    }
+
+    TEST_CASE("OutputProcessorDeflate: Parallel compression of no data results in a valid zlib stream", "[writing][deflate]")
+    {
+        const std::vector<uint8_t> data;
+
+        REQUIRE(InflatesTo(Deflate(data, 6, true), data));
+    }
+
+    TEST_CASE("OutputProcessorDeflate: Parallel compression can share a thread pool between processors", "[writing][deflate]")
+    {
+        const auto firstData = CreateCompressibleData(0x54321);
+        const auto secondData = CreateCompressibleData(0x65432);
+
+        ThreadPool threadPool(2);
+        MemoryWritingStream firstOutput;
+        MemoryWritingStream secondOutput;
+        OutputProcessorDeflate firstDeflate;
+        OutputProcessorDeflate secondDeflate;
+        firstDeflate.SetBaseStream(&firstOutput);
+        secondDeflate.SetBaseStream(&secondOutput);
+        firstDeflate.EnableParallelCompression(&threadPool);
+        secondDeflate.EnableParallelCompression(&threadPool);
+
+        // Interleaved writes keep blocks of both processors in flight at the same time
+        constexpr size_t writeSize = 0x1000;
+        for (size_t offset = 0; offset < std::max(firstData.size(), secondData.size()); offset += writeSize)
+        {
+            if (offset < firstData.size())
+                firstDeflate.Write(&firstData[offset], std::min(writeSize, firstData.size() - offset));
+            if (offset < secondData.size())
+                secondDeflate.Write(&secondData[offset], std::min(writeSize, secondData.size() - offset));
+        }
+        firstDeflate.Flush();
+        secondDeflate.Flush();
+
+        // Blocks are deflated the same way regardless of the thread pool they are deflated on
+        REQUIRE(firstOutput.m_data == Deflate(firstData, 6, true));
+        REQUIRE(secondOutput.m_data == Deflate(secondData, 6, true));
+        REQUIRE(InflatesTo(firstOutput.m_data, firstData));
+        REQUIRE(InflatesTo(secondOutput.m_data, secondData));
+    }
+} // namespace writing::processor::output_processor_deflate
@@ -0,0 +1,153 @@
+#include "Writing/InMemoryZoneData.h"
+#include "Zone/Stream/Impl/InMemoryZoneOutputStream.h"
+#include "Zone/XBlock.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <typeindex>
+#include <vector>
+
+namespace zone::stream::in_memory_zone_output_stream
+{
+    constexpr int BLOCK_BIT_COUNT = 4;
+
+    class ZoneOutputStreamTestState
+    {
+    public:
+        InMemoryZoneData m_zone_data;
+        XBlock m_temp_block;
+        XBlock m_normal_block;
+        std::unique_ptr<InMemoryZoneOutputStream> m_stream;
+
+        ZoneOutputStreamTestState()
+            : m_temp_block("temp", 0, XBlock::Type::BLOCK_TYPE_TEMP),
+              m_normal_block("normal", 1, XBlock::Type::BLOCK_TYPE_NORMAL)
+        {
+            m_stream = std::make_unique<InMemoryZoneOutputStream>(&m_zone_data, std::vector{&m_temp_block, &m_normal_block}, BLOCK_BIT_COUNT, 1);
+            m_stream->PushBlock(1);
+        }
+
+        ~ZoneOutputStreamTestState()
+        {
+            m_stream->PopBlock();
+        }
+
+        ZoneOutputStreamTestState(const ZoneOutputStreamTestState& other) = delete;
+        ZoneOutputStreamTestState(ZoneOutputStreamTestState&& other) noexcept = delete;
+        ZoneOutputStreamTestState& operator=(const ZoneOutputStreamTestState& other) = delete;
+        ZoneOutputStreamTestState& operator=(ZoneOutputStreamTestState&& other) noexcept = delete;
+
+        static uintptr_t ZonePointer(const size_t offsetInNormalBlock)
+        {
+            return (static_cast<uintptr_t>(1) << (sizeof(uintptr_t) * 8 - BLOCK_BIT_COUNT) | offsetInNormalBlock) + 1;
+        }
+
+        template<typename T> bool WriteReusable(T* data, const size_t count)
+        {
+            void* ptr = data;
+            if (!m_stream->ReusableShouldWrite(&ptr, sizeof(T), std::type_index(typeid(T))))
+                return false;
+
+            m_stream->ReusableAddOffset(data, sizeof(T), count, std::type_index(typeid(T)));
+            m_stream->WriteDataInBlock(data, sizeof(T) * count);
+            return true;
+        }
+
+        template<typename T> void* Resolve(T* data)
+        {
+            void* ptr = data;
+            if (m_stream->ReusableShouldWrite(&ptr, sizeof(T), std::type_index(typeid(T))))
+                return nullptr;
+
+            return ptr;
+        }
+    };
+
+    TEST_CASE("InMemoryZoneOutputStream: Reuses pointers into already written entries", "[zonewriting][stream]")
+    {
+        ZoneOutputStreamTestState state;
+        int32_t first[4]{};
+        int32_t second[8]{};
+
+        REQUIRE(state.WriteReusable(first, std::extent_v<decltype(first)>));
+        REQUIRE(state.WriteReusable(second, std::extent_v<decltype(second)>));
+
+        REQUIRE(state.Resolve(&first[0]) == reinterpret_cast<void*>(ZoneOutputStreamTestState::ZonePointer(0)));
+        REQUIRE(state.Resolve(&first[3]) == reinterpret_cast<void*>(ZoneOutputStreamTestState::ZonePointer(12)));
+        REQUIRE(state.Resolve(&second[0]) == reinterpret_cast<void*>(ZoneOutputStreamTestState::ZonePointer(16)));
+        REQUIRE(state.Resolve(&second[5]) == reinterpret_cast<void*>(ZoneOutputStreamTestState::ZonePointer(36)));
+    }
+
+    TEST_CASE("InMemoryZoneOutputStream: Does not reuse pointers outside of written entries", "[zonewriting][stream]")
+    {
+        ZoneOutputStreamTestState state;
+        int32_t values[8]{};
+
+        REQUIRE(state.WriteReusable(&values[2], 4));
+
+        REQUIRE(state.Resolve(&values[0]) == nullptr);
+        REQUIRE(state.Resolve(&values[1]) == nullptr);
+        REQUIRE(state.Resolve(&values[6]) == nullptr);
+        REQUIRE(state.Resolve(&values[7]) == nullptr);
+        REQUIRE(state.Resolve(&values[2]) != nullptr);
+    }
+
+    TEST_CASE("InMemoryZoneOutputStream: Does not reuse pointers of other types", "[zonewriting][stream]")
+    {
+        ZoneOutputStreamTestState state;
+        int32_t values[4]{};
+
+        REQUIRE(state.WriteReusable(values, std::extent_v<decltype(values)>));
+
+        void* ptr = values;
+        REQUIRE(state.m_stream->ReusableShouldWrite(&ptr, sizeof(uint32_t), std::type_index(typeid(uint32_t))));
+        REQUIRE(ptr == values);
+    }
+
+    TEST_CASE("InMemoryZoneOutputStream: Prefers entries that were written first when entries overlap", "[zonewriting][stream]")
+    {
+        ZoneOutputStreamTestState state;
+        int32_t values[8]{};
+
+        // Written to zone offset 0
+        REQUIRE(state.WriteReusable(&values[4], 2));
+
+        // Written to zone offset 8 and covers the first entry
+        REQUIRE(state.WriteReusable(&values[2], 6));
+
+        REQUIRE(state.Resolve(&values[2]) == reinterpret_cast<void*>(ZoneOutputStreamTestState::ZonePointer(8)));
+        REQUIRE(state.Resolve(&values[3]) == reinterpret_cast<void*>(ZoneOutputStreamTestState::ZonePointer(12)));
+        REQUIRE(state.Resolve(&values[4]) == reinterpret_cast<void*>(ZoneOutputStreamTestState::ZonePointer(0)));
+        REQUIRE(state.Resolve(&values[5]) == reinterpret_cast<void*>(ZoneOutputStreamTestState::ZonePointer(4)));
+        REQUIRE(state.Resolve(&values[6]) == reinterpret_cast<void*>(ZoneOutputStreamTestState::ZonePointer(24)));
+        REQUIRE(state.Resolve(&values[7]) == reinterpret_cast<void*>(ZoneOutputStreamTestState::ZonePointer(28)));
+    }
+
+    TEST_CASE("InMemoryZoneOutputStream: Benchmark writing zone with many reusable entries", "[zonewriting][stream][.benchmark]")
+    {
+        constexpr size_t ENTRY_COUNT = 100000;
+        constexpr size_t VALUES_PER_ENTRY = 4;
+
+        std::vector<float> values(ENTRY_COUNT * VALUES_PER_ENTRY);
+
+        BENCHMARK("Write 100k reusable entries and resolve a pointer into each")
+        {
+            ZoneOutputStreamTestState state;
+            size_t resolvedCount = 0;
+
+            for (auto i = 0u; i < ENTRY_COUNT; i++)
+                state.WriteReusable(&values[i * VALUES_PER_ENTRY], VALUES_PER_ENTRY);
+
+            for (auto i = 0u; i < ENTRY_COUNT; i++)
+            {
+                if (state.Resolve(&values[i * VALUES_PER_ENTRY + 1]) != nullptr)
+                    resolvedCount++;
+            }
+
+            return resolvedCount;
+        };
+    }
+} // namespace zone::stream::in_memory_zone_output_stream